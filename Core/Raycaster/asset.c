@@ -0,0 +1,194 @@
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "asset.h"
+#include "lz4.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/* LOCAL DATA --------------------------------------------------------------- */
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+static uint32_t asset_palettesize(const asset_entry_t* e);
+static uint32_t asset_levelsize(const asset_entry_t* e, int k);
+static uint32_t asset_mipsize(const asset_entry_t* e);
+static bool asset_section(uint32_t size, uint32_t offset, uint32_t count, uint32_t elem);
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Use an asset pack in place. Nothing is copied, data has to stay valid as
+ *  long as the atlas is used in place.
+ *  Returns false if data is not a valid asset pack. */
+bool asset_open(asset_pack_t* pack, const void* data, uint32_t size)
+{
+    const asset_header_t* h = (const asset_header_t*)data;
+    int atlas = -1;
+
+    if (size < sizeof(asset_header_t) || ((uintptr_t)data & (ASSET_ALIGNMENT - 1)) != 0)
+        return false;
+    if (h->magic != ASSET_MAGIC || h->version != ASSET_VERSION || h->size > size ||
+        !asset_section(h->size, sizeof(asset_header_t), h->count, sizeof(asset_entry_t)))
+        return false;
+
+    const asset_entry_t* entries = (const asset_entry_t*)(h + 1);
+    for (uint32_t i = 0; i < h->count; i++)
+    {
+        const asset_entry_t* e = &entries[i];
+        if (e->type == ASSET_ATLAS && atlas < 0)
+        {
+            if (!asset_section(h->size, e->offset, e->packed, 1) || (e->offset & (ASSET_ALIGNMENT - 1)) != 0 ||
+                (e->compression == ASSET_RAW && e->packed != e->size) || e->compression > ASSET_LZ4 ||
+                e->miplevels < 1 || e->miplevels > MAX_MIPLEVELS || asset_bytesperpixel(e->format) == 0 ||
+                e->width > ASSET_MAX_EDGE || e->height > ASSET_MAX_EDGE || // before asset_mipsize
+                asset_palettesize(e) + asset_mipsize(e) > e->size ||
+                (e->spans != 0 && (e->spans < asset_palettesize(e) + asset_mipsize(e) || e->spans > e->size ||
+                                   (e->spans & 1) != 0)))
+                return false;
+            atlas = (int)i;
+        }
+        else if (e->type != ASSET_RECT)
+        {
+            return false;
+        }
+    }
+    if (atlas < 0)
+        return false;
+
+    /* all textures have to be inside the atlas, span tables inside the span data */
+    const asset_entry_t* a = &entries[atlas];
+    const uint32_t spancount = a->spans ? (a->size - a->spans) / sizeof(uint16_t) : 0;
+    for (uint32_t i = 0; i < h->count; i++)
+    {
+        const asset_entry_t* e = &entries[i];
+        if (e->type == ASSET_RECT && (e->frames < 1 || e->u + (uint32_t)e->width * e->frames > a->width ||
+                                      (uint32_t)e->v + e->height > a->height ||
+                                      (e->spans != TEXTURE_NO_SPANS && e->spans >= spancount)))
+            return false;
+    }
+
+    pack->header = h;
+    pack->entries = entries;
+    pack->count = (int)h->count;
+    pack->atlas = atlas;
+    return true;
+}
+
+/** Index of the asset with the given name or -1 */
+int asset_find(const asset_pack_t* pack, const char* name)
+{
+    for (int i = 0; i < pack->count; i++)
+    {
+        if (strncmp(pack->entries[i].name, name, ASSET_NAME_LENGTH) == 0)
+            return i;
+    }
+    return -1;
+}
+
+/** Size of the buffer asset_atlas needs, 0 if the atlas is used in place */
+uint32_t asset_atlas_size(const asset_pack_t* pack)
+{
+    const asset_entry_t* e = &pack->entries[pack->atlas];
+    return (e->compression == ASSET_RAW) ? 0 : e->size;
+}
+
+/** Set up the texture atlas. An uncompressed atlas is used in place and buf
+ *  may be NULL, otherwise the atlas is inflated into buf, which needs room
+ *  for asset_atlas_size() bytes and should be ASSET_ALIGNMENT aligned. */
+bool asset_atlas(const asset_pack_t* pack, atlas_t* atlas, void* buf)
+{
+    const asset_entry_t* e = &pack->entries[pack->atlas];
+    const unsigned char* p = (const unsigned char*)pack->header + e->offset;
+
+    if (e->compression == ASSET_LZ4)
+    {
+        if (!buf || lz4_decompress(p, e->packed, buf, e->size) != (int32_t)e->size)
+            return false;
+        p = buf;
+    }
+
+    memset(atlas, 0, sizeof(*atlas));
+    atlas->width = e->width;
+    atlas->height = e->height;
+    atlas->format = e->format;
+    atlas->bytesperpixel = asset_bytesperpixel(e->format);
+    atlas->miplevels = e->miplevels;
+    if (e->spans)
+    {
+        atlas->spans = (const uint16_t*)(p + e->spans);
+        atlas->spancount = (e->size - e->spans) / sizeof(uint16_t);
+    }
+    if (e->format == TEXTURE_I8)
+    {
+        atlas->palette = (const uint32_t*)p;
+        p += asset_palettesize(e);
+    }
+    for (int k = 0; k < e->miplevels; k++)
+    {
+        atlas->mip[k] = p;
+        p += asset_levelsize(e, k);
+    }
+    return true;
+}
+
+/** Set t to the atlas rectangle of texture asset index */
+bool asset_texture(const asset_pack_t* pack, int index, texture_t* t)
+{
+    if (index < 0 || index >= pack->count || pack->entries[index].type != ASSET_RECT)
+        return false;
+
+    const asset_entry_t* e = &pack->entries[index];
+    t->u = e->u;
+    t->v = e->v;
+    t->width = e->width;
+    t->height = e->height;
+    t->spans = e->spans;
+    t->frames = e->frames;
+    t->period = e->period;
+    return true;
+}
+
+/** Bytes per texel of a texture format or 0 for unknown formats */
+int asset_bytesperpixel(int format)
+{
+    switch (format)
+    {
+    case TEXTURE_ARGB8888: return 4;
+    case TEXTURE_RGB565:   return 2;
+    case TEXTURE_L8:       return 1;
+    case TEXTURE_I8:       return 1;
+    default:               return 0;
+    }
+}
+
+/** Size of the palette in front of the texels in bytes */
+static uint32_t asset_palettesize(const asset_entry_t* e)
+{
+    return (e->format == TEXTURE_I8) ? PALETTE_SIZE * sizeof(uint32_t) : 0;
+}
+
+/** Size of mip level k in bytes, width and height are at most ASSET_MAX_EDGE */
+static uint32_t asset_levelsize(const asset_entry_t* e, int k)
+{
+    return (uint32_t)(e->width >> k) * (uint32_t)(e->height >> k) * (uint32_t)asset_bytesperpixel(e->format);
+}
+
+/** Size of the complete mip chain in bytes */
+static uint32_t asset_mipsize(const asset_entry_t* e)
+{
+    uint32_t size = 0;
+    for (int k = 0; k < e->miplevels; k++)
+    {
+        size += asset_levelsize(e, k);
+    }
+    return size;
+}
+
+/** True if count elements of elem bytes at offset fit into a pack of size
+ *  bytes, without overflowing on the way */
+static bool asset_section(uint32_t size, uint32_t offset, uint32_t count, uint32_t elem)
+{
+    return offset <= size && count <= (size - offset) / elem;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "engine.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/*
+ * Asset pack (see tools/assetc.c): a header, a table of asset entries and
+ * the data of the texture atlas. The atlas is stored in the runtime format
+ * of r_drawcolumn (palette for TEXTURE_I8, the column-major mip levels back
+ * to back, then the span tables of textures with transparent texels) and
+ * aligned to a cache line, so an uncompressed atlas is
+ * used in place from flash or SDRAM. A compressed atlas (LZ4 block format)
+ * is inflated into a buffer supplied by the caller, usually in SDRAM at boot.
+ * Every texture in the atlas has an ASSET_RECT entry with its name. The
+ * frames of an animated texture are stored side by side in the atlas, the
+ * entry describes the first frame.
+ */
+#define ASSET_MAGIC       0x4b415041u /**< "APAK" */
+#define ASSET_VERSION     5
+#define ASSET_NAME_LENGTH 16 /**< including terminating zero */
+#define ASSET_ALIGNMENT   32 /**< alignment of atlas data in the pack */
+#define ASSET_MAX_EDGE    4096 /**< max. atlas width and height, keeps the mip sizes in 32 bit */
+
+/* Asset types */
+#define ASSET_ATLAS       0 /**< texture atlas data */
+#define ASSET_RECT        1 /**< texture: rectangle in the atlas, no data */
+
+/* Compression methods */
+#define ASSET_RAW         0
+#define ASSET_LZ4         1
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Asset pack header */
+typedef struct
+{
+    uint32_t magic;   /**< ASSET_MAGIC */
+    uint32_t version; /**< ASSET_VERSION */
+    uint32_t size;    /**< total pack size in bytes */
+    uint32_t count;   /**< number of asset entries following the header */
+} asset_header_t;
+
+/** Asset table entry */
+typedef struct
+{
+    char     name[ASSET_NAME_LENGTH];
+    uint32_t offset;      /**< ASSET_ATLAS: stored data, from start of pack */
+    uint32_t size;        /**< ASSET_ATLAS: data size in bytes, palette and all mip levels */
+    uint32_t packed;      /**< ASSET_ATLAS: stored size in bytes, equal to size for ASSET_RAW */
+    uint16_t u;           /**< ASSET_RECT: first column in the atlas */
+    uint16_t v;           /**< ASSET_RECT: first row in the atlas */
+    uint16_t width;       /**< mip level 0 width */
+    uint16_t height;      /**< mip level 0 height */
+    uint8_t  type;        /**< ASSET_ATLAS or ASSET_RECT */
+    uint8_t  format;      /**< TEXTURE_ARGB8888, TEXTURE_RGB565, TEXTURE_L8 or TEXTURE_I8 */
+    uint8_t  miplevels;   /**< number of mip levels, >= 1 */
+    uint8_t  compression; /**< ASSET_RAW or ASSET_LZ4 */
+    uint32_t spans;       /**< ASSET_ATLAS: byte offset of the span tables in the data or 0,
+                               ASSET_RECT: span table index or TEXTURE_NO_SPANS */
+    uint16_t frames;      /**< ASSET_RECT: number of animation frames, >= 1 */
+    uint16_t period;      /**< ASSET_RECT: milliseconds per animation frame */
+} asset_entry_t;
+
+typedef struct
+{
+    const asset_header_t* header;
+    const asset_entry_t* entries;
+    int count;
+    int atlas; /**< index of the ASSET_ATLAS entry */
+} asset_pack_t;
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool asset_open(asset_pack_t* pack, const void* data, uint32_t size);
+int asset_find(const asset_pack_t* pack, const char* name);
+uint32_t asset_atlas_size(const asset_pack_t* pack);
+bool asset_atlas(const asset_pack_t* pack, atlas_t* atlas, void* buf);
+bool asset_texture(const asset_pack_t* pack, int index, texture_t* t);
+int asset_bytesperpixel(int format);
+
+#ifdef __cplusplus
+}
+#endif
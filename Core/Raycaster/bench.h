@@ -0,0 +1,468 @@
+/* Generated from assets/levels/bench.txt, do not edit */
+#pragma once
+
+#include <stdint.h>
+
+const uint8_t m_bench[7360] __attribute__((aligned(32))) =
+{
+    0x4c, 0x56, 0x4c, 0x31, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x1c, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0xc0, 0x3f, 0x81, 0x04, 0x35, 0x3f,
+    0x81, 0x04, 0x35, 0x3f, 0x88, 0x00, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xa8, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x1b, 0x00, 0x00, 0x68, 0x1c, 0x00, 0x00,
+    0xa8, 0x1c, 0x00, 0x00, 0xb8, 0x1c, 0x00, 0x00, 0xbc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x08, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0xca, 0x41, 0xe9, 0xe8, 0xd2, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xef, 0xee, 0x5a, 0x41, 0x7e, 0x7d, 0xf3, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xe6, 0xe5, 0x83, 0x41, 0x42, 0x42, 0x46, 0x41, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0x74, 0x41,
+    0xc2, 0xc1, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xcf, 0x5b, 0x41, 0x0e, 0x0e, 0x3a, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf4, 0x41, 0x64, 0x64, 0xaa, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x3e, 0x3e, 0xb4, 0x41, 0x92, 0x92, 0xb2, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x67, 0x67, 0x2b, 0x41,
+    0xbe, 0xbd, 0x29, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xd6, 0x5a, 0x41, 0x28, 0x28, 0x64, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x9d, 0x41, 0x71, 0x71, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xe6, 0xe5, 0x83, 0x41, 0x40, 0x40, 0x8a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x4f, 0xcd, 0x41,
+    0xbb, 0xba, 0x26, 0x41, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe2, 0x66, 0x41, 0xae, 0xad, 0x93, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xf9, 0xf8, 0xf2, 0x41, 0x16, 0x16, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xed, 0xec, 0xba, 0x41, 0xa4, 0xa3, 0xab, 0x40, 0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0x67, 0x41,
+    0xa0, 0x9f, 0xb7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0xb2, 0x41, 0x2e, 0x2e, 0xd6, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x6c, 0x40, 0x2f, 0x2f, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x95, 0x94, 0x28, 0x41, 0x0a, 0x0a, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xeb, 0x41,
+    0x08, 0x08, 0xf2, 0x41, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x93, 0x41, 0xf1, 0xf0, 0xb2, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xd5, 0xd4, 0xea, 0x41, 0xd3, 0xd2, 0xcc, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x77, 0x77, 0x85, 0x41, 0xf3, 0xf2, 0x8a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0xb5, 0x3f,
+    0xc3, 0xc2, 0x9c, 0x41, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdd, 0x6d, 0x40, 0x70, 0x6f, 0x1f, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0xf9, 0x25, 0x41, 0xa1, 0xa0, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xe1, 0xe0, 0x24, 0x41, 0xfa, 0xf9, 0x65, 0x41, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0xc4, 0x41,
+    0x10, 0x10, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0xe8, 0x40, 0xed, 0xec, 0x28, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xef, 0x3b, 0x41, 0x5e, 0x5e, 0xdc, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x3d, 0x3d, 0xcb, 0x41, 0xd3, 0xd2, 0xa4, 0x41, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe1, 0x51, 0x40,
+    0xe0, 0xdf, 0x8d, 0x41, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdb, 0xbb, 0x3f, 0xf4, 0xf3, 0xcb, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xd6, 0xd5, 0xdb, 0x41, 0x36, 0x36, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x77, 0x67, 0x40, 0x42, 0x42, 0xd4, 0x41, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa4, 0x48, 0x41,
+    0x74, 0x74, 0x68, 0x41, 0x00, 0x00, 0x00, 0x00, 0xad, 0xac, 0x28, 0x41, 0x58, 0x58, 0x54, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x8c, 0x41, 0x27, 0x27, 0xa5, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xb3, 0xb2, 0xdc, 0x41, 0xd7, 0xd6, 0x8c, 0x41, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x18, 0x41,
+    0xf2, 0xf1, 0x21, 0x40, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe4, 0x78, 0x41, 0x1d, 0x1d, 0xb5, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x78, 0x41, 0x75, 0x75, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xe8, 0xe7, 0x95, 0x41, 0xc1, 0xc0, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0xec, 0xeb, 0xe5, 0x41,
+    0xee, 0xed, 0x8b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x1f, 0x40, 0x8b, 0x8a, 0x8c, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xa7, 0xa6, 0xbc, 0x41, 0x4a, 0x4a, 0x26, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0xf7, 0x7b, 0x41, 0x55, 0x55, 0xcb, 0x41, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb0, 0xf2, 0x41,
+    0xa8, 0xa7, 0xd5, 0x41, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa0, 0xca, 0x41, 0x4b, 0x4b, 0x07, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0xaa, 0x40, 0x12, 0x12, 0xaa, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xd1, 0xd0, 0xba, 0x41, 0x68, 0x68, 0xc8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x9c, 0x41,
+    0x3a, 0x3a, 0x92, 0x40, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x35, 0x41, 0x61, 0x61, 0x35, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0x91, 0xab, 0x41, 0xfe, 0xfd, 0x8b, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xee, 0xed, 0x95, 0x40, 0x80, 0x80, 0xa2, 0x41, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x57, 0x41,
+    0xa7, 0xa6, 0x6a, 0x41, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0x50, 0x40, 0x7a, 0x7a, 0xe4, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0xd2, 0x41, 0x0b, 0x0b, 0xcd, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xc3, 0xcb, 0x40, 0x98, 0x98, 0x68, 0x40, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xd4, 0xda, 0x41,
+    0xa6, 0xa5, 0xa3, 0x41, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0x64, 0x41, 0x9e, 0x9d, 0x19, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x93, 0x41, 0xa4, 0xa3, 0xed, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x35, 0xdb, 0x41, 0x64, 0x64, 0x68, 0x41, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xf3, 0xf5, 0x41,
+    0x86, 0x85, 0xb3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x53, 0x53, 0x57, 0x41, 0xb6, 0xb5, 0x93, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0xaf, 0xf5, 0x41, 0xd0, 0xcf, 0xed, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0x31, 0x89, 0x40, 0xde, 0xdd, 0xab, 0x41, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xde, 0xa4, 0x41,
+    0xfb, 0xfa, 0xa4, 0x41, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xda, 0x3f, 0x2b, 0x2b, 0xbd, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xb2, 0xb1, 0x21, 0x40, 0x1e, 0x1e, 0xbc, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x9a, 0x99, 0xf3, 0x41, 0xf4, 0xf3, 0x67, 0x41, 0x00, 0x00, 0x00, 0x00, 0xed, 0xec, 0x08, 0x41,
+    0x33, 0x33, 0xbd, 0x41, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x9c, 0x41, 0xd3, 0xd2, 0x8c, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xef, 0xee, 0x9c, 0x41, 0xeb, 0xea, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0xe2, 0x41, 0x3a, 0x3a, 0x92, 0x40, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb0, 0x60, 0x40,
+    0xca, 0xc9, 0xa3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0xdc, 0x41, 0xb7, 0xb6, 0xae, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x76, 0x76, 0xc4, 0x41, 0x48, 0x48, 0x8a, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0xfc, 0x78, 0x41, 0xad, 0xac, 0xaa, 0x41, 0x00, 0x00, 0x00, 0x00, 0x87, 0x86, 0x94, 0x41,
+    0xde, 0xdd, 0x59, 0x41, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdb, 0xbd, 0x41, 0x14, 0x14, 0xaa, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xc9, 0xc8, 0x92, 0x41, 0x6c, 0x6c, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xa9, 0xa8, 0xaa, 0x41, 0x03, 0x03, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc7, 0xb5, 0x41,
+    0x35, 0x35, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xde, 0x0a, 0x41, 0x21, 0x21, 0xc1, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0xbf, 0xbe, 0xe4, 0x41, 0x49, 0x49, 0x93, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x6a, 0x6a, 0x16, 0x41, 0x30, 0x30, 0xba, 0x41, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xaa, 0x41,
+    0x70, 0x6f, 0xb7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x82, 0x81, 0xa3, 0x41, 0xd8, 0xd7, 0xcd, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0xfb, 0xd5, 0x41, 0x61, 0x61, 0x75, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x63, 0xe5, 0x41, 0x00, 0x00, 0x30, 0x40, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0x45, 0x41,
+    0x91, 0x90, 0x74, 0x41, 0x00, 0x00, 0x00, 0x00, 0x96, 0x95, 0xb5, 0x3f, 0x29, 0x29, 0x93, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x45, 0x41, 0xad, 0xac, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x0f, 0x1f, 0x40, 0xb8, 0xb7, 0x1b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x46, 0x46, 0xc4, 0x41,
+    0xca, 0xc9, 0xb3, 0x41, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf7, 0xd7, 0x3f, 0x19, 0x19, 0x05, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0x58, 0x92, 0x41, 0xb1, 0xb0, 0xda, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xad, 0xac, 0xea, 0x41, 0x90, 0x8f, 0x5b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0xc3, 0x41,
+    0x58, 0x58, 0xc2, 0x41, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xf3, 0xb5, 0x41, 0x02, 0x02, 0xcc, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x4b, 0x41, 0x93, 0x92, 0x46, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x98, 0x97, 0x4b, 0x41, 0x88, 0x87, 0x4b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x47, 0x41,
+    0xfc, 0xfb, 0xbd, 0x41, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcb, 0x67, 0x41, 0x9e, 0x9d, 0xf3, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x76, 0x76, 0x7a, 0x41, 0xa0, 0x9f, 0x0b, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x3b, 0x3b, 0xa5, 0x41, 0xa9, 0xa8, 0x8a, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xcf, 0xe5, 0x41,
+    0x1b, 0x1b, 0x85, 0x41, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc7, 0xdd, 0x41, 0xbb, 0xba, 0xda, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0xed, 0x41, 0x82, 0x81, 0xa9, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x6e, 0x6e, 0x2a, 0x41, 0xaf, 0xae, 0x96, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x89, 0x45, 0x41,
+    0xea, 0xe9, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00, 0x47, 0x47, 0xc5, 0x41, 0x92, 0x91, 0x61, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0xd3, 0x41, 0x22, 0x22, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x6c, 0x6c, 0xca, 0x41, 0x27, 0x27, 0x57, 0x40, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xbf, 0x95, 0x41,
+    0xf0, 0xef, 0x5b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x90, 0x8f, 0xc5, 0x41, 0xbf, 0xbe, 0x3a, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xda, 0xd9, 0x25, 0x41, 0x34, 0x34, 0xa2, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0xcb, 0x41, 0x92, 0x91, 0x21, 0x40, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x10, 0x40,
+    0x39, 0x39, 0x55, 0x41, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xde, 0xdc, 0x41, 0x0e, 0x0e, 0x9c, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0xbd, 0x41, 0x14, 0x14, 0x68, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x18, 0x24, 0x41, 0x29, 0x29, 0xd3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x16, 0x41,
+    0xf9, 0xf8, 0xaa, 0x41, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xf4, 0x40, 0x0c, 0x0c, 0xca, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xe8, 0xe7, 0xc5, 0x41, 0x70, 0x6f, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x84, 0x41, 0x66, 0x66, 0x7a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x69, 0x91, 0x40,
+    0x65, 0x65, 0xc3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0xea, 0x40, 0x1f, 0x1f, 0xe5, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xbe, 0xbd, 0x59, 0x41, 0xe8, 0xe7, 0xad, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x7e, 0x7e, 0x6e, 0x40, 0x3d, 0x3d, 0x59, 0x41, 0x00, 0x00, 0x00, 0x00, 0xea, 0xe9, 0xeb, 0x41,
+    0x50, 0x50, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xda, 0xc4, 0x41, 0xf8, 0xf7, 0x85, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xc2, 0xc1, 0x05, 0x41, 0x31, 0x31, 0xa9, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x76, 0x75, 0xd5, 0x3f, 0x82, 0x81, 0x51, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x8a, 0xc4, 0x41,
+    0x7e, 0x7d, 0x6d, 0x40, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb7, 0x95, 0x41, 0xfc, 0xfb, 0x37, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x51, 0x51, 0xd3, 0x41, 0xb0, 0xaf, 0xa5, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xef, 0xf7, 0x40, 0xd2, 0xd1, 0xe3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8e, 0xe4, 0x41,
+    0x3b, 0x3b, 0xa5, 0x41, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf2, 0xea, 0x40, 0x9a, 0x99, 0xbb, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xde, 0xdd, 0xd3, 0x41, 0x20, 0x20, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x74, 0x74, 0x38, 0x41, 0x8b, 0x8a, 0x8c, 0x41, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa3, 0x07, 0x41,
+    0x54, 0x54, 0x92, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd3, 0xcd, 0x41, 0x4f, 0x4f, 0xcd, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x8a, 0x89, 0xb3, 0x41, 0xe9, 0xe8, 0x64, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0xc7, 0x95, 0x41, 0xbd, 0xbc, 0x48, 0x41, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0xa5, 0x3f,
+    0x99, 0x98, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0xbc, 0x41, 0xb8, 0xb7, 0xb5, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x69, 0x15, 0x41, 0x41, 0x41, 0xcb, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x4a, 0x4a, 0x16, 0x41, 0xd0, 0xcf, 0xb5, 0x41, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x66, 0x41,
+    0xde, 0xdd, 0x19, 0x41, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x1b, 0x41, 0x5e, 0x5e, 0x6a, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xac, 0xab, 0x57, 0x41, 0x08, 0x08, 0xc2, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xbc, 0xbb, 0xb5, 0x41, 0x01, 0x01, 0x45, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xd8, 0x74, 0x41,
+    0xae, 0xad, 0x1d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x41, 0x2c, 0x2c, 0x94, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x8f, 0xb5, 0x41, 0x7c, 0x7b, 0x07, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0xa7, 0x8d, 0x41, 0x61, 0x61, 0x65, 0x41, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x9b, 0xd3, 0x40,
+    0xe6, 0xe5, 0x49, 0x41, 0x00, 0x00, 0x00, 0x00, 0x97, 0x96, 0xee, 0x40, 0x85, 0x84, 0xf2, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x47, 0x41, 0x4a, 0x4a, 0xf4, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xc3, 0x8b, 0x40, 0x08, 0x08, 0x18, 0x40, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x56, 0x40,
+    0x9d, 0x9c, 0xda, 0x41, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa4, 0x9a, 0x41, 0xe3, 0xe2, 0xa4, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xc6, 0xc5, 0x09, 0x41, 0xbc, 0xbb, 0x07, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0xce, 0xb4, 0x41, 0xa5, 0xa4, 0xa2, 0x41, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb4, 0x92, 0x41,
+    0x47, 0x47, 0xa5, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd3, 0x77, 0x41, 0x76, 0x76, 0x66, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xea, 0xe9, 0x65, 0x41, 0xed, 0xec, 0x48, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x56, 0x56, 0xf4, 0x41, 0xb7, 0xb6, 0x2a, 0x41, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfc, 0xe2, 0x41,
+    0x2c, 0x2c, 0xcc, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xf4, 0x41, 0x68, 0x68, 0x64, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x5e, 0x5e, 0xc4, 0x41, 0x99, 0x98, 0x54, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xb8, 0xb7, 0xe5, 0x41, 0x95, 0x94, 0xca, 0x41, 0x00, 0x00, 0x00, 0x00, 0x78, 0x77, 0x8f, 0x40,
+    0x51, 0x51, 0xbb, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xd8, 0x82, 0x41, 0x9e, 0x9d, 0xbd, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0xfc, 0xb4, 0x40, 0xed, 0xec, 0x92, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x61, 0x61, 0xc3, 0x41, 0x5a, 0x5a, 0xf2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x5c, 0x94, 0x40,
+    0x3f, 0x3f, 0xb7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0xf4, 0x40, 0xd3, 0xd2, 0xb2, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0xb5, 0x41, 0x7e, 0x7e, 0x4a, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x2a, 0x06, 0x41, 0x16, 0x16, 0xdc, 0x41, 0x00, 0x00, 0x00, 0x00, 0x68, 0x68, 0x64, 0x41,
+    0xa5, 0xa4, 0x9a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0xf3, 0x41, 0x42, 0x42, 0x94, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0x35, 0x41, 0xf3, 0xf2, 0xac, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xd7, 0xd6, 0x1a, 0x41, 0xd0, 0xcf, 0xbd, 0x41, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x44, 0x41,
+    0xe7, 0xe6, 0xac, 0x41, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x41, 0x86, 0x86, 0x4a, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x5d, 0x93, 0x41, 0xf9, 0xf8, 0xaa, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x8f, 0xed, 0x41, 0x32, 0x32, 0x76, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xd6, 0xec, 0x41,
+    0xb2, 0xb1, 0xa3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0xd2, 0x40, 0xaf, 0xae, 0x1e, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0xfd, 0x59, 0x41, 0x92, 0x91, 0x93, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xf6, 0xf5, 0xad, 0x40, 0xb0, 0xaf, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe2, 0x12, 0x40,
+    0x22, 0x22, 0x76, 0x41, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe6, 0xcc, 0x41, 0xf6, 0xf5, 0x9b, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x86, 0xdc, 0x41, 0x33, 0x33, 0x95, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x72, 0x72, 0x84, 0x41, 0xca, 0xc9, 0x05, 0x41, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x90, 0x40,
+    0xff, 0xfe, 0xac, 0x41, 0x00, 0x00, 0x00, 0x00, 0x95, 0x94, 0x38, 0x41, 0x0e, 0x0e, 0x96, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0xa7, 0xad, 0x41, 0x30, 0x30, 0x14, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x0f, 0xcd, 0x41, 0xd6, 0xd5, 0x39, 0x41, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbc, 0xba, 0x41,
+    0xb3, 0xb2, 0x8c, 0x41, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0xb4, 0x41, 0x88, 0x87, 0xef, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xa4, 0xa3, 0x27, 0x41, 0x15, 0x15, 0x09, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xb6, 0xb5, 0x09, 0x41, 0xc0, 0xbf, 0x8d, 0x41, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcc, 0x1c, 0x40,
+    0x8a, 0x89, 0xf3, 0x41, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xde, 0x6a, 0x41, 0xfa, 0xf9, 0x35, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xab, 0xaa, 0xd2, 0x40, 0x33, 0x33, 0xad, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x8b, 0x8a, 0xe4, 0x41, 0x60, 0x60, 0xba, 0x41, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x93, 0x41,
+    0x4b, 0x4b, 0x93, 0x40, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0xdb, 0x41, 0x16, 0x16, 0xb4, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x45, 0x41, 0x76, 0x75, 0x19, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x57, 0xbd, 0x41, 0x4e, 0x4e, 0xdc, 0x41, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6e, 0x94, 0x41,
+    0x8e, 0x8d, 0xd5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x9b, 0x85, 0x41, 0x26, 0x26, 0xee, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xb7, 0xb6, 0xce, 0x40, 0x51, 0x51, 0xd3, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xc2, 0xc1, 0xc9, 0x40, 0x48, 0x48, 0xd2, 0x41, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf2, 0xca, 0x40,
+    0x04, 0x04, 0xac, 0x40, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0xca, 0x41, 0x0f, 0x0f, 0xad, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x9c, 0x41, 0xec, 0xeb, 0xd3, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xc3, 0x17, 0x41, 0x56, 0x56, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0xc4, 0x41,
+    0x05, 0x05, 0x9b, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd5, 0xeb, 0x41, 0x40, 0x40, 0xba, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xdd, 0x41, 0x4b, 0x4b, 0x9d, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xa9, 0xa8, 0xf0, 0x40, 0x52, 0x51, 0x61, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9c, 0xa2, 0x41,
+    0x90, 0x8f, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x00, 0xad, 0xac, 0xb2, 0x41, 0x61, 0x61, 0x65, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x6e, 0x6d, 0x1d, 0x40, 0x98, 0x97, 0xb7, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0xcf, 0x2b, 0x41, 0x5c, 0x5c, 0xc2, 0x41, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb2, 0x8a, 0x40,
+    0xd5, 0xd4, 0x68, 0x41, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb2, 0x62, 0x40, 0xdb, 0xda, 0xba, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x14, 0x41, 0xd9, 0xd8, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x27, 0xed, 0x41, 0x26, 0x26, 0xb4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x92, 0x40,
+    0xee, 0xed, 0x1d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x9b, 0x41, 0x38, 0x38, 0x82, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xac, 0xab, 0x57, 0x41, 0x78, 0x78, 0xb2, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x64, 0x64, 0xc4, 0x3f, 0x0e, 0x0e, 0xd4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0xd4, 0x41,
+    0x5d, 0x5d, 0xdb, 0x41, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x55, 0x41, 0x71, 0x71, 0x9b, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x64, 0x63, 0xc3, 0x3f, 0x54, 0x54, 0xec, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x8e, 0x8d, 0x93, 0x41, 0x77, 0x77, 0x8d, 0x41, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x29, 0x41,
+    0x39, 0x39, 0xeb, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xf3, 0x41, 0xc0, 0xbf, 0xd7, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x9c, 0x9b, 0xbb, 0x3f, 0x4c, 0x4c, 0x28, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x1a, 0xf2, 0x40, 0x7c, 0x7b, 0x6b, 0x40, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xd8, 0x90, 0x40,
+    0xa1, 0xa0, 0x54, 0x41, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x55, 0x41, 0xba, 0xb9, 0xd1, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x8b, 0x8a, 0xa4, 0x41, 0x89, 0x88, 0x04, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xca, 0xc9, 0x83, 0x41, 0x71, 0x71, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x93, 0x41,
+    0x7a, 0x7a, 0xd4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x75, 0x41, 0x90, 0x8f, 0xaf, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0xa9, 0xa8, 0xe2, 0x41, 0xbc, 0xbb, 0x2b, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xbf, 0xbe, 0x4a, 0x41, 0x86, 0x85, 0xcb, 0x41, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7b, 0xa5, 0x41,
+    0xbe, 0xbd, 0x2d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0xcb, 0x40, 0x98, 0x97, 0xcd, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0xc2, 0x41, 0xb8, 0xb7, 0xcd, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0xa4, 0x8a, 0x41, 0x60, 0x60, 0xaa, 0x41, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x8b, 0x41,
+    0x84, 0x84, 0x48, 0x41, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb9, 0x05, 0x41, 0x0a, 0x0a, 0x36, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xcd, 0xcc, 0xf2, 0x41, 0xc4, 0xc3, 0x07, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x41, 0x41, 0xf3, 0x41, 0x1f, 0x1f, 0x2b, 0x41, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdd, 0x49, 0x41,
+    0x67, 0x67, 0xd5, 0x41, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfd, 0xdb, 0x41, 0x22, 0x22, 0xf4, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x8c, 0x41, 0xf7, 0xf6, 0x8e, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xfb, 0xfa, 0x6a, 0x40, 0x2f, 0x2f, 0xf7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x72, 0x72, 0x62, 0x40,
+    0x5b, 0x5b, 0x93, 0x40, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa9, 0x05, 0x41, 0x76, 0x76, 0xbc, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xee, 0xed, 0x5d, 0x40, 0x37, 0x37, 0xe5, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xba, 0xb9, 0x15, 0x41, 0x4d, 0x4d, 0x69, 0x41, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x7a, 0x41,
+    0xaf, 0xae, 0x3a, 0x41, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xf3, 0x07, 0x41, 0xb2, 0xb1, 0x55, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x15, 0x41, 0xc0, 0xbf, 0x85, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xab, 0xaa, 0x92, 0x40, 0x92, 0x91, 0x93, 0x41, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x76, 0x41,
+    0xca, 0xc9, 0x55, 0x41, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0xeb, 0x41, 0x4d, 0x4d, 0xf3, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x66, 0x40, 0x76, 0x75, 0xd5, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0xc5, 0xc4, 0x9a, 0x41, 0x8d, 0x8c, 0x8a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x52, 0x40,
+    0x0f, 0x0f, 0x4b, 0x41, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdc, 0xd4, 0x40, 0xa8, 0xa7, 0x4b, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x82, 0x41, 0xfc, 0xfb, 0x57, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x37, 0x37, 0xb5, 0x41, 0x37, 0x37, 0x5b, 0x41, 0x00, 0x00, 0x00, 0x00, 0xea, 0xe9, 0x35, 0x41,
+    0xdd, 0xdc, 0xd4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x6a, 0x40, 0x64, 0x64, 0xaa, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x93, 0x41, 0xb8, 0xb7, 0xb5, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xe4, 0xe3, 0x57, 0x41, 0xdb, 0xda, 0x92, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x9b, 0xf3, 0x40,
+    0xfc, 0xfb, 0xe5, 0x41, 0x00, 0x00, 0x00, 0x00, 0xae, 0xad, 0xa3, 0x41, 0x0b, 0x0b, 0xd5, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x06, 0x41, 0x7c, 0x7c, 0xd2, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0xfc, 0xc2, 0x41, 0xe2, 0xe1, 0xc3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0xb4, 0x41,
+    0x94, 0x93, 0x77, 0x41, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0xc4, 0x41, 0xc0, 0xbf, 0xe5, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x85, 0x84, 0x92, 0x41, 0x54, 0x54, 0xda, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x5c, 0x5c, 0xb2, 0x41, 0x74, 0x74, 0xec, 0x40, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xba, 0xd4, 0x41,
+    0xa9, 0xa8, 0xea, 0x41, 0x00, 0x00, 0x00, 0x00, 0x69, 0x69, 0x8b, 0x41, 0x82, 0x82, 0xcc, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x85, 0x41, 0x3f, 0x3f, 0xbd, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x14, 0x41, 0x68, 0x68, 0x92, 0x41, 0x00, 0x00, 0x00, 0x00, 0x99, 0x98, 0x92, 0x41,
+    0x31, 0x31, 0x05, 0x41, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbe, 0xf4, 0x41, 0x57, 0x57, 0x9d, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x94, 0x94, 0xb4, 0x3f, 0x6a, 0x6a, 0x76, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x82, 0x41, 0xc8, 0xc7, 0xd5, 0x41, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcb, 0xf5, 0x41,
+    0x33, 0x33, 0x67, 0x41, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0xc2, 0x41, 0x6f, 0x6f, 0x8d, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x0b, 0x41, 0x8a, 0x89, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x79, 0x79, 0xab, 0x41, 0xbb, 0xba, 0x9c, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xd2, 0x9c, 0x41,
+    0x14, 0x14, 0xaa, 0x41, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0xb4, 0x41, 0xb0, 0xaf, 0x9d, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0x6a, 0x94, 0x41, 0x11, 0x11, 0x25, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x1e, 0x1e, 0x8c, 0x41, 0x96, 0x95, 0x79, 0x41, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9c, 0xea, 0x41,
+    0xd9, 0xd8, 0xf0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x7a, 0x41, 0xd8, 0xd7, 0xb7, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0xde, 0xdd, 0xe3, 0x41, 0x3e, 0x3e, 0xc4, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x3d, 0x3d, 0xcb, 0x41, 0xf6, 0xf5, 0x19, 0x41, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xcd, 0x41,
+    0x4b, 0x4b, 0x85, 0x41, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8e, 0x8c, 0x41, 0x78, 0x77, 0x1b, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x9d, 0x41, 0xda, 0xd9, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x39, 0x41, 0xa5, 0xa4, 0x8a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0xca, 0x40,
+    0x1f, 0x1f, 0x97, 0x40, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xa8, 0xf2, 0x41, 0x2c, 0x2c, 0x5c, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xce, 0xcd, 0xb5, 0x40, 0x8b, 0x8a, 0x94, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x9f, 0x9e, 0x7a, 0x41, 0xa4, 0xa3, 0xbd, 0x41, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x85, 0x41,
+    0xb3, 0xb2, 0x66, 0x41, 0x00, 0x00, 0x00, 0x00, 0x87, 0x86, 0xec, 0x41, 0x41, 0x41, 0x9b, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x19, 0x41, 0x9e, 0x9e, 0xbe, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0xa2, 0xa1, 0x05, 0x41, 0xe7, 0xe6, 0xac, 0x41, 0x00, 0x00, 0x00, 0x00, 0x91, 0x90, 0x64, 0x41,
+    0x82, 0x81, 0x35, 0x41, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb0, 0x82, 0x41, 0x0d, 0x0d, 0xf3, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xd7, 0xd6, 0xc4, 0x41, 0x8b, 0x8a, 0x16, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x25, 0x41, 0xf1, 0xf0, 0x8a, 0x41, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xda, 0xa4, 0x41,
+    0x6b, 0x6b, 0x8d, 0x41, 0x00, 0x00, 0x00, 0x00, 0x64, 0x64, 0x48, 0x41, 0xd3, 0xd2, 0xaa, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0xb7, 0x40, 0xdc, 0xdb, 0x17, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x1a, 0x9c, 0x41, 0x21, 0x21, 0xc3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x89, 0x88, 0x24, 0x41,
+    0xb3, 0xb2, 0x76, 0x41, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x4b, 0x41, 0x6a, 0x6a, 0xa4, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x2a, 0x41, 0x11, 0x11, 0xab, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x82, 0x81, 0xab, 0x41, 0xba, 0xb9, 0x15, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x40,
+    0x66, 0x66, 0x3a, 0x41, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x4f, 0xcd, 0x41, 0xf2, 0xf1, 0xeb, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xae, 0xad, 0x1d, 0x40, 0x2f, 0x2f, 0xd5, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0x44, 0x54, 0x40, 0x73, 0x73, 0x8b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x07, 0x41,
+    0x76, 0x75, 0x59, 0x41, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x85, 0x41, 0x54, 0x54, 0x48, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x74, 0x41, 0xbc, 0xbb, 0xed, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0x44, 0xd2, 0x41, 0xf9, 0xf8, 0xda, 0x41, 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0xc8, 0x3f,
+    0xce, 0xcd, 0x8b, 0x41, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc4, 0xac, 0x40, 0x18, 0x18, 0xb8, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0xa9, 0x40, 0x4a, 0x4a, 0x76, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xb9, 0xb8, 0x9a, 0x41, 0x4f, 0x4f, 0xb5, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd0, 0xa8, 0x40,
+    0x84, 0x83, 0x9d, 0x41, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x77, 0x41, 0xd3, 0xd2, 0x22, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x86, 0x85, 0x55, 0x40, 0x61, 0x61, 0xf3, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x4e, 0x4e, 0xbc, 0x41, 0xbd, 0xbc, 0x94, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0xf2, 0x41,
+    0x47, 0x47, 0x85, 0x41, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xa2, 0x56, 0x41, 0x42, 0x42, 0xf4, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x5d, 0xb3, 0x41, 0x5b, 0x5b, 0x17, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x5a, 0x5a, 0x76, 0x41, 0x38, 0x38, 0x74, 0x41, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x39, 0x41,
+    0x32, 0x32, 0x26, 0x41, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x5c, 0xf2, 0x41, 0x39, 0x39, 0xb3, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0xec, 0x41, 0x0a, 0x0a, 0x8c, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x5d, 0xdb, 0x41, 0x1e, 0x1e, 0xac, 0x41, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc1, 0x55, 0x41,
+    0x5a, 0x5a, 0x76, 0x41, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xdf, 0x2b, 0x41, 0xf5, 0xf4, 0x24, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x86, 0xc4, 0x41, 0x38, 0x38, 0xa2, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xf6, 0xf5, 0x39, 0x41, 0x80, 0x80, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9c, 0xba, 0x41,
+    0x5a, 0x5a, 0x16, 0x41, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbb, 0x8d, 0x41, 0x3d, 0x3d, 0x2d, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x53, 0x53, 0x47, 0x41, 0x09, 0x09, 0x45, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xb1, 0xb0, 0xe2, 0x41, 0xde, 0xdd, 0xbd, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x1a, 0x41,
+    0x07, 0x07, 0x7b, 0x41, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd1, 0xb3, 0x41, 0x7e, 0x7e, 0x84, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0xd4, 0x40, 0x34, 0x34, 0xec, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x43, 0x43, 0x67, 0x41, 0xc0, 0xbf, 0x85, 0x41, 0x00, 0x00, 0x00, 0x00, 0xca, 0xc9, 0xdb, 0x41,
+    0x61, 0x61, 0xc3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x5d, 0x83, 0x41, 0xcc, 0xcb, 0x85, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x8d, 0x8c, 0xda, 0x41, 0x2b, 0x2b, 0x9d, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x5d, 0x69, 0x41, 0x97, 0x96, 0xf4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x20, 0x40,
+    0x0c, 0x0c, 0xca, 0x41, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0xe3, 0x41, 0xcf, 0xce, 0x6a, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x54, 0x41, 0x5f, 0x5f, 0xad, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0xb6, 0xb5, 0x29, 0x41, 0x0b, 0x0b, 0x27, 0x41, 0x00, 0x00, 0x00, 0x00, 0x58, 0x58, 0xd0, 0x40,
+    0xd9, 0xd8, 0x04, 0x41, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa7, 0xad, 0x41, 0x57, 0x57, 0x4b, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xbd, 0xbc, 0x38, 0x41, 0xc8, 0xc7, 0x95, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x06, 0xec, 0x41, 0x52, 0x52, 0xac, 0x41, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xed, 0x41,
+    0xde, 0xdd, 0x93, 0x41, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe3, 0x13, 0x40, 0xf8, 0xf7, 0xaf, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xe8, 0xe7, 0xed, 0x41, 0x7e, 0x7e, 0x2a, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x2c, 0x2c, 0x5c, 0x40, 0x2f, 0x2f, 0xe5, 0x41, 0x00, 0x00, 0x00, 0x00, 0x54, 0x54, 0x18, 0x41,
+    0x5c, 0x5c, 0xca, 0x41, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x2d, 0x40, 0x62, 0x62, 0xdc, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xe6, 0xe5, 0x55, 0x40, 0xc6, 0xc5, 0xf3, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x25, 0xa3, 0x41, 0x93, 0x92, 0xcc, 0x41, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbc, 0x28, 0x41,
+    0x39, 0x39, 0x91, 0x40, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdd, 0xb5, 0x40, 0x84, 0x84, 0x28, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xb8, 0xb7, 0xd5, 0x41, 0x03, 0x03, 0x07, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x77, 0x77, 0xdd, 0x41, 0x14, 0x14, 0xd2, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x41,
+    0x17, 0x17, 0xe5, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+};
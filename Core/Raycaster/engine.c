@@ -14,16 +14,173 @@
 /* DEFINES ------------------------------------------------------------------ */
 #define EPSILON 0.00001f
 #define FOV     60.0f
+#define RAYS_PER_TURN ((int)(360.0f * WIDTH / FOV)) /**< column angles per full turn */
+#define WALLHEIGHT (2.2f * HEIGHT / 2) /**< height of a wall at distance 1 in pixels */
+#define CAMERA_HEIGHT 0.5f /**< eye height above the floor in wall heights */
+#define PLANE_SPAN 16 /**< columns between exact texture coordinates of floor and ceiling */
+#define SHADE_LEVELS   32    /**< number of light levels, 0 is full brightness */
+#define SHADE_DISTANCE 0.75f /**< distance per light level */
+#define SHADE_SIDE     3     /**< extra light levels of walls facing east or west */
+#define SHADE_FOG      COLOR(0, 0, 0) /**< color far away walls and sprites fade to */
+#define PLANE_FLOOR   0
+#define PLANE_CEILING 1
+#define SKY_COLOR   COLOR(10, 169, 216) /**< ceiling without texture */
+#define FLOOR_COLOR COLOR(108, 108, 108) /**< floor without texture */
+#define SECTOR_ROWS (64 * HEIGHT) /**< limit of projected rows of sector walls right in front of the camera */
+
+/* Tables that are built at runtime and only read by the CPU are kept in
+ * the core coupled memory: no wait states, no bus contention with DMA2D
+ * and LTDC. Not initialized at startup. */
+#if defined(__arm__)
+#define R_CCMRAM __attribute__((section(".ccmbss")))
+#else
+#define R_CCMRAM
+#endif
+
+#define DOOR_TIME    1.0f /**< seconds to open or close a door */
+#define DOOR_WAIT    3.0f /**< seconds a door stays open */
+#define USE_DISTANCE 1.0f /**< reach of the use key */
+#define USE_STEPS    4    /**< cells probed within USE_DISTANCE */
+
+#define R_MAX_HITS 4 /**< walls per column: low walls in front of the first full height wall */
+
+#define VIS_SHIFT 8
+#define VIS_SIZE  (1 << VIS_SHIFT) /**< edge length of the visited cell grid, covers maxdist around the player */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** State of a ray walking the cells of the level (DDA), see r_raynext */
+typedef struct
+{
+    float sx, sy;           /**< start */
+    float dx, dy;           /**< end - start */
+    int   stepX, stepY;     /**< cell step: -1, 0 or 1 */
+    float tDeltaX, tDeltaY; /**< travel from one grid line to the next */
+    float tFirstX, tFirstY; /**< travel to the first grid line crossing */
+    float tMaxX, tMaxY;     /**< travel to the next grid line crossing */
+    int   ix, iy;           /**< number of grid line crossings so far */
+    int   x, y;             /**< current cell */
+    float dist;             /**< travel to the current hit */
+    bool  started;          /**< the start cell has been tested */
+} r_ray_t;
+
+/** Wall hit of a ray */
+typedef struct
+{
+    vertex_t hit;     /**< location of wall hit */
+    float    f;       /**< travel along the ray to the hit */
+    float    exit;    /**< travel along the ray to where it leaves the block */
+    float    tex;     /**< texture column of the wall hit, 0..1 */
+    uint8_t  block;   /**< block that is hit */
+    int8_t   eNormal; /**< normal vector of ray hit (east) */
+    int8_t   nNormal; /**< normal vector of ray hit (north) */
+} r_hit_t;
+
+/** Raycast result of a framebuffer column: the walls hit front to back, up
+ *  to the first full height wall */
+typedef struct
+{
+    vertex_t ray;   /**< ray direction */
+    uint8_t  count; /**< number of hits, 0 if the ray left the level */
+    r_hit_t  hits[R_MAX_HITS];
+} r_column_t;
+
+/** Low walls drawn in a framebuffer column, front to back. A sprite or a
+ *  see-through wall behind wall k is only drawn above clip[k]. */
+typedef struct
+{
+    int     count;
+    float   depth[R_MAX_HITS]; /**< camera depth of the wall */
+    int16_t clip[R_MAX_HITS];  /**< first row covered by the wall and all walls in front of it */
+    int     glass;             /**< hits [0, glass) of the column may hold see-through walls to composite */
+} r_occlusion_t;
+
+/** Cells traversed by the rays of the current camera position, in a
+ *  VIS_SIZE x VIS_SIZE window of the level around the player. Sprites in
+ *  cells that no ray reached are behind walls or outside the FOV. */
+typedef struct
+{
+    int x0; /**< first cell of the window (east) */
+    int y0; /**< first cell of the window (north) */
+    uint32_t bits[VIS_SIZE * VIS_SIZE / 32];
+} r_visgrid_t;
+
+/** Camera and raycast results of the last rendered frame */
+typedef struct
+{
+    bool       valid;  /**< camera and columns are valid */
+    bool       redraw; /**< redraw next frame, even if nothing changed */
+    vertex_t   player_pos;
+    int        yaw;    /**< view direction in column angles */
+    const uint8_t* level;
+    uint32_t   revision; /**< level revision, see level_t */
+    const sector_map_t* sectors; /**< sector world of the frame, columns are not used for it */
+    uint32_t   tick;     /**< game tick, selects the frames of animated textures */
+    uint32_t   expires;  /**< ticks after tick until an animated texture on screen shows the next frame */
+    r_column_t column[WIDTH];
+    r_visgrid_t vis; /**< cells traversed by the rays in column */
+} r_framecache_t;
+
+/** Sprite projected on screen, see r_drawsprites */
+typedef struct
+{
+    float depth;  /**< distance along the view direction */
+    float x_left; /**< left edge on screen in columns */
+    float width;  /**< width on screen in columns */
+    const texture_t* t;
+} r_sprite_t;
+
+/** Light level tables for the texel format of the atlas. Level k blends
+ *  k/SHADE_LEVELS of SHADE_FOG into the texel colors, so shading costs a
+ *  table lookup per pixel instead of float math. */
+typedef struct
+{
+    bool valid;
+    int format;              /**< atlas format the tables are built for */
+    const uint32_t* palette; /**< atlas palette the tables are built for */
+    union
+    {
+        uint32_t palette[SHADE_LEVELS][PALETTE_SIZE]; /**< TEXTURE_I8, TEXTURE_L8: shaded colors */
+        uint8_t  ramp[SHADE_LEVELS][3][256];          /**< TEXTURE_ARGB8888, TEXTURE_RGB565: shaded red, green, blue */
+    } lut;
+} r_shade_t;
+
+/** Screen space tables of the projection, so that row dependent effects
+ *  (floor and ceiling casting, fog) need no division per row or pixel.
+ *  Row r of a plane is screen row HEIGHT/2 + r (floor) or HEIGHT/2 - 1 - r
+ *  (ceiling). */
+typedef struct
+{
+    float   coltan[WIDTH + 1];        /**< tan of the angle between ray of column x and view direction */
+    float   dist[2][HEIGHT / 2];      /**< distance of the pixel centers of row r of PLANE_FLOOR/PLANE_CEILING */
+    float   recip[2][HEIGHT / 2];     /**< 1 / dist */
+    uint8_t light[2][HEIGHT / 2];     /**< light level at dist */
+} r_tables_t;
 
 /* LOCAL DATA --------------------------------------------------------------- */
+atlas_t g_atlas = { 0 };
 texture_t g_textures[MAX_TEXTURES] = { 0 };
 texture_t g_sprites[MAX_SPRITES] = { 0 };
+static r_framecache_t g_frame;
+static r_sprite_t g_visible[MAX_ENTITIES]; /**< sprites in front of the camera */
+static r_occlusion_t g_occlusion[WIDTH]; /**< low walls of the current frame */
+static r_blend_t g_blend; /**< blends see-through walls, NULL: r_blend */
+static r_clock_t g_clock; /**< times the zones of r_render, NULL: not timed */
+static r_stats_t g_stats; /**< of the last r_render call */
+static int g_zone; /**< R_ZONE_ that is running */
+static uint32_t g_zonestart; /**< g_clock at the start of g_zone */
+static uint32_t g_glass[2][HEIGHT]; /**< see-through wall columns for g_blend, alternating. Not in CCMRAM, the DMA2D reads them */
+static int g_glassbuf; /**< next g_glass buffer */
+static r_shade_t g_shade;
+static bool g_tables_valid; /**< g_tables is initialized */
+static r_tables_t g_tables R_CCMRAM;
 
 /* FUNCTION PROTOTYPES ------------------------------------------------------ */
 
 // Game
-static void g_move(vertex_t* pos_current, const vertex_t* dx,
-    const uint8_t* map, const int map_width, const int map_height);
+static void g_move(vertex_t* pos_current, const vertex_t* dx, const level_t* level);
+static void g_use(gamestate_t* game);
+static void g_doors(gamestate_t* game, float dt_sec);
 
 // Math
 static void m_rotateVertex(vertex_t* v, const float angleRad);
@@ -31,14 +188,57 @@ static void m_normalize(vertex_t* v);
 static bool m_rayPlaneIntersection(const vertex_t* planeNormal, float planeD, const vertex_t* rayStart, const vertex_t* rayDir, float* f);
 
 // Render functions
-static void r_drawBackground(uint32_t* fb);
-static void r_drawcolumn(uint8_t* framebuf, const texture_t* t, int x, int y_high, int y_low, float tex_column, bool transparency);
-void r_drawsprite(uint32_t* fb, const float zbuffer[WIDTH], const texture_t* t,
-    vertex_t player_pos, vertex_t player_dir, vertex_t sprite_pos);
-static uint8_t r_raycast(const uint8_t* map, const int width, const int height,
-    float fStartX, float fStartY, float fEndX, float fEndY,
-    float* xHit, float* yHit, int* xBlock, int* yBlock,
-    int* xNormal, int* yNormal, float* f);
+static inline void r_zone(int zone);
+static void r_drawBackground(uint32_t* fb, bool ceiling, bool floor);
+static void r_drawplanes(uint32_t* fb, const gamestate_t* game, vertex_t view,
+    const int16_t y_top[WIDTH], const int16_t y_bottom[WIDTH]);
+static void r_drawplanerow(uint32_t* fb, const texture_t* t, int plane, int row,
+    vertex_t pos, vertex_t view, const int16_t clip[WIDTH]);
+static const texture_t* r_planetexture(int index);
+static inline int r_planetexel(int32_t u, int32_t v, uint32_t umask, uint32_t vmask, int stride);
+static void r_tablesinit(void);
+static int r_miplevel(const texture_t* t, int ylen);
+static inline int r_frame(const texture_t* t);
+static const unsigned char* r_texcolumn(const texture_t* t, int level, int tx);
+static void r_drawcolumn(uint32_t* fb, const texture_t* t, int x, int y_high, int y_low, int first, int last,
+                         float tex_column, bool transparency, int light);
+static void r_drawspans(uint32_t* fb, const texture_t* t, int x, int y_high, int y_low, int first, int last,
+                        float tex_column, int light);
+static void r_drawplanecolumn(uint32_t* fb, const texture_t* t, int x, int first, int last,
+    vertex_t pos, vertex_t ray, float cosangle, float height);
+static inline uint32_t r_shadetexel(const unsigned char* texels, int index, int light);
+static void r_drawtexels(uint32_t* fb, const unsigned char* column, int x, int first, int last,
+                         int32_t ty, int32_t ty_stride, bool transparency, int light);
+static void r_shadeinit(void);
+static inline uint32_t r_fog(uint32_t c, uint32_t fog, int level);
+static inline int r_light(float dist, int side);
+static void r_drawsprites(uint32_t* fb, const float zbuffer[WIDTH], const gamestate_t* game,
+    const r_visgrid_t* vis, vertex_t view, float colangle);
+static int r_spritecmp(const void* a, const void* b);
+static int r_occlusionclip(int x, float depth);
+static bool r_drawglass(uint32_t* fb, int x, const gamestate_t* game, vertex_t view, float min_depth);
+static void r_glasscolumn(uint32_t* buf, const texture_t* t, int y_high, int y_low, int first, int last,
+                          float tex_column, int alpha, int light);
+static void r_blend(uint32_t* dst, int stride, const uint32_t* src, int count);
+static void r_drawsectors(uint32_t* fb, const gamestate_t* game, int yaw, vertex_t view, float zbuffer[WIDTH]);
+static void r_sectorwall(uint32_t* fb, int texture, int x, float bottom, float top, int first, int last,
+    float eye, float scale, float tex_column, int light);
+static void r_sectorflat(uint32_t* fb, int texture, int x, int first, int last,
+    vertex_t pos, vertex_t ray, float cosangle, float height);
+static inline int r_sectorrow(float height, float eye, float scale);
+static void r_castcolumn(const level_t* level, vertex_t start, vertex_t end, r_column_t* col, r_visgrid_t* vis);
+static void r_rayinit(r_ray_t* ray, float fStartX, float fStartY, float fEndX, float fEndY);
+static uint8_t r_raynext(const level_t* level, r_ray_t* ray, r_hit_t* hit, r_visgrid_t* vis);
+static bool r_planehit(const level_t* level, uint8_t b, int x, int y,
+    float fStartX, float fStartY, float dx, float dy, float t0, float t1,
+    float* t, float* u, int* nx, int* ny);
+static inline void r_visit(r_visgrid_t* vis, int x, int y);
+static inline bool r_visited(const r_visgrid_t* vis, int x, int y);
+#ifndef DISTANCE_FIELD_DISABLED
+static int r_crossings(float tFirst, float tDelta, float invDelta,
+    int k0, int n, float limit, bool strict);
+static void r_emptyblock(const level_t* level, int x, int y, int stepX, int stepY, int* rx, int* ry);
+#endif
 
 /* FUNCTION BODIES ---------------------------------------------------------- */
 void g_update(const float dt_sec, const uint8_t* kb, gamestate_t* game)
@@ -46,102 +246,487 @@ void g_update(const float dt_sec, const uint8_t* kb, gamestate_t* game)
     const float f = 1.0f * kb[SDL_SCANCODE_W] - 1.0f * kb[SDL_SCANCODE_S];
     vertex_t dx = { .n = game->player_dir.n * 1.250f * f * dt_sec,
                     .e = game->player_dir.e * 1.250f * f * dt_sec };
-    g_move(&game->player_pos, &dx, game->level, game->level_width, game->level_height);
+    if (game->sectors)
+    {
+        game->sector = sec_move(game->sectors, game->sector, &game->player_pos.e, &game->player_pos.n, dx.e, dx.n);
+    }
+    else
+    {
+        g_move(&game->player_pos, &dx, &game->level);
+        lvl_stream(&game->level, game->player_pos.e, game->player_pos.n);
+    }
 
     const float dir = -1.0f * (kb[SDL_SCANCODE_A]!=0) + 1.0f * (kb[SDL_SCANCODE_D]!=0);
-    const float da = 45.0f * dir * M_PI_F / 180.0f * dt_sec;
-    m_normalize(&game->player_dir);
-    m_rotateVertex(&game->player_dir, da);
+    g_turn(game, 45.0f * dir * M_PI_F / 180.0f * dt_sec);
+
+    if (kb[SDL_SCANCODE_SPACE])
+    {
+        g_use(game);
+    }
+    g_doors(game, dt_sec);
+    game->tick += (uint32_t)lroundf(dt_sec * 1000.0f);
+}
+
+/** Turn the player by angle (radians, positive to the right like the D
+ *  key), e.g. by the angle a gyroscope measured */
+void g_turn(gamestate_t* game, float angle)
+{
+    if (angle != 0.0f) // keep player_dir bit-exact while standing still
+    {
+        m_normalize(&game->player_dir);
+        m_rotateVertex(&game->player_dir, angle);
+    }
+}
+
+/** Force the next r_render call to draw a frame */
+void r_invalidate(void)
+{
+    g_frame.redraw = true;
+}
+
+/** Set the function that blends see-through walls into the framebuffer,
+ *  e.g. with the DMA2D. NULL selects the software blend. */
+void r_setblend(r_blend_t blend)
+{
+    g_blend = blend;
+}
+
+/** Set the clock that times the zones of r_render (r_stats_t.cycles),
+ *  NULL (default) leaves the zones untimed */
+void r_setclock(r_clock_t clock)
+{
+    g_clock = clock;
 }
 
-void r_render(uint32_t* fb, const gamestate_t* game)
+/** Statistics of the last r_render call */
+const r_stats_t* r_stats(void)
 {
-    r_drawBackground(fb);
+    return &g_stats;
+}
+
+/** Render the scene into fb.
+ *  The view direction is snapped to a multiple of the angle between two
+ *  columns, so turning shifts the raycast results of the last frame by whole
+ *  columns and only the newly exposed columns are raycast.
+ *  Returns false and leaves fb untouched if the camera did not change since
+ *  the last frame (the last frame can be presented again). If only the
+ *  player position changed, the ray directions of the last frame are reused;
+ *  if nothing changed, but a redraw was requested or an animated texture on
+ *  screen shows the next frame, all raycast results are reused.
+ *  A sector world (game->sectors) is drawn by r_drawsectors instead. */
+bool r_render(uint32_t* fb, const gamestate_t* game)
+{
+    memset(&g_stats, 0, sizeof(g_stats));
+    g_zone = R_ZONE_SETUP;
+    g_zonestart = g_clock ? g_clock() : 0;
+
+    const float colangle = FOV / WIDTH * M_PI_F / 180.0f;
+    int yaw = (int)lroundf(atan2f(game->player_dir.e, game->player_dir.n) / colangle);
+    yaw = (yaw % RAYS_PER_TURN + RAYS_PER_TURN) % RAYS_PER_TURN;
+    int shift = yaw - g_frame.yaw; // columns to shift to the left
+    if (shift >= RAYS_PER_TURN / 2) { shift -= RAYS_PER_TURN; }
+    if (shift < -RAYS_PER_TURN / 2) { shift += RAYS_PER_TURN; }
+    if (game->sectors != g_frame.sectors)
+    {
+        g_frame.valid = false; // the rays of the last frame are for the other world
+    }
+
+    const bool pos_changed = !g_frame.valid || game->level.cells != g_frame.level ||
+        game->level.revision != g_frame.revision ||
+        game->player_pos.n != g_frame.player_pos.n || game->player_pos.e != g_frame.player_pos.e;
+
+    if (g_frame.valid && shift == 0 && !pos_changed && !g_frame.redraw &&
+        game->tick - g_frame.tick < g_frame.expires) // relative, so the tick can wrap around
+    {
+        r_zone(R_ZONE_SETUP);
+        return false;
+    }
+    g_stats.drawn = true;
+    const bool reuse = g_frame.valid; // the columns of the last frame can be reused
+
+    g_frame.valid = true;
+    g_frame.redraw = false;
+    g_frame.player_pos = game->player_pos;
+    g_frame.yaw = yaw;
+    g_frame.level = game->level.cells;
+    g_frame.revision = game->level.revision;
+    g_frame.sectors = game->sectors;
+    g_frame.tick = game->tick;
+    g_frame.expires = UINT32_MAX; // lowered by r_frame for every animated texture drawn
+
+    const vertex_t view = { .n = cosf(yaw * colangle), .e = sinf(yaw * colangle) };
+
+    if (!g_shade.valid || g_shade.format != g_atlas.format || g_shade.palette != g_atlas.palette)
+    {
+        r_shadeinit();
+    }
+    if (!g_tables_valid)
+    {
+        r_tablesinit();
+    }
+    if (game->sectors)
+    {
+        r_zone(R_ZONE_WALLS);
+        float zbuffer[WIDTH];
+        r_drawsectors(fb, game, yaw, view, zbuffer);
+        g_stats.rays = WIDTH;
+
+        // no cells to cull the sprites by, the zbuffer and g_occlusion hide them
+        r_visgrid_t* vis = &g_frame.vis;
+        memset(vis->bits, 0xff, sizeof(vis->bits));
+        r_zone(R_ZONE_SPRITES);
+        r_drawsprites(fb, zbuffer, game, vis, view, colangle);
+        r_zone(R_ZONE_SPRITES);
+        return true;
+    }
+
+    /* reuse rays (and hits, if the position is unchanged) of the last frame,
+     * columns first..last-1 need new rays */
+    r_column_t* columns = g_frame.column;
+    int first = 0, last = WIDTH;
+    if (reuse && shift == 0)
+    {
+        first = last = 0;
+    }
+    else if (reuse && shift > 0 && shift < WIDTH)
+    {
+        memmove(&columns[0], &columns[shift], (WIDTH - shift) * sizeof(r_column_t));
+        first = WIDTH - shift;
+    }
+    else if (reuse && shift < 0 && shift > -WIDTH)
+    {
+        memmove(&columns[-shift], &columns[0], (WIDTH + shift) * sizeof(r_column_t));
+        last = -shift;
+    }
+
+    /* the visited cells accumulate while the position does not change, as
+     * only the rays of newly exposed columns are cast */
+    r_visgrid_t* vis = &g_frame.vis;
+    if (pos_changed)
+    {
+        vis->x0 = (int)floorf(game->player_pos.e) - VIS_SIZE / 2;
+        vis->y0 = (int)floorf(game->player_pos.n) - VIS_SIZE / 2;
+        memset(vis->bits, 0, sizeof(vis->bits));
+        r_visit(vis, (int)floorf(game->player_pos.e), (int)floorf(game->player_pos.n));
+    }
+
+    r_drawBackground(fb, !r_planetexture(game->level.ceiling_texture), !r_planetexture(game->level.floor_texture));
 
-    const float WALLHEIGHT = 2.2f * HEIGHT/2;
     const float maxdist = 100.0f;
-    vertex_t ray;
     vertex_t target; // max. raycast location
-    vertex_t hit; // location of block the ray hits
-    int column = 0;
-    int eNormal, nNormal; // normal vector of ray hit (east/north)
     float zbuffer[WIDTH];
+    int16_t y_top[WIDTH];    // first wall row, the rows above show the ceiling
+    int16_t y_bottom[WIDTH]; // first floor row below the wall
+
+    const texture_t* floor = r_planetexture(game->level.floor_texture);
+    r_zone(R_ZONE_WALLS);
 
     /* for each column in framebuffer (e.g. 320 columns) cast a ray: */
-    for (float angle = -FOV / 2; angle < FOV / 2; angle += (FOV / WIDTH), column++)
+    for (int column = 0; column < WIDTH; column++)
     {
-        ray = game->player_dir;
-        m_rotateVertex(&ray, angle*M_PI_F/180.0f);
-        target.n = game->player_pos.n + ray.n * maxdist;
-        target.e = game->player_pos.e + ray.e * maxdist;
+        r_column_t* col = &columns[column];
+        const bool newray = (column >= first && column < last);
+        if (newray)
+        {
+            const float angle = (yaw - WIDTH / 2 + column) * colangle;
+            col->ray.n = cosf(angle);
+            col->ray.e = sinf(angle);
+        }
+        if (newray || pos_changed)
+        {
+            target.n = game->player_pos.n + col->ray.n * maxdist;
+            target.e = game->player_pos.e + col->ray.e * maxdist;
+            r_castcolumn(&game->level, game->player_pos, target, col, vis);
+            g_stats.rays++;
+        }
 
-        // return: block and hit (location of block hit)
-        const uint8_t block =
-            r_raycast(game->level, game->level_width, game->level_height,
-                game->player_pos.e, game->player_pos.n, target.e, target.n,
-                &hit.e, &hit.n, NULL, NULL, &eNormal, &nNormal, NULL);
+        /* draw the walls front to back, the rows from clip down are drawn:
+         * a wall behind a low wall is only visible above it */
+        r_occlusion_t* occlusion = &g_occlusion[column];
+        const float cosangle = col->ray.n * view.n + col->ray.e * view.e;
+        int clip = HEIGHT;
+        bool closed = false; // a full height wall ends the column
+        bool front = true; // no wall drawn yet
+        occlusion->count = 0;
+        occlusion->glass = col->count;
+        zbuffer[column] = INFINITY;
+        y_bottom[column] = HEIGHT / 2;
 
-        if (block == 0)
+        for (int i = 0; i < col->count && clip > 0; i++)
         {
-            zbuffer[column] = INFINITY;
-            continue;
+            const r_hit_t* h = &col->hits[i];
+            const uint8_t block = h->block;
+            const vertex_t hit = h->hit;
+            const float wall = lvl_height(&game->level, block);
+            if (lvl_alpha(&game->level, block) != 0)
+                continue; // see-through walls are composited after the sprites behind them
+
+            // direction vector from player to hit location
+            vertex_t dx = { .n = hit.n - game->player_pos.n, .e = hit.e - game->player_pos.e };
+            // distance to block (dot product):
+            const float dist = dx.n * view.n + dx.e * view.e;
+            if (WALLHEIGHT / dist > 50 * WALLHEIGHT && wall < CAMERA_HEIGHT)
+                continue; // low wall below the camera, all of it is below the screen
+            // right in front of a wall it covers the screen, the limit keeps its rows in int range
+            const float height = fminf(WALLHEIGHT / dist, 50 * WALLHEIGHT);
+
+            // a full wall spans y_hi .. y_lo, the wall is visible from y_wall
+            int y_hi = HEIGHT / 2 - (int)(height * (1.0f - CAMERA_HEIGHT));
+            int y_lo = HEIGHT / 2 + (int)(height * CAMERA_HEIGHT);
+            const int y_wall = wall < 1.0f ? HEIGHT / 2 + (int)(height * (CAMERA_HEIGHT - wall)) : y_hi;
+            if (front)
+            {
+                y_bottom[column] = (int16_t)r_min(y_lo, HEIGHT);
+                front = false;
+            }
+            else if (floor && y_lo < clip)
+            {
+                r_drawplanecolumn(fb, floor, column, y_lo, clip, game->player_pos, col->ray, cosangle, 0.0f);
+            }
+
+#ifdef TEXTURES_DISABLED
+            const uint32_t blockmap[] = { COLOR(0,0,0), COLOR(255, 0, 0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0) };
+            y_hi = r_clamp(y_wall, 0, HEIGHT);
+            y_lo = r_clamp(y_lo, 0, clip);
+            for (int y = y_hi; y < y_lo; y++) // draw pixels from y_hi down to y_lo
+            {
+                fb[y * WIDTH + column] = blockmap[block & 7];
+            }
+#else
+            const texture_t* t = &g_textures[lvl_texture(&game->level, block)];
+            const int light = r_light(dist, h->eNormal != 0 ? SHADE_SIDE : 0);
+            r_drawcolumn(fb, t, column, y_hi, y_lo, y_wall, clip, h->tex, false, light);
+#endif
+            g_stats.walls++;
+            clip = r_min(clip, y_wall);
+
+            if (wall >= 1.0f)
+            {
+                zbuffer[column] = dist;
+                closed = true;
+                break;
+            }
+
+            // top of a low wall below the camera, up to where the ray leaves the block
+            const level_block_t* b = lvl_block(&game->level, block);
+            const texture_t* cap = r_planetexture(lvl_texture(&game->level, block));
+            if (wall < CAMERA_HEIGHT && cap && (!b || b->type == LEVEL_BLOCK_SOLID) && h->f > 0.0f)
+            {
+                const float exit = dist * h->exit / h->f;
+                const int y_cap = HEIGHT / 2 + (int)(WALLHEIGHT / exit * (CAMERA_HEIGHT - wall));
+                if (y_cap < clip)
+                {
+                    r_drawplanecolumn(fb, cap, column, y_cap, clip, game->player_pos, col->ray, cosangle, wall);
+                    clip = y_cap;
+                }
+            }
+            occlusion->depth[occlusion->count] = dist;
+            occlusion->clip[occlusion->count] = (int16_t)clip;
+            occlusion->count++;
         }
 
-        // direction vector from player to hit location
-        vertex_t dx = { .n = hit.n - game->player_pos.n, .e = hit.e - game->player_pos.e };
-        // distance to block (dot product):
-        const float dist = dx.n * game->player_dir.n + dx.e * game->player_dir.e;
-        zbuffer[column] = dist;
-        const float height = WALLHEIGHT / dist;
-        if (height > 50 * WALLHEIGHT)
-            continue;
+        // the floor behind the last low wall reaches up to the horizon
+        if (!closed && !front && floor && clip > HEIGHT / 2)
+        {
+            r_drawplanecolumn(fb, floor, column, HEIGHT / 2, clip, game->player_pos, col->ray, cosangle, 0.0f);
+        }
+        y_top[column] = (int16_t)r_clamp(clip, 0, HEIGHT / 2);
+    }
+
+    r_zone(R_ZONE_PLANES);
+    r_drawplanes(fb, game, view, y_top, y_bottom);
+    r_zone(R_ZONE_SPRITES);
+    r_drawsprites(fb, zbuffer, game, vis, view, colangle);
+
+    // the see-through walls in front of all sprites
+    r_zone(R_ZONE_GLASS);
+    const r_blend_t blend = g_blend ? g_blend : r_blend;
+    for (int x = 0; x < WIDTH; x++)
+    {
+        r_drawglass(fb, x, game, view, 0.0f);
+    }
+    blend(NULL, 0, NULL, 0);
+    r_zone(R_ZONE_GLASS);
+    return true;
+}
+
+/** Charge the clock ticks since the last call to the running zone of
+ *  r_render, then continue with zone */
+static inline void r_zone(int zone)
+{
+    if (g_clock)
+    {
+        const uint32_t now = g_clock();
+        g_stats.cycles[g_zone] += now - g_zonestart;
+        g_zonestart = now;
+    }
+    g_zone = zone;
+}
 
-        int y_hi = HEIGHT / 2 - (int)(height / 2);
-        int y_lo = HEIGHT / 2 + (int)(height / 2);
+/** Draw a sector world: each column walks the sectors along its ray front
+ *  to back, through the portal the ray leaves each sector by. Rows
+ *  [top, bottom) of the column are still open; the ceiling and floor of a
+ *  sector and the steps of a portal to a lower ceiling or a higher floor
+ *  close them from the top and bottom, a solid wall closes the rest. So
+ *  every pixel is drawn once and only the sectors a ray reaches cost time.
+ *  The depth of the solid wall goes to zbuffer, the steps up to a higher
+ *  floor to g_occlusion, so r_drawsprites can hide the sprites behind them. */
+static void r_drawsectors(uint32_t* fb, const gamestate_t* game, int yaw, vertex_t view, float zbuffer[WIDTH])
+{
+    const float colangle = FOV / WIDTH * M_PI_F / 180.0f;
+    const sector_map_t* map = game->sectors;
+    const vertex_t pos = game->player_pos;
+    const float eye = map->sectors[game->sector].floor + CAMERA_HEIGHT;
+
+    for (int x = 0; x < WIDTH; x++)
+    {
+        const float angle = (yaw - WIDTH / 2 + x) * colangle;
+        const vertex_t ray = { .n = cosf(angle), .e = sinf(angle) };
+        const float cosangle = ray.n * view.n + ray.e * view.e;
+        int top = 0, bottom = HEIGHT; // open rows
+        int sector = game->sector;
+        r_occlusion_t* occlusion = &g_occlusion[x];
+        occlusion->count = 0;
+        occlusion->glass = 0; // no see-through walls, g_frame.column is not used
+        zbuffer[x] = INFINITY;
+
+        for (int depth = 0; depth < SECTOR_MAX_DEPTH && top < bottom; depth++)
+        {
+            const sector_t* s = &map->sectors[sector];
+            float t;
+            const int exit = sec_exit(map, sector, pos.e, pos.n, ray.e, ray.n, &t);
+            if (exit < 0)
+                break;
+            const sector_wall_t* w = &map->walls[exit];
+            const float dist = r_max(t * cosangle, EPSILON);
+            const float scale = WALLHEIGHT / dist;
+            const int y_ceiling = r_clamp(r_sectorrow(s->ceiling, eye, scale), top, bottom);
+            const int y_floor = r_clamp(r_sectorrow(s->floor, eye, scale), y_ceiling, bottom);
+            r_sectorflat(fb, s->ceiling_texture, x, top, y_ceiling, pos, ray, cosangle, s->ceiling - eye + CAMERA_HEIGHT);
+            r_sectorflat(fb, s->floor_texture, x, y_floor, bottom, pos, ray, cosangle, s->floor - eye + CAMERA_HEIGHT);
+
+            // texture column: world units along the wall from v0, walls facing east or west are darker
+            const sector_vertex_t* p0 = &map->vertices[w->v0];
+            const sector_vertex_t* p1 = &map->vertices[w->v1];
+            const float de = pos.e + ray.e * t - p0->e, dn = pos.n + ray.n * t - p0->n;
+            const float u = sqrtf(de * de + dn * dn);
+            const float tex = r_clamp(u - floorf(u), 0.0f, 1.0f);
+            const bool side = fabsf(p1->n - p0->n) > fabsf(p1->e - p0->e);
+            const int light = r_light(dist, side ? SHADE_SIDE : 0);
+
+            if (w->portal == SECTOR_NONE)
+            {
+                r_sectorwall(fb, w->texture, x, s->floor, s->ceiling, y_ceiling, y_floor, eye, scale, tex, light);
+                zbuffer[x] = dist;
+                top = bottom;
+                break;
+            }
+            const sector_t* next = &map->sectors[w->portal];
+            top = y_ceiling;
+            bottom = y_floor;
+            if (next->ceiling < s->ceiling)
+            {
+                const int y = r_clamp(r_sectorrow(next->ceiling, eye, scale), top, bottom);
+                r_sectorwall(fb, w->texture, x, next->ceiling, s->ceiling, top, y, eye, scale, tex, light);
+                top = y;
+            }
+            if (next->floor > s->floor)
+            {
+                const int y = r_clamp(r_sectorrow(next->floor, eye, scale), top, bottom);
+                r_sectorwall(fb, w->texture, x, s->floor, next->floor, y, bottom, eye, scale, tex, light);
+                bottom = y;
+                if (occlusion->count < R_MAX_HITS)
+                {
+                    occlusion->depth[occlusion->count] = dist;
+                    occlusion->clip[occlusion->count] = (int16_t)bottom;
+                    occlusion->count++;
+                }
+            }
+            sector = w->portal;
+        }
+
+        // the ray left the world or reached SECTOR_MAX_DEPTH: nothing closed the open rows
+        for (int y = top; y < bottom; y++)
+        {
+            fb[y * WIDTH + x] = y < HEIGHT / 2 ? SKY_COLOR : FLOOR_COLOR;
+        }
+    }
+}
 
+/** Draw the part of a sector wall from height bottom to top that is in rows
+ *  [first, last) of column x. The texture repeats every wall height, like
+ *  the walls of the grid. */
+static void r_sectorwall(uint32_t* fb, int texture, int x, float bottom, float top, int first, int last,
+    float eye, float scale, float tex_column, int light)
+{
+    for (float k = floorf(bottom); k < top && first < last; k += 1.0f)
+    {
+        const int y_high = r_sectorrow(k + 1.0f, eye, scale);
+        const int y_low = r_sectorrow(k, eye, scale);
+        const int y_first = r_max(first, r_sectorrow(r_min(k + 1.0f, top), eye, scale));
+        const int y_last = r_min(last, r_sectorrow(r_max(k, bottom), eye, scale));
+        if (y_low <= y_high || y_first >= y_last)
+            continue;
 #ifdef TEXTURES_DISABLED
-        const uint32_t blockmap[] = { COLOR(0,0,0), COLOR(255, 0, 0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0), COLOR(0,255,0) };
-        y_hi = r_clamp(y_hi, 0, HEIGHT);
-        y_lo = r_clamp(y_lo, 0, HEIGHT);
-        for (int y = y_hi; y < y_lo; y++) // draw pixels from y_hi down to y_lo
+        (void)texture;
+        (void)tex_column;
+        (void)light;
+        for (int y = y_first; y < y_last; y++)
         {
-            fb[y * WIDTH + column] = blockmap[block];
+            fb[y * WIDTH + x] = COLOR(0, 255, 0);
         }
 #else
-        const float tex_column = eNormal != 0 ? hit.n-floorf(hit.n) : hit.e-floorf(hit.e);
-        const texture_t* t = &g_textures[block];
-        r_drawcolumn((uint8_t*)fb, t, column, y_hi, y_lo, tex_column, false);
+        r_drawcolumn(fb, &g_textures[texture], x, y_high, y_low, y_first, y_last, tex_column, false, light);
 #endif
+        g_stats.walls++;
+    }
+}
+
+/** Draw rows [first, last) of column x of a sector floor or ceiling at
+ *  height (relative to the floor of the camera, see r_drawplanecolumn) */
+static void r_sectorflat(uint32_t* fb, int texture, int x, int first, int last,
+    vertex_t pos, vertex_t ray, float cosangle, float height)
+{
+    const texture_t* t = r_planetexture(texture);
+    if (t)
+    {
+        r_drawplanecolumn(fb, t, x, first, last, pos, ray, cosangle, height);
+        return;
+    }
+    const uint32_t color = height < CAMERA_HEIGHT ? FLOOR_COLOR : SKY_COLOR;
+    for (int y = r_max(first, 0); y < r_min(last, HEIGHT); y++)
+    {
+        fb[y * WIDTH + x] = color;
     }
+}
 
-    // vertex_t sprite_pos = { .n = 5.0f, .e = 2.0f };
-    // r_drawsprite(fb, zbuffer, &g_sprites[0], game->player_pos, game->player_dir, sprite_pos);
-    (void)zbuffer;
+/** Screen row of a point at height in front of the camera, scale is
+ *  WALLHEIGHT / depth */
+static inline int r_sectorrow(float height, float eye, float scale)
+{
+    return HEIGHT / 2 - (int)r_clamp((height - eye) * scale, (float)-SECTOR_ROWS, (float)SECTOR_ROWS);
 }
 
 
-static void g_move(vertex_t* pos_current, const vertex_t* dx,
-    const uint8_t* map, const int map_width, const int map_height)
+static void g_move(vertex_t* pos_current, const vertex_t* dx, const level_t* level)
 {
-    uint8_t b; // block that is being hit (if any)
-    int xBlock, yBlock; // coordinates of block that is hit
-    int eNormal, nNormal; // normal (if block is hit)
-    float xHit, yHit; // exact position where wall is hit
-    float f; // fraction of travel along ray (1.0f = full distance of dx)
+    r_ray_t ray;
+    r_hit_t hit; // first block hit (if any), low walls block movement as well
     vertex_t n; // wall normal
 
     if (dx->e == 0.0f && dx->n == 0.0f) { return; }
-    b = r_raycast(map, map_width, map_height,
-              pos_current->e, pos_current->n, pos_current->e + dx->e, pos_current->n + dx->n,
-              &xHit, &yHit, &xBlock, &yBlock, &eNormal, &nNormal, &f);
-    if (b == 0 || f > 1.0f) // nothing hit, perform full movement
+    r_rayinit(&ray, pos_current->e, pos_current->n, pos_current->e + dx->e, pos_current->n + dx->n);
+    if (r_raynext(level, &ray, &hit, NULL) == 0 || hit.f > 1.0f) // nothing hit, perform full movement
     {
         pos_current->e += dx->e;
         pos_current->n += dx->n;
         return;
     }
-    n.e = (float)eNormal;
-    n.n = (float)nNormal;
+    n.e = (float)hit.eNormal;
+    n.n = (float)hit.nNormal;
+    const float xHit = hit.hit.e;
+    const float yHit = hit.hit.n;
+    float f = hit.f; // fraction of travel along ray (1.0f = full distance of dx)
 
     const float PLANE_OFFSET = 0.050f;
     float plane_d = -(n.e * xHit + n.n * yHit) - PLANE_OFFSET;
@@ -159,6 +744,75 @@ static void g_move(vertex_t* pos_current, const vertex_t* dx,
     pos_current->n += q.n;
 }
 
+/** Open the closest door within USE_DISTANCE in front of the player */
+static void g_use(gamestate_t* game)
+{
+    level_t* level = &game->level;
+    const vertex_t* pos = &game->player_pos;
+
+    for (int i = 1; i <= USE_STEPS; i++)
+    {
+        const float d = USE_DISTANCE * i / USE_STEPS;
+        const int x = (int)floorf(pos->e + game->player_dir.e * d);
+        const int y = (int)floorf(pos->n + game->player_dir.n * d);
+        if (x < 0 || x >= level->width || y < 0 || y >= level->height)
+            return;
+        const uint8_t b = lvl_cell(level, x, y);
+        if (b == 0)
+            continue;
+        const level_block_t* block = lvl_block(level, b);
+        if (block && block->type == LEVEL_BLOCK_DOOR)
+        {
+            level->door_move[b] = 1;
+        }
+        if (!block || block->type != LEVEL_BLOCK_THIN)
+            return; // no reach through walls and doors
+    }
+}
+
+/** Slide the moving doors. A door that is fully open closes again after
+ *  DOOR_WAIT seconds, unless the player stands in its cell. Every change
+ *  of a door bumps the level revision, so the renderer casts new rays. */
+static void g_doors(gamestate_t* game, float dt_sec)
+{
+    level_t* level = &game->level;
+    const int x = (int)floorf(game->player_pos.e);
+    const int y = (int)floorf(game->player_pos.n);
+    const bool inside = x >= 0 && x < level->width && y >= 0 && y < level->height;
+    const uint8_t occupied = inside ? lvl_cell(level, x, y) : 0; // door the player stands in
+    const int step = r_max(1, (int)(LEVEL_DOOR_OPEN * dt_sec / DOOR_TIME));
+
+    for (int b = 1; b < level->block_count; b++)
+    {
+        if (level->door_move[b] == 0)
+            continue;
+        if (level->door_move[b] < 0 && b == occupied)
+            level->door_move[b] = 1; // don't close on the player
+
+        const int open = r_clamp(level->door_open[b] + level->door_move[b] * step, 0, LEVEL_DOOR_OPEN);
+        if (open != level->door_open[b])
+        {
+            level->door_open[b] = (uint8_t)open;
+            level->door_wait[b] = DOOR_WAIT;
+            level->revision++;
+        }
+        else if (open == 0)
+        {
+            level->door_move[b] = 0; // closed
+        }
+        else if ((level->door_wait[b] -= dt_sec) <= 0.0f)
+        {
+            level->door_move[b] = -1; // open long enough
+        }
+    }
+}
+
+/** The texture atlas all entries of the texture and sprite dictionary refer to */
+atlas_t* r_atlas(void)
+{
+    return &g_atlas;
+}
+
 texture_t* r_texture_dict(void)
 {
     return &g_textures[0];
@@ -169,61 +823,384 @@ texture_t* r_sprite_dict(void)
     return &g_sprites[0];
 }
 
+/** Fill the ceiling and/or the floor half of fb with a flat color */
+static void r_drawBackground(uint32_t* fb, bool ceiling, bool floor)
+{
+    if (ceiling)
+    {
+        for (int y = 0; y < HEIGHT / 2; y++)
+        {
+            for (int x = 0; x < WIDTH; x++)
+            {
+                fb[y * WIDTH + x] = SKY_COLOR;
+            }
+        }
+    }
+    if (floor)
+    {
+        for (int y = HEIGHT / 2; y < HEIGHT; y++)
+        {
+            for (int x = 0; x < WIDTH; x++)
+            {
+                fb[y * WIDTH + x] = FLOOR_COLOR;
+            }
+        }
+    }
+}
+
+/** Texture of floor or ceiling or NULL for a flat color. Floor and
+ *  ceiling textures wrap, so their size has to be a power of two. */
+static const texture_t* r_planetexture(int index)
+{
+#ifdef TEXTURES_DISABLED
+    (void)index;
+    return NULL;
+#else
+    if (index <= 0 || index >= MAX_TEXTURES)
+        return NULL;
+    const texture_t* t = &g_textures[index];
+    if (t->width == 0 || t->height == 0 ||
+        (t->width & (t->width - 1)) != 0 || (t->height & (t->height - 1)) != 0)
+        return NULL;
+    return t;
+#endif
+}
 
-static void r_drawBackground(uint32_t* fb)
+/** Draw the textured floor and ceiling row by row: all pixels of a row
+ *  have the same distance, so the texture coordinates are computed every
+ *  PLANE_SPAN columns and stepped linearly in between. Floor row
+ *  HEIGHT/2 + r and ceiling row HEIGHT/2 - 1 - r share the distance.
+ *  y_top and y_bottom are the rows of the walls, pixels covered by a wall
+ *  are not drawn. */
+static void r_drawplanes(uint32_t* fb, const gamestate_t* game, vertex_t view,
+                         const int16_t y_top[WIDTH], const int16_t y_bottom[WIDTH])
 {
-    int y;
-    for (y = 0; y < HEIGHT / 2; y++)
+    const texture_t* floor = r_planetexture(game->level.floor_texture);
+    const texture_t* ceiling = r_planetexture(game->level.ceiling_texture);
+
+    // rows closer to the horizon are covered by walls in all columns
+    int floor_first = HEIGHT, ceiling_last = 0;
+    for (int x = 0; x < WIDTH; x++)
+    {
+        floor_first = r_min(floor_first, y_bottom[x]);
+        ceiling_last = r_max(ceiling_last, y_top[x]);
+    }
+    if (!floor) { floor_first = HEIGHT; }
+    if (!ceiling) { ceiling_last = 0; }
+    const int r_first = r_min(floor_first - HEIGHT / 2, HEIGHT / 2 - ceiling_last);
+
+    for (int r = r_max(r_first, 0); r < HEIGHT / 2; r++)
     {
-        for (int x = 0; x < WIDTH; x++)
+        if (floor && HEIGHT / 2 + r >= floor_first)
         {
-            fb[y * WIDTH + x] = COLOR(10, 169, 216);
+            r_drawplanerow(fb, floor, PLANE_FLOOR, r, game->player_pos, view, y_bottom);
+        }
+        if (ceiling && HEIGHT / 2 - 1 - r < ceiling_last)
+        {
+            r_drawplanerow(fb, ceiling, PLANE_CEILING, r, game->player_pos, view, y_top);
         }
     }
-    for (; y < HEIGHT; y++)
+}
+
+/** Draw a row of the floor (clip: first floor row of each column) or of
+ *  the ceiling (clip: first wall row of each column). Texture coordinates
+ *  are 16.16 fixed point, wrapped with the power of two texture size. */
+static void r_drawplanerow(uint32_t* fb, const texture_t* t, int plane, int row,
+                           vertex_t pos, vertex_t view, const int16_t clip[WIDTH])
+{
+    const atlas_t* atlas = &g_atlas;
+    const bool floor = (plane == PLANE_FLOOR);
+    const int y = floor ? HEIGHT / 2 + row : HEIGHT / 2 - 1 - row;
+    const float dist = g_tables.dist[plane][row];
+    const int light = g_tables.light[plane][row];
+    // a texture repeats every cell, about 1/(dist * colangle) pixels
+    const float colangle = FOV / WIDTH * M_PI_F / 180.0f;
+    const int level = r_miplevel(t, (int)(g_tables.recip[plane][row] * (1.0f / colangle)));
+    // location of column x: base + coltan[x] * side
+    const vertex_t base = { .n = pos.n + dist * view.n, .e = pos.e + dist * view.e };
+    const vertex_t side = { .n = -dist * view.e, .e = dist * view.n };
+    const int w = t->width >> level;
+    const int h = t->height >> level;
+    const uint32_t umask = (uint32_t)w - 1;
+    const uint32_t vmask = (uint32_t)h - 1;
+    const int stride = atlas->height >> level; // texels from one column to the next
+    const unsigned char* texels = r_texcolumn(t, level, 0);
+    const uint8_t (*ramp)[256] = g_shade.lut.ramp[light];
+    const uint32_t* palette = g_shade.lut.palette[light];
+    uint32_t* pixels = &fb[y * WIDTH];
+
+    for (int x0 = 0; x0 < WIDTH; x0 += PLANE_SPAN)
     {
-        for (int x = 0; x < WIDTH; x++)
+        const int x1 = r_min(x0 + PLANE_SPAN, WIDTH);
+        const float e0 = base.e + g_tables.coltan[x0] * side.e;
+        const float n0 = base.n + g_tables.coltan[x0] * side.n;
+        const float e1 = base.e + g_tables.coltan[x1] * side.e;
+        const float n1 = base.n + g_tables.coltan[x1] * side.n;
+        // texel coordinates, the start is wrapped into the texture
+        int32_t u = (int32_t)((e0 - floorf(e0)) * w * 65536.0f);
+        int32_t v = (int32_t)((n0 - floorf(n0)) * h * 65536.0f);
+        const int32_t du = (int32_t)((e1 - e0) * w * 65536.0f) / (x1 - x0);
+        const int32_t dv = (int32_t)((n1 - n0) * h * 65536.0f) / (x1 - x0);
+
+        switch (atlas->format)
         {
-            fb[y * WIDTH + x] = COLOR(108, 108, 108);
+        case TEXTURE_ARGB8888:
+            for (int x = x0; x < x1; x++, u += du, v += dv)
+            {
+                if (floor ? (y < clip[x]) : (y >= clip[x]))
+                    continue;
+                const uint32_t texel = ((const uint32_t*)texels)[r_planetexel(u, v, umask, vmask, stride)];
+                pixels[x] = COLOR(ramp[0][(texel >> 16) & 0xff], ramp[1][(texel >> 8) & 0xff], ramp[2][texel & 0xff]);
+            }
+            break;
+        case TEXTURE_RGB565:
+            for (int x = x0; x < x1; x++, u += du, v += dv)
+            {
+                if (floor ? (y < clip[x]) : (y >= clip[x]))
+                    continue;
+                const uint32_t texel = ((const uint16_t*)texels)[r_planetexel(u, v, umask, vmask, stride)];
+                const uint32_t r = (texel >> 11) & 0x1f;
+                const uint32_t g = (texel >> 5) & 0x3f;
+                const uint32_t b = texel & 0x1f;
+                pixels[x] = COLOR(ramp[0][(r << 3) | (r >> 2)], ramp[1][(g << 2) | (g >> 4)], ramp[2][(b << 3) | (b >> 2)]);
+            }
+            break;
+        case TEXTURE_L8:
+        case TEXTURE_I8:
+            for (int x = x0; x < x1; x++, u += du, v += dv)
+            {
+                if (floor ? (y < clip[x]) : (y >= clip[x]))
+                    continue;
+                pixels[x] = palette[texels[r_planetexel(u, v, umask, vmask, stride)]];
+            }
+            break;
+        default:
+            assert(0);
         }
     }
 }
 
-static uint8_t r_raycast(const uint8_t* map, const int width, const int height,
-    float fStartX, float fStartY, float fEndX, float fEndY,
-    float* xHit, float* yHit, int* xBlock, int* yBlock,
-    int* xNormal, int* yNormal, float* f)
+/** Texel offset of 16.16 texture coordinates u, v in a wrapping texture */
+static inline int r_planetexel(int32_t u, int32_t v, uint32_t umask, uint32_t vmask, int stride)
+{
+    return (int)(((uint32_t)u >> 16) & umask) * stride + (int)(((uint32_t)v >> 16) & vmask);
+}
+
+/** Draw rows [first, last) of column x of a horizontal plane at height
+ *  (in wall heights above the floor the camera stands on) with texture t.
+ *  A plane below the camera (the floor, or the top of a low wall) covers
+ *  rows below the horizon, a plane above it (a sector ceiling) rows above.
+ *  Used for the floor between low walls and their tops, which are a few
+ *  pixels per column: the world position is computed per pixel. */
+static void r_drawplanecolumn(uint32_t* fb, const texture_t* t, int x, int first, int last,
+                              vertex_t pos, vertex_t ray, float cosangle, float height)
+{
+    const float colangle = FOV / WIDTH * M_PI_F / 180.0f;
+    const int plane = height < CAMERA_HEIGHT ? PLANE_FLOOR : PLANE_CEILING;
+    // distance relative to the floor or ceiling of g_tables
+    const float scale = plane == PLANE_FLOOR ? (CAMERA_HEIGHT - height) * (1.0f / CAMERA_HEIGHT)
+                                             : (height - CAMERA_HEIGHT) * (1.0f / (1.0f - CAMERA_HEIGHT));
+    if (scale <= 0.0f)
+        return; // plane at eye level
+    first = r_max(first, plane == PLANE_FLOOR ? HEIGHT / 2 : 0);
+    last = r_min(last, plane == PLANE_FLOOR ? HEIGHT : HEIGHT / 2);
+
+    for (int y = first; y < last; y++)
+    {
+        const int row = plane == PLANE_FLOOR ? y - HEIGHT / 2 : HEIGHT / 2 - 1 - y;
+        const float dist = g_tables.dist[plane][row] * scale;
+        const float travel = dist / cosangle;
+        const float e = pos.e + ray.e * travel;
+        const float n = pos.n + ray.n * travel;
+        const int level = r_miplevel(t, (int)(g_tables.recip[plane][row] / (scale * colangle)));
+        const int w = t->width >> level;
+        const int h = t->height >> level;
+        const int u = (int)((e - floorf(e)) * w) & (w - 1);
+        const int v = (int)((n - floorf(n)) * h) & (h - 1);
+        fb[y * WIDTH + x] = r_shadetexel(r_texcolumn(t, level, 0), u * (g_atlas.height >> level) + v, r_light(dist, 0));
+    }
+}
+
+/** Shaded color of texel index of texels in the atlas format */
+static inline uint32_t r_shadetexel(const unsigned char* texels, int index, int light)
+{
+    const uint8_t (*ramp)[256] = g_shade.lut.ramp[light];
+
+    switch (g_atlas.format)
+    {
+    case TEXTURE_ARGB8888:
+    {
+        const uint32_t texel = ((const uint32_t*)texels)[index];
+        return COLOR(ramp[0][(texel >> 16) & 0xff], ramp[1][(texel >> 8) & 0xff], ramp[2][texel & 0xff]);
+    }
+    case TEXTURE_RGB565:
+    {
+        const uint32_t texel = ((const uint16_t*)texels)[index];
+        const uint32_t r = (texel >> 11) & 0x1f;
+        const uint32_t g = (texel >> 5) & 0x3f;
+        const uint32_t b = texel & 0x1f;
+        return COLOR(ramp[0][(r << 3) | (r >> 2)], ramp[1][(g << 2) | (g >> 4)], ramp[2][(b << 3) | (b >> 2)]);
+    }
+    case TEXTURE_L8:
+    case TEXTURE_I8:
+        return g_shade.lut.palette[light][texels[index]];
+    default:
+        assert(0);
+        return 0;
+    }
+}
+
+/** Build the tables that depend on screen size, FOV and camera height */
+static void r_tablesinit(void)
+{
+    const float colangle = FOV / WIDTH * M_PI_F / 180.0f;
+    const float eye[2] = { CAMERA_HEIGHT, 1.0f - CAMERA_HEIGHT }; // distance to floor and ceiling
+
+    for (int x = 0; x <= WIDTH; x++)
+    {
+        g_tables.coltan[x] = tanf((x - WIDTH / 2) * colangle);
+    }
+    for (int plane = PLANE_FLOOR; plane <= PLANE_CEILING; plane++)
+    {
+        for (int r = 0; r < HEIGHT / 2; r++)
+        {
+            // same projection as walls: a wall at distance d is WALLHEIGHT / d high
+            const float dist = eye[plane] * WALLHEIGHT / (r + 0.5f);
+            g_tables.dist[plane][r] = dist;
+            g_tables.recip[plane][r] = (r + 0.5f) / (eye[plane] * WALLHEIGHT);
+            g_tables.light[plane][r] = (uint8_t)r_light(dist, 0);
+        }
+    }
+    g_tables_valid = true;
+}
+
+/** Cast the ray of a column from start to end and collect the walls it
+ *  hits front to back: the ray passes low and see-through walls and stops
+ *  at the first full height wall or after R_MAX_HITS hits. Consecutive cells
+ *  of the same low height are merged into one hit, as only the front face
+ *  and the top of the first one can be visible. */
+static void r_castcolumn(const level_t* level, vertex_t start, vertex_t end, r_column_t* col, r_visgrid_t* vis)
+{
+    r_ray_t ray;
+    r_hit_t hit;
+
+    r_rayinit(&ray, start.e, start.n, end.e, end.n);
+    col->count = 0;
+    while (col->count < R_MAX_HITS && r_raynext(level, &ray, &hit, vis) != 0)
+    {
+        const float wall = lvl_height(level, hit.block);
+        if (lvl_alpha(level, hit.block) != 0)
+        {
+            if (col->count < R_MAX_HITS - 1) // the last entry is kept for a wall
+            {
+                col->hits[col->count++] = hit;
+            }
+            continue;
+        }
+        r_hit_t* last = col->count > 0 ? &col->hits[col->count - 1] : NULL;
+        if (last && wall < 1.0f && last->exit == hit.f && lvl_height(level, last->block) == wall &&
+            lvl_alpha(level, last->block) == 0)
+        {
+            last->exit = hit.exit;
+            continue;
+        }
+        col->hits[col->count++] = hit;
+        if (wall >= 1.0f)
+            break;
+    }
+}
+
+/** Start a ray from start to end, see r_raynext */
+static void r_rayinit(r_ray_t* ray, float fStartX, float fStartY, float fEndX, float fEndY)
 {
     const float dx = fEndX - fStartX;
     const float dy = fEndY - fStartY;
     const int stepX = r_signum(dx);
     const int stepY = r_signum(dy);
-    const float tDeltaX = stepX / dx;
-    const float tDeltaY = stepY / dy;
 
     const float fbX_ = dx >= 0.0f ? ceilf(fStartX) : floorf(fStartX);
     const float fbY_ = dy >= 0.0f ? ceilf(fStartY) : floorf(fStartY);
     const float dfX = fbX_ - fStartX;
     const float dfY = fbY_ - fStartY;
-    float tMaxX = (dfX != 0.0f ? dfX : stepX) / dx;
-    float tMaxY = (dfY != 0.0f ? dfY : stepY) / dy;
 
-    int x = (int)fStartX; // East
-    int y = (int)fStartY; // North
-    int nx, ny;
+    ray->sx = fStartX;
+    ray->sy = fStartY;
+    ray->dx = dx;
+    ray->dy = dy;
+    ray->stepX = stepX;
+    ray->stepY = stepY;
+    ray->tDeltaX = stepX / dx;
+    ray->tDeltaY = stepY / dy;
+    // travel along ray to the first grid line crossing, the k-th crossing
+    // is at tFirst + k * tDelta. Not accumulated, so that leaping ahead
+    // with the distance field gives bit-identical results.
+    ray->tFirstX = (dfX != 0.0f ? dfX : stepX) / dx;
+    ray->tFirstY = (dfY != 0.0f ? dfY : stepY) / dy;
+    ray->tMaxX = ray->tFirstX;
+    ray->tMaxY = ray->tFirstY;
+    ray->ix = 0; // number of grid line crossings in x and y so far
+    ray->iy = 0;
+    ray->x = (int)fStartX; // East
+    ray->y = (int)fStartY; // North
+    ray->dist = 0.0f;
+    ray->started = false;
+}
+
+/** Walk the cells along the ray (DDA) to the next non-empty cell and return
+ *  it or 0 at the end of the ray. The next call continues behind the hit.
+ *  If vis is not NULL, all traversed cells are marked in vis. Doors and thin
+ *  walls are a plane inside their cell, which is tested in the same pass
+ *  when the ray enters the cell (or starts in it); rays that miss the plane
+ *  walk on. */
+static uint8_t r_raynext(const level_t* level, r_ray_t* ray, r_hit_t* hit, r_visgrid_t* vis)
+{
+    const int width = level->width;
+    const int height = level->height;
+    const float fStartX = ray->sx;
+    const float fStartY = ray->sy;
+    const float dx = ray->dx;
+    const float dy = ray->dy;
+    const int stepX = ray->stepX;
+    const int stepY = ray->stepY;
+    const float tDeltaX = ray->tDeltaX;
+    const float tDeltaY = ray->tDeltaY;
+    const float tFirstX = ray->tFirstX;
+    const float tFirstY = ray->tFirstY;
+    float tMaxX = ray->tMaxX;
+    float tMaxY = ray->tMaxY;
+    int ix = ray->ix, iy = ray->iy;
+    int x = ray->x;
+    int y = ray->y;
+    int nx = 0, ny = 0;
+    float dist = ray->dist;
+    float tex = 0.0f;
+    uint8_t b = 0;
+
+    if (!ray->started && x >= 0 && x < width && y >= 0 && y < height) // door or thin wall in the start cell?
+    {
+        b = lvl_cell(level, x, y);
+        if (b > 0 && r_planehit(level, b, x, y, fStartX, fStartY, dx, dy,
+                0.0f, r_min(tMaxX, tMaxY), &dist, &tex, &nx, &ny))
+        {
+            hit->exit = dist;
+            goto hit;
+        }
+        b = 0;
+    }
+    ray->started = true;
 
-    for (float dist = 0.0f; dist <= 1.0f;/*NOP*/)
+    while (dist <= 1.0f)
     {
         dist = r_min(tMaxX, tMaxY); // travel along ray
         if (tMaxX < tMaxY)
         {
-            tMaxX += tDeltaX;
+            tMaxX = tFirstX + (float)(++ix) * tDeltaX;
             x += stepX;
             nx = stepX; ny = 0;
         }
         else
         {
-            tMaxY += tDeltaY;
+            tMaxY = tFirstY + (float)(++iy) * tDeltaY;
             y += stepY;
             ny = stepY; nx = 0;
         }
@@ -233,104 +1210,634 @@ static uint8_t r_raycast(const uint8_t* map, const int width, const int height,
             continue;
         }
 
-        const int ymap = height - 1 - y;
-        const uint8_t b = map[ymap * width + x];
+        if (vis) { r_visit(vis, x, y); }
+        b = lvl_cell(level, x, y); // resolved through chunk cache
         if (b > 0) // ray has hit a wall
         {
-            if (xHit) { *xHit = fStartX + dx * dist; } // location of wall hit
-            if (yHit) { *yHit = fStartY + dy * dist; }
-            if (xBlock) { *xBlock = x; } // block index in map
-            if (yBlock) { *yBlock = y; }
-            if (xNormal) { *xNormal = -nx; }
-            if (yNormal) { *yNormal = -ny; }
-            if (f) { *f = dist; }
+            const level_block_t* block = lvl_block(level, b);
+            if (block && block->type != LEVEL_BLOCK_SOLID)
+            {
+                if (!r_planehit(level, b, x, y, fStartX, fStartY, dx, dy,
+                        dist, r_min(tMaxX, tMaxY), &dist, &tex, &nx, &ny))
+                {
+                    continue; // through the open part of a door or past a thin wall
+                }
+                hit->exit = dist;
+            }
+            else
+            {
+                const float along = nx != 0 ? fStartY + dy * dist : fStartX + dx * dist;
+                tex = along - floorf(along);
+                hit->exit = r_min(tMaxX, tMaxY);
+            }
+            goto hit;
+        }
 
-            assert(b >= 0 && b<=7);
-            return b;
+#ifndef DISTANCE_FIELD_DISABLED
+        // The next rx crossings in x and ry in y stay in empty cells: all
+        // cells within Chebyshev radius lvl_dist - 1 around (x,y) are empty,
+        // or without a distance field an empty block of the occupancy
+        // pyramid. Skip all steps up to the first one that leaves this area.
+        int rx = 0, ry = 0;
+        if (level->dist)
+            rx = ry = lvl_dist(level, x, y) - 1;
+        else
+            r_emptyblock(level, x, y, stepX, stepY, &rx, &ry);
+        if ((rx > 0 || ry > 0) && dist <= 1.0f)
+        {
+            const float exitX = stepX ? tFirstX + (float)(ix + rx) * tDeltaX : INFINITY;
+            const float exitY = stepY ? tFirstY + (float)(iy + ry) * tDeltaY : INFINITY;
+            int sx, sy; // steps to skip in x and y
+            if (exitX < exitY) // leaving the area in x direction
+            {
+                sx = rx;
+                sy = stepY ? r_crossings(tFirstY, tDeltaY, fabsf(dy), iy, ry, exitX, false) : 0;
+            }
+            else
+            {
+                sy = ry;
+                sx = stepX ? r_crossings(tFirstX, tDeltaX, fabsf(dx), ix, rx, exitY, true) : 0;
+            }
+            if (vis) // mark the skipped cells, same order as the steps above
+            {
+                int cx = x, cy = y;
+                for (int kx = 0, ky = 0; kx < sx || ky < sy;)
+                {
+                    const float tx = kx < sx ? tFirstX + (float)(ix + kx) * tDeltaX : INFINITY;
+                    const float ty = ky < sy ? tFirstY + (float)(iy + ky) * tDeltaY : INFINITY;
+                    if (tx < ty) { cx += stepX; kx++; }
+                    else         { cy += stepY; ky++; }
+                    r_visit(vis, cx, cy);
+                }
+            }
+            if (sx > 0)
+            {
+                dist = tFirstX + (float)(ix + sx - 1) * tDeltaX;
+                ix += sx;
+                x += sx * stepX;
+                tMaxX = tFirstX + (float)ix * tDeltaX;
+            }
+            if (sy > 0)
+            {
+                dist = r_max(dist, tFirstY + (float)(iy + sy - 1) * tDeltaY);
+                iy += sy;
+                y += sy * stepY;
+                tMaxY = tFirstY + (float)iy * tDeltaY;
+            }
         }
+#endif
     }
-    if (f) { *f = 1.0f; }
+    b = 0;
+    goto done;
 
-    return 0;
+hit:
+    hit->hit.e = fStartX + dx * dist; // location of wall hit
+    hit->hit.n = fStartY + dy * dist;
+    hit->f = dist;
+    hit->tex = tex;
+    hit->block = b;
+    hit->eNormal = (int8_t)-nx;
+    hit->nNormal = (int8_t)-ny;
+    ray->started = true;
+
+done:
+    ray->tMaxX = tMaxX;
+    ray->tMaxY = tMaxY;
+    ray->ix = ix;
+    ray->iy = iy;
+    ray->x = x;
+    ray->y = y;
+    ray->dist = dist;
+    return b;
+}
+
+/** Intersect the ray start + t * (dx, dy) with the plane of the door or thin
+ *  wall in cell x, y for t0 <= t <= t1. The plane runs north-south
+ *  (LEVEL_AXIS_E) or east-west (LEVEL_AXIS_N) at offset within the cell, an
+ *  open door is shifted along the plane by door_open. On a hit, the travel t,
+ *  the texture column u and the step direction nx, ny towards the plane are
+ *  set. */
+static bool r_planehit(const level_t* level, uint8_t b, int x, int y,
+    float fStartX, float fStartY, float dx, float dy, float t0, float t1,
+    float* t, float* u, int* nx, int* ny)
+{
+    const level_block_t* block = lvl_block(level, b);
+    if (!block || block->type == LEVEL_BLOCK_SOLID)
+        return false;
+
+    const float offset = block->offset * (1.0f / 256.0f);
+    const float open = block->type == LEVEL_BLOCK_DOOR ?
+        level->door_open[b] * (1.0f / LEVEL_DOOR_OPEN) : 0.0f;
+    float tp, s; // travel to the plane, position along the plane
+    if (block->axis == LEVEL_AXIS_E)
+    {
+        if (dx == 0.0f)
+            return false;
+        tp = ((float)x + offset - fStartX) / dx;
+        s = fStartY + dy * tp - (float)y;
+    }
+    else
+    {
+        if (dy == 0.0f)
+            return false;
+        tp = ((float)y + offset - fStartY) / dy;
+        s = fStartX + dx * tp - (float)x;
+    }
+    if (tp < t0 || tp > t1 || s < open)
+        return false;
+
+    *t = tp;
+    *u = r_clamp(s - open, 0.0f, 1.0f);
+    *nx = block->axis == LEVEL_AXIS_E ? r_signum(dx) : 0;
+    *ny = block->axis == LEVEL_AXIS_N ? r_signum(dy) : 0;
+    return true;
+}
+
+/** Mark cell x (east), y (north) as traversed by a ray */
+static inline void r_visit(r_visgrid_t* vis, int x, int y)
+{
+    const unsigned int i = (unsigned int)(x - vis->x0);
+    const unsigned int j = (unsigned int)(y - vis->y0);
+    if (i < VIS_SIZE && j < VIS_SIZE)
+    {
+        vis->bits[(j << VIS_SHIFT | i) >> 5] |= 1u << (i & 31);
+    }
 }
 
-void r_drawsprite(uint32_t* fb, const float zbuffer[WIDTH], const texture_t* t,
-                  vertex_t player_pos, vertex_t player_dir, vertex_t sprite_pos)
+/** True if a ray traversed cell x (east), y (north). Cells outside of the
+ *  window are never rejected. */
+static inline bool r_visited(const r_visgrid_t* vis, int x, int y)
 {
-    const vertex_t dx = { .n = sprite_pos.n - player_pos.n, .e = sprite_pos.e - player_pos.e };
-    vertex_t player_tangent;
-    player_tangent.e =  player_dir.n;
-    player_tangent.n = -player_dir.e;
+    const unsigned int i = (unsigned int)(x - vis->x0);
+    const unsigned int j = (unsigned int)(y - vis->y0);
+    if (i >= VIS_SIZE || j >= VIS_SIZE)
+        return true;
+    return (vis->bits[(j << VIS_SHIFT | i) >> 5] >> (i & 31)) & 1u;
+}
 
-    // transform sprite position into player camera system:
-    const float dist = dx.n * player_dir.n + dx.e * player_dir.e; // sprite distance from player
-    const float east = dx.n * player_tangent.n + dx.e * player_tangent.e; // sprite position relative to screen center
+#ifndef DISTANCE_FIELD_DISABLED
+/** Number of grid line crossings k in [k0, k0 + n) with
+ *  tFirst + k * tDelta <= limit (or < limit if strict).
+ *  invDelta = 1/tDelta is used for the initial guess, which is then
+ *  corrected with the exact crossing times used by r_raynext. */
+static int r_crossings(float tFirst, float tDelta, float invDelta,
+    int k0, int n, float limit, bool strict)
+{
+    int c = (int)((limit - tFirst) * invDelta) + 1 - k0;
+    c = r_clamp(c, 0, n);
+    while (c > 0)
+    {
+        const float t = tFirst + (float)(k0 + c - 1) * tDelta;
+        if (strict ? (t < limit) : (t <= limit))
+            break;
+        c--;
+    }
+    while (c < n)
+    {
+        const float t = tFirst + (float)(k0 + c) * tDelta;
+        if (strict ? !(t < limit) : !(t <= limit))
+            break;
+        c++;
+    }
+    return c;
+}
 
-    if (dist < 0.1f)
+/** Steps rx in x (stepX) and ry in y (stepY) from cell x, y that stay in the
+ *  largest empty block of the occupancy pyramid around it and inside the
+ *  map, 0 if the level has no pyramid or the 2 x 2 block is not empty */
+static void r_emptyblock(const level_t* level, int x, int y, int stepX, int stepY, int* rx, int* ry)
+{
+    const int levels = level->header ? (int)level->header->pyramid_levels : 0;
+    int lod = 0;
+    while (lod < levels && !lvl_occupied(level, lod + 1, x, y))
+    {
+        lod++;
+    }
+    if (lod == 0)
+    {
+        *rx = *ry = 0;
         return;
+    }
+    // blocks are aligned in map rows, which count from the north edge down
+    const int ymap = level->height - 1 - y;
+    const int x0 = x >> lod << lod;
+    const int x1 = r_min(x0 + (1 << lod) - 1, level->width - 1);
+    const int y1 = level->height - 1 - (ymap >> lod << lod);
+    const int y0 = r_max(y1 - (1 << lod) + 1, 0);
+    *rx = stepX > 0 ? x1 - x : stepX < 0 ? x - x0 : 0;
+    *ry = stepY > 0 ? y1 - y : stepY < 0 ? y - y0 : 0;
+}
+#endif
 
+/** Draw the sprites of the game back to front. Sprites in cells that no
+ *  ray traversed (vis), behind the camera or outside of the screen are
+ *  culled before they are sorted by camera depth, only the on-screen
+ *  columns of a sprite are visited and columns behind a full height wall
+ *  (zbuffer) are rejected before any texel is read. Low walls in front of a
+ *  sprite clip its columns from below (g_occlusion), see-through walls
+ *  behind it are composited before the sprite is drawn over them.
+ *  Like in Wolfenstein 3D, a sprite is only drawn if the cell of its
+ *  center is visible. */
+static void r_drawsprites(uint32_t* fb, const float zbuffer[WIDTH], const gamestate_t* game,
+                          const r_visgrid_t* vis, vertex_t view, float colangle)
+{
     const float SPRITEHEIGHT = HEIGHT/2;
-    const float SPRITEWIDTH = 1.0f;
-    const float s = (WIDTH / 2) / tanf(FOV*M_PI_F/180.0f / 2); // scale factor to project x coord. on screen
+    const vertex_t tangent = { .n = -view.e, .e = view.n };
+    const r_blend_t blend = g_blend ? g_blend : r_blend;
+    int count = 0;
+
+    for (int i = 0; i < game->sprite_count; i++)
+    {
+        const sprite_t* s = &game->sprites[i];
+        if (s->texture >= MAX_SPRITES || g_sprites[s->texture].height == 0)
+            continue;
+        if (!r_visited(vis, (int)floorf(s->pos.e), (int)floorf(s->pos.n)))
+            continue;
+        const texture_t* t = &g_sprites[s->texture];
+
+        // transform sprite position into camera system
+        const vertex_t dx = { .n = s->pos.n - game->player_pos.n, .e = s->pos.e - game->player_pos.e };
+        const float depth = dx.n * view.n + dx.e * view.e;
+        const float east = dx.n * tangent.n + dx.e * tangent.e;
+        if (depth < 0.1f)
+            continue;
+
+        // columns are equiangular, like the rays of r_render: the height
+        // depends on the depth (like walls), the width on the distance
+        const float width = SPRITEHEIGHT / sqrtf(depth * depth + east * east) * t->width / t->height;
+        const float x_left = WIDTH / 2 + atan2f(east, depth) / colangle - width / 2;
+        if (x_left >= WIDTH || x_left + width <= 0.0f)
+            continue;
+
+        g_visible[count++] = (r_sprite_t){ .depth = depth, .x_left = x_left, .width = width, .t = t };
+    }
 
-    int x_right = WIDTH/2 + (int)(s * (east + SPRITEWIDTH * 0.5f) / dist); // project right edge of sprite on screen
-    int x_left = WIDTH/2 + (int)(s * (east - SPRITEWIDTH * 0.5f) / dist);
-    const float tx = 1.0f / (x_right - x_left);
-    float txcolumn = 0.0f;
-    const float height = SPRITEHEIGHT / dist;
+    qsort(g_visible, (size_t)count, sizeof(r_sprite_t), r_spritecmp);
+    g_stats.sprites = (uint32_t)count;
 
-    for (int x = x_left; x < x_right; x++, txcolumn+=tx)
+    for (int i = 0; i < count; i++)
     {
-        if (x >= WIDTH)
+        const r_sprite_t* v = &g_visible[i];
+        const int height = (int)(SPRITEHEIGHT / v->depth);
+        const int y_high = HEIGHT / 2 - height / 2;
+        const int y_low = HEIGHT / 2 + height / 2;
+        if (y_low <= y_high)
+            continue;
+
+        // columns with their center inside the sprite, clipped to the screen
+        const int x_first = r_max((int)ceilf(v->x_left - 0.5f), 0);
+        const int x_last = r_min((int)ceilf(v->x_left + v->width - 0.5f), WIDTH);
+        const float tx_stride = 1.0f / v->width;
+        float tx = (x_first + 0.5f - v->x_left) * tx_stride;
+        const int light = r_light(v->depth, 0);
+
+        for (int x = x_first; x < x_last; x++, tx += tx_stride)
+        {
+            if (v->depth >= zbuffer[x])
+                continue;
+            if (r_drawglass(fb, x, game, view, v->depth))
+            {
+                blend(NULL, 0, NULL, 0); // the see-through walls behind the sprite are in fb
+            }
+            const int clip = r_occlusionclip(x, v->depth);
+            const float tex_column = r_clamp(tx, 0.0f, 1.0f);
+            if (v->t->spans != TEXTURE_NO_SPANS)
+                r_drawspans(fb, v->t, x, y_high, y_low, 0, clip, tex_column, light);
+            else
+                r_drawcolumn(fb, v->t, x, y_high, y_low, 0, clip, tex_column, true, light);
+        }
+    }
+}
+
+/** First row of column x covered by the low walls in front of depth */
+static int r_occlusionclip(int x, float depth)
+{
+    const r_occlusion_t* occlusion = &g_occlusion[x];
+    int clip = HEIGHT;
+    for (int k = 0; k < occlusion->count && occlusion->depth[k] < depth; k++)
+    {
+        clip = occlusion->clip[k];
+    }
+    return clip;
+}
+
+/** Composite the see-through walls of column x behind min_depth, which are
+ *  not composited yet, back to front. Each wall is drawn into a g_glass
+ *  buffer with its opacity in the alpha channel and blended into fb, so the
+ *  blend of one wall (DMA2D) runs while the next one is drawn. Returns true
+ *  if a blend was started. */
+static bool r_drawglass(uint32_t* fb, int x, const gamestate_t* game, vertex_t view, float min_depth)
+{
+    const r_column_t* col = &g_frame.column[x];
+    r_occlusion_t* occlusion = &g_occlusion[x];
+    const r_blend_t blend = g_blend ? g_blend : r_blend;
+    bool blended = false;
+
+    for (; occlusion->glass > 0; occlusion->glass--)
+    {
+        const r_hit_t* h = &col->hits[occlusion->glass - 1];
+        const int alpha = lvl_alpha(&game->level, h->block);
+        if (alpha == 0)
+            continue;
+        const vertex_t dx = { .n = h->hit.n - game->player_pos.n, .e = h->hit.e - game->player_pos.e };
+        const float dist = dx.n * view.n + dx.e * view.e;
+        if (dist <= min_depth)
             break;
-        if (x < 0) // FIXME this is inefficient
+        const float height = WALLHEIGHT / dist;
+        const texture_t* t = &g_textures[lvl_texture(&game->level, h->block)];
+        if (height > 50 * WALLHEIGHT || t->height == 0)
             continue;
-        if (dist > zbuffer[x])
+
+        const float wall = lvl_height(&game->level, h->block);
+        const int y_hi = HEIGHT / 2 - (int)(height * (1.0f - CAMERA_HEIGHT));
+        const int y_lo = HEIGHT / 2 + (int)(height * CAMERA_HEIGHT);
+        const int y_wall = wall < 1.0f ? HEIGHT / 2 + (int)(height * (CAMERA_HEIGHT - wall)) : y_hi;
+        const int first = r_max(y_wall, 0);
+        const int last = r_min(r_min(y_lo, r_occlusionclip(x, dist)), HEIGHT);
+        if (first >= last)
+            continue;
+
+        uint32_t* buf = g_glass[g_glassbuf];
+        g_glassbuf ^= 1;
+        const int light = r_light(dist, h->eNormal != 0 ? SHADE_SIDE : 0);
+        r_glasscolumn(buf, t, y_hi, y_lo, first, last, h->tex, alpha, light);
+        blend(&fb[first * WIDTH + x], WIDTH, buf, last - first);
+        blended = true;
+        g_stats.blends++;
+    }
+    return blended;
+}
+
+/** Draw rows [first, last) of a column of texture t stretched over rows
+ *  [y_high, y_low) into buf, with the texel opacity times alpha/255 in the
+ *  alpha channel (0 for transparent texels) */
+static void r_glasscolumn(uint32_t* buf, const texture_t* t, int y_high, int y_low, int first, int last,
+                          float tex_column, int alpha, int light)
+{
+    const atlas_t* atlas = &g_atlas;
+    const int ylen = y_low - y_high;
+    const int level = r_miplevel(t, ylen);
+    const int height = t->height >> level;
+    const int tx = (int)(tex_column * ((t->width >> level)-1)); // fixed column
+    const int32_t ty_stride = ((height-1) << 16) / ylen; // 16.16 fixed point
+    int32_t ty = (first - y_high) * ty_stride;
+    const unsigned char* texels = r_texcolumn(t, level, tx);
+
+    for (int c = first; c < last; c++, ty += ty_stride)
+    {
+        const int index = ty >> 16;
+        uint32_t opacity = 255;
+        switch (atlas->format)
+        {
+        case TEXTURE_ARGB8888: opacity = ((const uint32_t*)texels)[index] >> 24; break;
+        case TEXTURE_RGB565:   opacity = ((const uint16_t*)texels)[index] == 0xf81f ? 0 : 255; break;
+        case TEXTURE_I8:       opacity = texels[index] == 0 ? 0 : 255; break;
+        default:               break;
+        }
+        const uint32_t a = (opacity * (uint32_t)alpha + 127) / 255;
+        buf[c - first] = a ? (r_shadetexel(texels, index, light) & 0x00ffffff) | a << 24 : 0;
+    }
+}
+
+/** Software r_blend_t: blend src over dst with the alpha of src */
+static void r_blend(uint32_t* dst, int stride, const uint32_t* src, int count)
+{
+    for (int i = 0; i < count; i++, dst += stride)
+    {
+        const uint32_t s = src[i];
+        const uint32_t a = (s >> 24) + (s >> 31); // 0 .. 256
+        if (a == 0)
             continue;
-        r_drawcolumn((uint8_t*)fb, t, x, (int)(HEIGHT / 2 - height / 2), (int)(HEIGHT / 2 + height / 2), txcolumn, true);
+        const uint32_t d = *dst;
+        const uint32_t rb = ((s & 0xff00ff) * a + (d & 0xff00ff) * (256 - a)) >> 8;
+        const uint32_t g = ((s & 0x00ff00) * a + (d & 0x00ff00) * (256 - a)) >> 8;
+        *dst = 0xff000000 | (rb & 0xff00ff) | (g & 0x00ff00);
+    }
+}
+
+/** qsort comparison: far sprites first */
+static int r_spritecmp(const void* a, const void* b)
+{
+    const float da = ((const r_sprite_t*)a)->depth;
+    const float db = ((const r_sprite_t*)b)->depth;
+    return (da < db) - (da > db);
+}
+
+/** Mip level for a texture drawn ylen pixels high: at most two texture rows per pixel */
+static int r_miplevel(const texture_t* t, int ylen)
+{
+    int level = 0;
+    while (level + 1 < g_atlas.miplevels && (ylen << (level + 1)) <= t->height)
+    {
+        level++;
     }
+    return level;
+}
+
+/** Animation frame of texture t at the tick of the current frame, 0 for a
+ *  still texture. Notes when the frame changes, so r_render draws again. */
+static inline int r_frame(const texture_t* t)
+{
+    if (t->frames < 2 || t->period == 0)
+        return 0;
+    const uint32_t step = g_frame.tick / t->period;
+    g_frame.expires = r_min(g_frame.expires, t->period - g_frame.tick % t->period);
+    return (int)(step % t->frames);
+}
+
+/** First texel of column tx of texture t at mip level, in the current frame
+ *  of an animated texture. Columns are contiguous, the atlas is stored
+ *  column-major. */
+static const unsigned char* r_texcolumn(const texture_t* t, int level, int tx)
+{
+    const atlas_t* atlas = &g_atlas;
+    tx += r_frame(t) * (t->width >> level);
+    const int offset = ((t->u >> level) + tx) * (atlas->height >> level) + (t->v >> level);
+    return &atlas->mip[level][offset * atlas->bytesperpixel];
 }
 
-static void r_drawcolumn(uint8_t* framebuf, const texture_t* t, int x, int y_high, int y_low, float tex_column, bool transparency)
+/** Draw a column of texture t stretched over rows [y_high, y_low) of
+ *  framebuffer column x, only rows [first, last) are drawn */
+static void r_drawcolumn(uint32_t* fb, const texture_t* t, int x, int y_high, int y_low, int first, int last,
+                         float tex_column, bool transparency, int light)
 {
     assert(y_low > y_high);
     assert(x >= 0 && x < WIDTH);
     assert(tex_column >= 0.0f && tex_column <= 1.0f);
 
+    const int ylen = y_low - y_high; //
+    first = r_max(r_max(first, y_high), 0);
+    last = r_min(r_min(last, y_low), HEIGHT);
+    if (ylen < 1 || first >= last)
+        return;
+
+    const int level = r_miplevel(t, ylen);
+    const int height = t->height >> level;
+    const int tx = (int)(tex_column * ((t->width >> level)-1)); // fixed column
+    const int32_t ty_stride = ((height-1) << 16) / ylen; // 16.16 fixed point
+    const int32_t ty = (first - y_high) * ty_stride;
+
+    r_drawtexels(fb, r_texcolumn(t, level, tx), x, first, last, ty, ty_stride, transparency, light);
+}
+
+/** Draw a column of a texture with a span table: only the runs of opaque
+ *  texels are visited, so the cost is proportional to the visible pixels.
+ *  Like r_drawcolumn, only rows [first, last) are drawn. */
+static void r_drawspans(uint32_t* fb, const texture_t* t, int x, int y_high, int y_low, int first, int last,
+                        float tex_column, int light)
+{
+    assert(y_low > y_high);
+    assert(x >= 0 && x < WIDTH);
+    assert(tex_column >= 0.0f && tex_column <= 1.0f);
+    assert(t->spans != TEXTURE_NO_SPANS);
+
     const int ylen = y_low - y_high; //
     if (ylen < 1 || y_low < 0)
         return;
 
-    const int rl = t->rowlength;
-    const int tx = (int)(tex_column * (t->width-1)); // fixed column
-    const float ty_stride = (float)(t->height-1) / (ylen);
+    const int level = r_miplevel(t, ylen);
+    const int height = t->height >> level;
+    const int tx = (int)(tex_column * ((t->width >> level)-1)); // fixed column
+    const int32_t ty_stride = ((height-1) << 16) / ylen; // 16.16 fixed point
+    if (ty_stride == 0)
+    {
+        r_drawcolumn(fb, t, x, y_high, y_low, first, last, tex_column, true, light); // single texel row
+        return;
+    }
+
+    // span table: column index of all mip levels (all frames), then (start, length) runs
+    const uint16_t* table = &g_atlas.spans[t->spans];
+    const int frames = r_max(t->frames, 1);
+    int index = r_frame(t) * (t->width >> level) + tx;
+    for (int k = 0; k < level; k++)
+    {
+        index += (t->width * frames) >> k;
+    }
+    const unsigned char* column = r_texcolumn(t, level, tx);
+    const int y_begin = r_max(first, 0);
+    const int y_end = r_min(r_min(y_low, last), HEIGHT);
 
-    float ty = 0.0f;
-    if (y_high < 0)
+    for (const uint16_t* run = &table[table[index]]; run < &table[table[index + 1]]; run += 2)
     {
-        ty = (-(float)y_high / ylen) * (float)(t->height-1);
-        assert(ty >= 0 && ty < t->height);
-        y_high = 0;
+        // first pixel row of the run and first pixel row after it
+        const int c0 = y_high + (int)((((uint32_t)run[0] << 16) + ty_stride - 1) / ty_stride);
+        const int c1 = y_high + (int)((((uint32_t)(run[0] + run[1]) << 16) + ty_stride - 1) / ty_stride);
+        const int r0 = r_max(c0, y_begin);
+        const int r1 = r_min(c1, y_end);
+        if (r0 < r1)
+        {
+            r_drawtexels(fb, column, x, r0, r1, (r0 - y_high) * ty_stride, ty_stride, false, light);
+        }
+        if (c1 >= y_end)
+            break;
     }
-    y_low = r_min(y_low, HEIGHT);
+}
 
-    const int bpp  = t->bytesperpixel;
-    for (int c = y_high; c < y_low; c++)
+/** Draw texels column[ty >> 16] to rows [first, last) of framebuffer column x,
+ *  ty advances by ty_stride per row. light selects the shade tables. */
+static void r_drawtexels(uint32_t* fb, const unsigned char* column, int x, int first, int last,
+                         int32_t ty, int32_t ty_stride, bool transparency, int light)
+{
+    const atlas_t* atlas = &g_atlas;
+    const uint8_t (*ramp)[256] = g_shade.lut.ramp[light];
+    const uint32_t* palette = g_shade.lut.palette[light];
+
+    switch (atlas->format)
     {
-        assert((int)ty < t->height);
-        assert(((int)ty) * rl + tx * bpp + 2 < t->rowlength * t->height);
-        assert(c * WIDTH * BPP + x * BPP + 2 < WIDTH * HEIGHT * BPP);
-        const uint8_t R = t->pixels[((int)ty) * rl + tx * bpp + 0];
-        const uint8_t G = t->pixels[((int)ty) * rl + tx * bpp + 1];
-        const uint8_t B = t->pixels[((int)ty) * rl + tx * bpp + 2];
-        ty += ty_stride;
-        if (transparency && R == 0xff && G == 0x0 && B == 0xff)
-            continue;
+    case TEXTURE_ARGB8888:
+        for (int c = first; c < last; c++, ty += ty_stride)
+        {
+            const uint32_t texel = ((const uint32_t*)column)[ty >> 16];
+            if (transparency && (texel >> 24) == 0)
+                continue;
+            fb[c * WIDTH + x] = COLOR(ramp[0][(texel >> 16) & 0xff], ramp[1][(texel >> 8) & 0xff], ramp[2][texel & 0xff]);
+        }
+        break;
+    case TEXTURE_RGB565:
+        for (int c = first; c < last; c++, ty += ty_stride)
+        {
+            const uint32_t texel = ((const uint16_t*)column)[ty >> 16];
+            if (transparency && texel == 0xf81f)
+                continue;
+            const uint32_t r = (texel >> 11) & 0x1f;
+            const uint32_t g = (texel >> 5) & 0x3f;
+            const uint32_t b = texel & 0x1f;
+            fb[c * WIDTH + x] = COLOR(ramp[0][(r << 3) | (r >> 2)], ramp[1][(g << 2) | (g >> 4)], ramp[2][(b << 3) | (b >> 2)]);
+        }
+        break;
+    case TEXTURE_L8:
+        for (int c = first; c < last; c++, ty += ty_stride)
+        {
+            fb[c * WIDTH + x] = palette[column[ty >> 16]];
+        }
+        break;
+    case TEXTURE_I8:
+        for (int c = first; c < last; c++, ty += ty_stride)
+        {
+            const uint8_t index = column[ty >> 16];
+            if (transparency && index == 0)
+                continue;
+            fb[c * WIDTH + x] = palette[index];
+        }
+        break;
+    default:
+        assert(0);
+    }
+}
+
+/** Build the light level tables for the format and palette of the atlas:
+ *  shaded copies of the palette (gray ramp for TEXTURE_L8) or per channel
+ *  color ramps. Level 0 is the unshaded texel color. */
+static void r_shadeinit(void)
+{
+    const atlas_t* atlas = &g_atlas;
+    assert(atlas->format != TEXTURE_I8 || atlas->palette); // the I8 readers look up g_shade.lut.palette
+    const bool indexed = atlas->format == TEXTURE_I8 || atlas->format == TEXTURE_L8;
+    const uint32_t fog[3] = { (SHADE_FOG >> 16) & 0xff, (SHADE_FOG >> 8) & 0xff, SHADE_FOG & 0xff };
 
-        framebuf[c * WIDTH * BPP + x * BPP + 0] = R;
-        framebuf[c * WIDTH * BPP + x * BPP + 1] = G;
-        framebuf[c * WIDTH * BPP + x * BPP + 2] = B;
+    for (int level = 0; level < SHADE_LEVELS; level++)
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            if (indexed)
+            {
+                const uint32_t c = atlas->format == TEXTURE_I8 ? atlas->palette[i] : COLOR(i, i, i);
+                g_shade.lut.palette[level][i] = (c & 0xff000000) |
+                    r_fog((c >> 16) & 0xff, fog[0], level) << 16 |
+                    r_fog((c >> 8) & 0xff, fog[1], level) << 8 |
+                    r_fog(c & 0xff, fog[2], level);
+            }
+            else
+            {
+                g_shade.lut.ramp[level][0][i] = (uint8_t)r_fog(i, fog[0], level);
+                g_shade.lut.ramp[level][1][i] = (uint8_t)r_fog(i, fog[1], level);
+                g_shade.lut.ramp[level][2][i] = (uint8_t)r_fog(i, fog[2], level);
+            }
+        }
     }
+    g_shade.valid = true;
+    g_shade.format = atlas->format;
+    g_shade.palette = atlas->palette;
+}
+
+/** Color channel c with level/SHADE_LEVELS of fog blended in */
+static inline uint32_t r_fog(uint32_t c, uint32_t fog, int level)
+{
+    return (c * (uint32_t)(SHADE_LEVELS - level) + fog * (uint32_t)level + SHADE_LEVELS / 2) / SHADE_LEVELS;
+}
+
+/** Light level of a wall or sprite at distance dist, side adds levels
+ *  for walls facing east or west */
+static inline int r_light(float dist, int side)
+{
+#ifdef SHADING_DISABLED
+    (void)dist;
+    (void)side;
+    return 0;
+#else
+    const int light = (int)(dist * (1.0f / SHADE_DISTANCE)) + side;
+    return r_min(light, SHADE_LEVELS - 1);
+#endif
 }
 
 static void m_rotateVertex(vertex_t* v, const float angleRad)
@@ -5,13 +5,33 @@
 #include <stdbool.h>
 
 /* PROJECT HEADER ----------------------------------------------------------- */
+#include "level.h"
+#include "sector.h"
 
 /* DEFINES ------------------------------------------------------------------ */
 
 #define M_PI_F   3.14159265358979323846264338327950288f
 
-#define MAX_TEXTURES 8 /**<  max. number of textures in texture dictionary */
-#define MAX_SPRITES  8 /**<  max. number of sprites in sprite dictionary */
+#define MAX_TEXTURES 256 /**<  max. number of textures in texture dictionary */
+#define MAX_SPRITES  64 /**<  max. number of sprites in sprite dictionary */
+#define MAX_ENTITIES 512 /**<  max. number of sprites in the game world */
+#define MAX_MIPLEVELS 8 /**<  max. number of mip levels of the texture atlas */
+#define PALETTE_SIZE 256 /**<  number of entries in the shared palette */
+#define TEXTURE_NO_SPANS 0xffffffffu /**< texture_t.spans of textures without span table */
+
+/* Stages of r_render that r_stats_t.cycles breaks the frame time down to */
+#define R_ZONE_SETUP   0 /**< camera, tables, background */
+#define R_ZONE_WALLS   1 /**< raycasting and wall columns, or the whole sector world */
+#define R_ZONE_PLANES  2 /**< textured floor and ceiling */
+#define R_ZONE_SPRITES 3 /**< sprites and the see-through walls behind them */
+#define R_ZONE_GLASS   4 /**< see-through walls in front of all sprites */
+#define R_ZONES        5
+
+/* Texel formats */
+#define TEXTURE_ARGB8888 0 /**< 32 bit ARGB, alpha 0 is transparent */
+#define TEXTURE_RGB565   1 /**< 16 bit RGB, magenta (0xf81f) is transparent */
+#define TEXTURE_L8       2 /**< 8 bit luminance */
+#define TEXTURE_I8       3 /**< 8 bit index into the shared palette, index 0 is transparent */
 
 #define WIDTH 240 /**< framebuffer width in pixel */
 #define HEIGHT 320 /**< framebuffer height in pixel */
@@ -37,36 +57,112 @@ typedef struct
     float e; /**< East  */
 } vertex_t;
 
+/** Sprite in the game world, drawn as a billboard facing the camera */
+typedef struct
+{
+    vertex_t pos;     /**< position in the world */
+    uint16_t texture; /**< index in sprite dictionary */
+} sprite_t;
+
 typedef struct
 {
     vertex_t player_pos; /**< Player position in the world */
     vertex_t player_dir; /**< Player view direction vector */
 
-    uint8_t* level;
-    int level_width;
-    int level_height;
+    level_t level; /**< level map with resident chunk cache */
+    const sector_map_t* sectors; /**< sector world, replaces level if not NULL */
+    int sector; /**< sector of the player in sectors */
+
+    sprite_t sprites[MAX_ENTITIES]; /**< call r_invalidate after changing sprites */
+    int      sprite_count;
+
+    uint32_t tick; /**< game time in milliseconds, selects the frames of animated textures */
 } gamestate_t;
 
+/** Texture atlas with mip chain, all wall and sprite textures in one
+ *  contiguous block of memory. Texels are stored column-major, i.e. texel
+ *  (x, y) is at (x * height + y) * bytesperpixel, so that r_drawcolumn
+ *  reads a contiguous block of memory. */
 typedef struct
 {
-    unsigned char* pixels;
     int            width;
     int            height;
-    int            rowlength; /**< = pitch, the number of bytes in a row */
+    int            format; /**< TEXTURE_ARGB8888, TEXTURE_RGB565, TEXTURE_L8 or TEXTURE_I8 */
     int            bytesperpixel;
+    int            miplevels; /**< number of valid entries in mip */
+    const unsigned char* mip[MAX_MIPLEVELS]; /**< mip level k is (width >> k) x (height >> k) */
+    const uint32_t* palette; /**< PALETTE_SIZE ARGB8888 colors for TEXTURE_I8 */
+    const uint16_t* spans;   /**< span tables of textures with transparent texels */
+    uint32_t       spancount; /**< number of entries in spans */
+} atlas_t;
+
+/** Texture: rectangle in the texture atlas (mip level 0 texels). Position
+ *  and size are multiples of 2^(miplevels-1) of the atlas, so each mip level
+ *  of the atlas contains the mip levels of all its textures.
+ *
+ *  Textures with transparent texels (sprites) have a span table with the
+ *  runs of opaque texels of every column at every mip level, starting at
+ *  atlas.spans[spans]: first the index of the first run of each column
+ *  (level 0 columns, then level 1 columns, ... plus one end index), then
+ *  the runs as (first row, length) pairs. Indices are relative to the
+ *  start of the table.
+ *
+ *  Animated textures have their frames side by side in the atlas, frame i
+ *  starts at column u + i * width. The frame is selected by the tick of the
+ *  game state when the texels are looked up, so animating a texture copies
+ *  no texels. The span table covers the columns of all frames. */
+typedef struct
+{
+    uint16_t u;      /**< first column */
+    uint16_t v;      /**< first row */
+    uint16_t width;  /**< width of one frame */
+    uint16_t height;
+    uint32_t spans;  /**< span table in atlas_t.spans or TEXTURE_NO_SPANS */
+    uint16_t frames; /**< number of animation frames, 0 or 1 for a still texture */
+    uint16_t period; /**< ticks per animation frame */
 } texture_t;
 
+/** What r_render did for the last frame. Zones are only timed with a
+ *  clock, see r_setclock. */
+typedef struct
+{
+    uint32_t cycles[R_ZONES]; /**< clock ticks spent in each R_ZONE_ */
+    uint32_t rays;    /**< columns raycast, the others reused the last frame */
+    uint32_t walls;   /**< wall slices drawn */
+    uint32_t sprites; /**< sprites in front of the camera, drawn unless hidden by walls */
+    uint32_t blends;  /**< see-through wall slices blended */
+    bool     drawn;   /**< false if the last frame was presented again */
+} r_stats_t;
+
+/** Free running clock (e.g. the CPU cycle counter) to time the zones of
+ *  r_render, wrapping around is fine */
+typedef uint32_t (*r_clock_t)(void);
+
+/** Blend count ARGB8888 pixels of src over dst with the alpha of src, dst
+ *  advances by stride pixels per pixel (a framebuffer column). Used to
+ *  composite see-through walls, see r_setblend. The blend may still run
+ *  when the function returns (e.g. on the DMA2D), but each call has to wait
+ *  for the previous one, and a call with count 0 waits until all blends are
+ *  done. */
+typedef void (*r_blend_t)(uint32_t* dst, int stride, const uint32_t* src, int count);
+
 /* FUNCTION PROTOTYPES ------------------------------------------------------ */
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+atlas_t* r_atlas(void);
 texture_t* r_texture_dict(void);
 texture_t* r_sprite_dict(void);
 
 void g_update(const float dt_sec, const uint8_t* kb, gamestate_t* game);
-void r_render(uint32_t* fb, const gamestate_t* game);
+void g_turn(gamestate_t* game, float angle);
+bool r_render(uint32_t* fb, const gamestate_t* game);
+void r_invalidate(void);
+void r_setblend(r_blend_t blend);
+void r_setclock(r_clock_t clock);
+const r_stats_t* r_stats(void);
 
 #ifdef __cplusplus
 }
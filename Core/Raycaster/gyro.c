@@ -0,0 +1,87 @@
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "gyro.h"
+#include "engine.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/* LOCAL DATA --------------------------------------------------------------- */
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Set up gyro for a sensor with rate_hz samples per second and a
+ *  sensitivity of dps_per_lsb. The first GYRO_CALIBRATION samples are
+ *  taken as the rate at rest. */
+void gyro_init(gyro_t* gyro, float rate_hz, float dps_per_lsb)
+{
+    memset((void*)gyro, 0, sizeof(*gyro));
+    gyro->dt = 1.0f / rate_hz;
+    gyro->scale = dps_per_lsb * M_PI_F / 180.0f;
+}
+
+/** Add a sample to the ring. Returns false and drops the sample if the
+ *  ring is full, i.e. gyro_update was not called for GYRO_RING samples. */
+bool gyro_push(gyro_t* gyro, const gyro_sample_t* sample)
+{
+    const uint32_t head = gyro->head;
+    if (head - gyro->tail >= GYRO_RING)
+    {
+        gyro->dropped++;
+        return false;
+    }
+    volatile gyro_sample_t* dst = &gyro->ring[head % GYRO_RING];
+    dst->x = sample->x;
+    dst->y = sample->y;
+    dst->z = sample->z;
+    gyro->head = head + 1; // publish the sample after it is written
+    return true;
+}
+
+/** Integrate the samples pushed since the last call, e.g. in the interrupt
+ *  that pushed them. While the board is at rest the bias estimate follows
+ *  the rate and nothing is integrated, so the view does not drift. Returns
+ *  the yaw of the samples in radians, positive to the right (see g_turn). */
+float gyro_update(gyro_t* gyro)
+{
+    const uint32_t head = gyro->head;
+    const float still = GYRO_STILL * M_PI_F / 180.0f / gyro->scale; // in LSB
+    const float follow = gyro->dt / GYRO_BIAS_TIME;
+    float yaw = 0.0f;
+
+    for (uint32_t tail = gyro->tail; tail != head; tail++)
+    {
+        const float rate = gyro->ring[tail % GYRO_RING].y;
+        gyro->count++;
+        if (gyro->count <= GYRO_CALIBRATION)
+        {
+            gyro->bias += (rate - gyro->bias) / (float)gyro->count; // mean of the samples so far
+            continue;
+        }
+        const float turn = rate - gyro->bias;
+        if (fabsf(turn) < still)
+        {
+            gyro->bias += turn * follow;
+            continue;
+        }
+        yaw -= turn * gyro->scale * gyro->dt;
+    }
+    gyro->tail = head; // the samples can be overwritten now
+
+    gyro->yaw = remainderf(gyro->yaw + yaw, 2.0f * M_PI_F); // stays exact while the board turns around
+    return yaw;
+}
+
+/** Turn to the right in radians since the calibration, in [-pi, pi]. The
+ *  change between two calls is the yaw of the samples integrated in between,
+ *  modulo 2 pi. */
+float gyro_yaw(const gyro_t* gyro)
+{
+    return gyro->yaw;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/*
+ * Gyroscope steering. The sensor delivers samples at a fixed rate, the
+ * firmware reads each one by DMA after the data ready interrupt, pushes it
+ * into the ring of a gyro_t and integrates it with gyro_update in the
+ * interrupt of the finished transfer. The game loop only reads the yaw with
+ * gyro_yaw and turns the player by its change since the last frame. So the
+ * frame never waits for the sensor, and the turn is proportional to the
+ * rotation of the board instead of a fixed speed.
+ *
+ * Samples are the raw values of the sensor and carry no time, gyro_update
+ * only depends on their order. A stream recorded on the board gives the
+ * same yaw when it is pushed again on the host.
+ */
+#define GYRO_RING        64   /**< samples buffered between two gyro_update calls, power of 2 */
+#define GYRO_CALIBRATION 64   /**< samples at rest after gyro_init that the bias is averaged from */
+#define GYRO_STILL       1.5f /**< rate (deg/s, bias removed) below which the board counts as at rest */
+#define GYRO_BIAS_TIME   4.0f /**< seconds the bias estimate follows the rate at rest with */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Raw rates of one sample, LSB of the sensor */
+typedef struct
+{
+    int16_t x;
+    int16_t y; /**< yaw axis: the board is held upright, positive turns left */
+    int16_t z;
+} gyro_sample_t;
+
+/** Sample ring and yaw integration. The ring has a single producer
+ *  (gyro_push, e.g. an interrupt) and a single consumer (gyro_update), so
+ *  it needs no lock. */
+typedef struct
+{
+    volatile gyro_sample_t ring[GYRO_RING];
+    volatile uint32_t head;    /**< samples pushed, only written by gyro_push */
+    volatile uint32_t tail;    /**< samples taken, only written by gyro_update */
+    volatile uint32_t dropped; /**< samples lost because the ring was full */
+    uint32_t count;  /**< samples taken since gyro_init */
+    float    dt;     /**< seconds per sample */
+    float    scale;  /**< radians/s per LSB */
+    float    bias;   /**< yaw rate at rest in LSB */
+    volatile float yaw; /**< turn to the right since the calibration, radians in [-pi, pi] */
+} gyro_t;
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void gyro_init(gyro_t* gyro, float rate_hz, float dps_per_lsb);
+bool gyro_push(gyro_t* gyro, const gyro_sample_t* sample);
+float gyro_update(gyro_t* gyro);
+float gyro_yaw(const gyro_t* gyro);
+
+#ifdef __cplusplus
+}
+#endif
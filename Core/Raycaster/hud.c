@@ -0,0 +1,392 @@
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "hud.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define HUD_OUTSIDE   0x00000000u /**< outside of the level, fully transparent */
+#define HUD_FLOOR     0x60000000u
+#define HUD_WALL      0xd0c0c0c0u
+#define HUD_LOW       0xd0708070u /**< wall lower than the camera can look over */
+#define HUD_GLASS     0xa080a0d0u
+#define HUD_THIN      0xd08080c0u
+#define HUD_DOOR      0xd0c08040u
+#define HUD_DOOR_OPEN 0x80c08040u
+#define HUD_PLAYER    0xffff4040u
+#define HUD_TEXT_BACK 0x80000000u /**< cells of the performance panel text */
+#define HUD_GRAPH_BACK   0x80000000u
+#define HUD_GRAPH_OK     0xc040ff40u /**< frame within the budget */
+#define HUD_GRAPH_SLOW   0xc0ff4040u /**< frame over the budget */
+#define HUD_GRAPH_BUDGET 0xc0ffffffu
+
+/* LOCAL DATA --------------------------------------------------------------- */
+static hud_blit_t g_blit; /**< blends glyphs into a layer, NULL: hud_blend */
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+static uint32_t hud_cellcolor(const level_t* level, int x, int y, int px, int py);
+static void hud_fill(uint32_t* dst, int stride, int width, int height, uint32_t color);
+static void hud_blend(uint32_t* dst, int stride, const uint8_t* src, int width, int height, uint32_t color);
+static void hud_graphcolumn(const hud_perf_t* perf, int column, int frame_ms);
+static int hud_tenths(const hud_perf_t* perf, uint32_t cycles);
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Set up a layer of width x height pixels that is shown at (x, y) on
+ *  screen. The layer starts out transparent. */
+void hud_layerinit(hud_layer_t* layer, uint32_t* pixels, int x, int y, int width, int height)
+{
+    layer->pixels = pixels;
+    layer->x = x;
+    layer->y = y;
+    layer->width = width;
+    layer->height = height;
+    memset(pixels, 0, (size_t)width * height * sizeof(uint32_t));
+}
+
+/** Set up a minimap (HUD_MAP_SIZE x HUD_MAP_SIZE pixels) at (x, y) of layer */
+void hud_mapinit(hud_minimap_t* map, const hud_layer_t* layer, int x, int y)
+{
+    map->layer = layer;
+    map->x = x;
+    map->y = y;
+    map->valid = false;
+    map->level = NULL;
+}
+
+/** Update the minimap for the current player position and level state.
+ *  Nothing is done until the player enters another cell or the level
+ *  changes (e.g. a door moves), then only the cells that look different are
+ *  drawn. The map scrolls by half its size when the player comes within
+ *  HUD_MAP_MARGIN cells of the edge. Sector worlds have no minimap.
+ *  Returns true if the layer changed. */
+bool hud_map(hud_minimap_t* map, const gamestate_t* game)
+{
+    const level_t* level = &game->level;
+    const int px = (int)floorf(game->player_pos.e);
+    const int py = (int)floorf(game->player_pos.n);
+
+    if (game->sectors || level->cells == NULL)
+        return false;
+    if (map->valid && px == map->px && py == map->py && level->cells == map->level &&
+        level->revision == map->revision)
+        return false;
+
+    if (!map->valid || px < map->x0 + HUD_MAP_MARGIN || px >= map->x0 + HUD_MAP_CELLS - HUD_MAP_MARGIN)
+    {
+        map->x0 = px - HUD_MAP_CELLS / 2;
+    }
+    if (!map->valid || py < map->y0 + HUD_MAP_MARGIN || py >= map->y0 + HUD_MAP_CELLS - HUD_MAP_MARGIN)
+    {
+        map->y0 = py - HUD_MAP_CELLS / 2;
+    }
+
+    bool changed = false;
+    for (int row = 0; row < HUD_MAP_CELLS; row++)
+    {
+        const int y = map->y0 + HUD_MAP_CELLS - 1 - row; // north up
+        for (int col = 0; col < HUD_MAP_CELLS; col++)
+        {
+            const uint32_t color = hud_cellcolor(level, map->x0 + col, y, px, py);
+            uint32_t* shown = &map->color[row * HUD_MAP_CELLS + col];
+            if (map->valid && *shown == color)
+                continue;
+            *shown = color;
+            changed = true;
+
+            const hud_layer_t* layer = map->layer;
+            hud_fill(&layer->pixels[(map->y + row * HUD_MAP_CELL) * layer->width + map->x + col * HUD_MAP_CELL],
+                     layer->width, HUD_MAP_CELL, HUD_MAP_CELL, color);
+        }
+    }
+
+    map->valid = true;
+    map->px = px;
+    map->py = py;
+    map->level = level->cells;
+    map->revision = level->revision;
+    return changed;
+}
+
+/** Blend layer over fb with the alpha of its pixels, like the LTDC blends
+ *  its second layer over the first one. For the host, where there is no
+ *  LTDC, e.g. before presenting or saving a frame. */
+void hud_composite(uint32_t* fb, const hud_layer_t* layer)
+{
+    const int x0 = r_max(layer->x, 0), x1 = r_min(layer->x + layer->width, WIDTH);
+    const int y0 = r_max(layer->y, 0), y1 = r_min(layer->y + layer->height, HEIGHT);
+
+    for (int y = y0; y < y1; y++)
+    {
+        const uint32_t* src = &layer->pixels[(y - layer->y) * layer->width];
+        for (int x = x0; x < x1; x++)
+        {
+            const uint32_t s = src[x - layer->x], d = fb[y * WIDTH + x];
+            const uint32_t a = (s >> 24) + (s >> 31); // 0 .. 256, opaque covers d
+            const uint32_t rb = ((s & 0xff00ff) * a + (d & 0xff00ff) * (256 - a)) >> 8;
+            const uint32_t g = ((s & 0x00ff00) * a + (d & 0x00ff00) * (256 - a)) >> 8;
+            fb[y * WIDTH + x] = 0xff000000 | (rb & 0xff00ff) | (g & 0x00ff00);
+        }
+    }
+}
+
+/** Bytes of glyphs hud_fontinit expands a font of width x height to */
+uint32_t hud_fontsize(int width, int height)
+{
+    return (uint32_t)(HUD_GLYPH_COUNT * width * height);
+}
+
+/** Expand the 1 bit glyphs of a font (like Utilities/Fonts: rows of
+ *  (width + 7) / 8 bytes, most significant bit left, characters ' ' to '~')
+ *  to A8 cells in buf (hud_fontsize bytes) */
+void hud_fontinit(hud_font_t* font, uint8_t* buf, const uint8_t* table, int width, int height)
+{
+    const int pitch = (width + 7) / 8;
+    for (int g = 0; g < HUD_GLYPH_COUNT; g++)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            const uint8_t* row = &table[(g * height + y) * pitch];
+            for (int x = 0; x < width; x++)
+            {
+                buf[(g * height + y) * width + x] = (row[x >> 3] & (0x80 >> (x & 7))) ? 0xff : 0x00;
+            }
+        }
+    }
+    font->width = width;
+    font->height = height;
+    font->glyphs = buf;
+}
+
+/** Set up a text at (x, y) of layer, drawn in color (RGB) on cells of
+ *  background (ARGB8888, e.g. translucent black). The text is empty. */
+void hud_textinit(hud_text_t* text, const hud_layer_t* layer, const hud_font_t* font, int x, int y,
+                  uint32_t color, uint32_t background)
+{
+    text->layer = layer;
+    text->font = font;
+    text->x = x;
+    text->y = y;
+    text->color = color & 0xffffff;
+    text->background = background;
+    memset(text->shown, 0, sizeof(text->shown));
+}
+
+/** Show str (up to HUD_TEXT_LENGTH characters, cut at the layer edge).
+ *  Only the glyph cells that differ from the text shown so far are drawn,
+ *  so an unchanged text costs a string compare. Returns true if the layer
+ *  changed. */
+bool hud_text(hud_text_t* text, const char* str)
+{
+    const hud_layer_t* layer = text->layer;
+    const hud_font_t* font = text->font;
+    const hud_blit_t blit = g_blit ? g_blit : hud_blend;
+    const int cells = r_min(HUD_TEXT_LENGTH, (layer->width - text->x) / font->width);
+    bool changed = false;
+    bool end = false; // past the end of str
+
+    if (text->y < 0 || text->y + font->height > layer->height)
+        return false;
+    for (int i = 0; i < cells; i++)
+    {
+        end = end || str[i] == '\0';
+        const char c = end ? '\0' : str[i];
+        if (c == text->shown[i])
+        {
+            if (c == '\0')
+                break; // the rest is empty as well
+            continue;
+        }
+        text->shown[i] = c;
+        changed = true;
+
+        uint32_t* dst = &layer->pixels[text->y * layer->width + text->x + i * font->width];
+        hud_fill(dst, layer->width, font->width, font->height, c == '\0' ? 0 : text->background);
+        const int g = c - HUD_GLYPH_FIRST;
+        if (g > 0 && g < HUD_GLYPH_COUNT) // a space has no pixels to blend
+        {
+            blit(dst, layer->width, &font->glyphs[g * font->width * font->height],
+                 font->width, font->height, text->color);
+        }
+    }
+    if (changed)
+    {
+        blit(NULL, 0, NULL, 0, 0, 0);
+    }
+    return changed;
+}
+
+/** Set the function that blends glyphs into a layer, e.g. with the DMA2D.
+ *  NULL selects the software blend. */
+void hud_setblit(hud_blit_t blit)
+{
+    g_blit = blit;
+}
+
+/** Height of the performance panel in pixels with font */
+int hud_perfheight(const hud_font_t* font)
+{
+    return HUD_PERF_GRAPH + 2 + HUD_PERF_LINES * font->height;
+}
+
+/** Set up a performance panel (HUD_PERF_FRAMES pixels wide, hud_perfheight
+ *  high) at (x, y) of layer, which has to fit into the layer. clock_khz converts the r_stats_t cycles to
+ *  time, budget (ms) is marked in the graph. */
+void hud_perfinit(hud_perf_t* perf, const hud_layer_t* layer, const hud_font_t* font, int x, int y,
+                  uint32_t clock_khz, int budget)
+{
+    perf->layer = layer;
+    perf->x = x;
+    perf->y = y;
+    perf->clock_khz = clock_khz;
+    perf->budget = budget;
+    perf->column = 0;
+    perf->frames = 0;
+    perf->frame_ms = 0.0f;
+    memset(&perf->sum, 0, sizeof(perf->sum));
+    for (int i = 0; i < HUD_PERF_LINES; i++)
+    {
+        hud_textinit(&perf->line[i], layer, font, x, y + HUD_PERF_GRAPH + 2 + i * font->height,
+                     0xffffff, HUD_TEXT_BACK);
+    }
+    for (int column = 0; column < HUD_PERF_FRAMES; column++)
+    {
+        hud_graphcolumn(perf, column, 0);
+    }
+}
+
+/** Add a frame of frame_ms, for which r_render returned stats, to the
+ *  performance panel. The graph gets a column per frame, the numbers are
+ *  updated every HUD_PERF_AVERAGE frames (ms per zone and frame, counts per
+ *  frame). Returns true if the layer changed. */
+bool hud_perf(hud_perf_t* perf, float frame_ms, const r_stats_t* stats)
+{
+    hud_graphcolumn(perf, perf->column, (int)lroundf(frame_ms));
+    perf->column = (perf->column + 1) % HUD_PERF_FRAMES;
+    hud_graphcolumn(perf, perf->column, -1); // gap in front of the newest frame
+
+    perf->frame_ms += frame_ms;
+    for (int i = 0; i < R_ZONES; i++)
+    {
+        perf->sum.cycles[i] += stats->cycles[i];
+    }
+    perf->sum.rays += stats->rays;
+    perf->sum.walls += stats->walls;
+    perf->sum.sprites += stats->sprites;
+    perf->sum.blends += stats->blends;
+    if (++perf->frames < HUD_PERF_AVERAGE)
+        return true;
+
+    const r_stats_t* s = &perf->sum;
+    const int n = perf->frames;
+    const int setup = hud_tenths(perf, s->cycles[R_ZONE_SETUP]);
+    const int walls = hud_tenths(perf, s->cycles[R_ZONE_WALLS]);
+    const int planes = hud_tenths(perf, s->cycles[R_ZONE_PLANES]);
+    const int sprites = hud_tenths(perf, s->cycles[R_ZONE_SPRITES]);
+    const int glass = hud_tenths(perf, s->cycles[R_ZONE_GLASS]);
+    const int frame = (int)lroundf(perf->frame_ms * 10.0f / n);
+    char str[HUD_PERF_LINES][64]; // cut to HUD_TEXT_LENGTH by hud_text
+    snprintf(str[0], sizeof(str[0]), "set%3d.%d wal%3d.%d", setup / 10, setup % 10, walls / 10, walls % 10);
+    snprintf(str[1], sizeof(str[1]), "pln%3d.%d spr%3d.%d", planes / 10, planes % 10, sprites / 10, sprites % 10);
+    snprintf(str[2], sizeof(str[2]), "gls%3d.%d frm%3d.%d", glass / 10, glass % 10, frame / 10, frame % 10);
+    snprintf(str[3], sizeof(str[3]), "ray%5u hit%5u", (unsigned)(s->rays / n), (unsigned)(s->walls / n));
+    snprintf(str[4], sizeof(str[4]), "obj%5u bln%5u", (unsigned)(s->sprites / n), (unsigned)(s->blends / n));
+    for (int i = 0; i < HUD_PERF_LINES; i++)
+    {
+        hud_text(&perf->line[i], str[i]);
+    }
+
+    perf->frames = 0;
+    perf->frame_ms = 0.0f;
+    memset(&perf->sum, 0, sizeof(perf->sum));
+    return true;
+}
+
+/** Color of cell (x, y) on the minimap, the player is in cell (px, py) */
+static uint32_t hud_cellcolor(const level_t* level, int x, int y, int px, int py)
+{
+    if (x == px && y == py)
+        return HUD_PLAYER;
+    if (x < 0 || x >= level->width || y < 0 || y >= level->height)
+        return HUD_OUTSIDE;
+
+    const uint8_t b = lvl_cell(level, x, y);
+    if (b == 0)
+        return HUD_FLOOR;
+    const level_block_t* block = lvl_block(level, b);
+    if (block && block->type == LEVEL_BLOCK_DOOR)
+        return level->door_open[b] > 0 ? HUD_DOOR_OPEN : HUD_DOOR;
+    if (block && block->type == LEVEL_BLOCK_THIN)
+        return HUD_THIN;
+    if (lvl_alpha(level, b) != 0)
+        return HUD_GLASS;
+    if (lvl_height(level, b) < 1.0f)
+        return HUD_LOW;
+    return HUD_WALL;
+}
+
+/** Draw column of the frame time graph with a bar of frame_ms, -1 for an
+ *  empty column */
+static void hud_graphcolumn(const hud_perf_t* perf, int column, int frame_ms)
+{
+    const hud_layer_t* layer = perf->layer;
+    const int bar = r_min(frame_ms / HUD_PERF_SCALE + (frame_ms >= 0), HUD_PERF_GRAPH); // at least a pixel
+    const int budget = perf->budget / HUD_PERF_SCALE;
+    const uint32_t color = frame_ms > perf->budget ? HUD_GRAPH_SLOW : HUD_GRAPH_OK;
+    uint32_t* dst = &layer->pixels[(perf->y + HUD_PERF_GRAPH - 1) * layer->width + perf->x + column];
+
+    for (int y = 0; y < HUD_PERF_GRAPH; y++, dst -= layer->width) // bottom up
+    {
+        *dst = y < bar ? color : (y == budget && frame_ms >= 0) ? HUD_GRAPH_BUDGET : HUD_GRAPH_BACK;
+    }
+}
+
+/** Average ms per frame of cycles summed up over the frames of perf, in
+ *  tenths of a ms */
+static int hud_tenths(const hud_perf_t* perf, uint32_t cycles)
+{
+    if (perf->clock_khz == 0)
+        return 0;
+    return (int)(((uint64_t)cycles * 10u / perf->clock_khz + perf->frames / 2) / perf->frames);
+}
+
+/** Fill a rectangle of width x height pixels at dst, stride pixels per row */
+static void hud_fill(uint32_t* dst, int stride, int width, int height, uint32_t color)
+{
+    for (int y = 0; y < height; y++, dst += stride)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            dst[x] = color;
+        }
+    }
+}
+
+/** Software hud_blit_t: A8 pixels with color over the ARGB8888 pixels of
+ *  dst, with the result alpha of the DMA2D blending (Porter-Duff over) */
+static void hud_blend(uint32_t* dst, int stride, const uint8_t* src, int width, int height, uint32_t color)
+{
+    for (int y = 0; y < height; y++, dst += stride, src += width)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            const uint32_t a = src[x];
+            if (a == 0)
+                continue;
+            const uint32_t d = dst[x];
+            const uint32_t mult = a * (d >> 24) / 255;
+            const uint32_t out = a + (d >> 24) - mult;
+            uint32_t c = out << 24;
+            for (int shift = 0; shift < 24; shift += 8)
+            {
+                const uint32_t cf = (color >> shift) & 0xff, cb = (d >> shift) & 0xff;
+                c |= ((cf * a + cb * (d >> 24) - cb * mult) / out) << shift;
+            }
+            dst[x] = c;
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "engine.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/*
+ * Overlays (HUD, minimap) are drawn into their own small buffers, not into
+ * the 3D frame. On the target each overlay is a window of the second LTDC
+ * layer, which blends it over the 3D view in hardware while scanning out,
+ * so an overlay costs no CPU time per frame, only when its content
+ * changes. On the host hud_composite does the blending of the LTDC.
+ *
+ * Text is drawn with the glyphs of a font pre-expanded to A8 (8 bit alpha)
+ * cells, which are blended into the layer with a fixed color by a
+ * hud_blit_t (DMA2D memory-to-memory with blending on the target). A text
+ * remembers what it shows, only the glyphs that changed are drawn again.
+ *
+ * The performance panel (hud_perf_t) shows a frame time graph and the
+ * r_stats_t of r_render averaged over HUD_PERF_AVERAGE frames. The graph
+ * is drawn like a sweeping oscilloscope, one column per frame, so the
+ * panel costs two graph columns per frame plus the digits that changed.
+ */
+#define HUD_MAP_CELLS  24 /**< cells per edge of the minimap */
+#define HUD_MAP_CELL   4  /**< pixels per cell */
+#define HUD_MAP_SIZE   (HUD_MAP_CELLS * HUD_MAP_CELL) /**< minimap edge length in pixels */
+#define HUD_MAP_MARGIN 4  /**< cells between the player and the edge before the minimap scrolls */
+#define HUD_GLYPH_FIRST ' ' /**< first character of a font */
+#define HUD_GLYPH_COUNT 95  /**< characters ' ' to '~' */
+#define HUD_TEXT_LENGTH 32  /**< max. characters of a text */
+#define HUD_PERF_FRAMES  128 /**< width of the frame time graph, one column per frame */
+#define HUD_PERF_GRAPH   32  /**< height of the frame time graph in pixels */
+#define HUD_PERF_SCALE   2   /**< milliseconds per pixel of the graph */
+#define HUD_PERF_LINES   5   /**< text lines below the graph */
+#define HUD_PERF_AVERAGE 16  /**< frames the numbers are averaged over */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Overlay buffer: ARGB8888 pixels, row-major like the framebuffer, the
+ *  alpha channel blends it over the 3D view */
+typedef struct
+{
+    uint32_t* pixels; /**< width * height pixels */
+    int x;            /**< position of the left edge on screen */
+    int y;            /**< position of the top edge on screen */
+    int width;
+    int height;
+} hud_layer_t;
+
+/** Top-down map of the cells around the player. Only cells that look
+ *  different than last time are drawn. */
+typedef struct
+{
+    const hud_layer_t* layer;
+    int      x;        /**< position of the left edge in the layer */
+    int      y;        /**< position of the top edge in the layer */
+    bool     valid;    /**< color holds what the layer shows */
+    int      x0;       /**< first cell shown (east) */
+    int      y0;       /**< first cell shown (north), at the bottom edge */
+    int      px;       /**< cell of the player (east) at the last update */
+    int      py;       /**< cell of the player (north) at the last update */
+    const uint8_t* level;
+    uint32_t revision; /**< level revision at the last update */
+    uint32_t color[HUD_MAP_CELLS * HUD_MAP_CELLS]; /**< color of each cell in the layer, row 0 is north */
+} hud_minimap_t;
+
+/** Font with the glyphs expanded to A8, glyph c is width x height bytes
+ *  (row-major) at glyphs + (c - HUD_GLYPH_FIRST) * width * height */
+typedef struct
+{
+    int width;
+    int height;
+    const uint8_t* glyphs;
+} hud_font_t;
+
+/** Text at a fixed position of a layer */
+typedef struct
+{
+    const hud_layer_t* layer;
+    const hud_font_t* font;
+    int      x;        /**< position of the left edge in the layer */
+    int      y;        /**< position of the top edge in the layer */
+    uint32_t color;    /**< RGB color of the glyphs */
+    uint32_t background; /**< ARGB8888 color of the glyph cells */
+    char     shown[HUD_TEXT_LENGTH + 1]; /**< text in the layer */
+} hud_text_t;
+
+/** Performance panel: frame time graph and r_render statistics */
+typedef struct
+{
+    const hud_layer_t* layer;
+    int      x;         /**< position of the left edge in the layer */
+    int      y;         /**< position of the top edge in the layer */
+    uint32_t clock_khz; /**< r_setclock ticks per millisecond */
+    int      budget;    /**< frame time budget in ms, marked in the graph */
+    int      column;    /**< graph column of the next frame */
+    int      frames;    /**< frames summed up in frame_ms and sum */
+    float    frame_ms;
+    r_stats_t sum;
+    hud_text_t line[HUD_PERF_LINES];
+} hud_perf_t;
+
+/** Blend the A8 pixels src (width x height, row-major) with color (RGB)
+ *  over dst, which has stride pixels per row. Like r_blend_t the blit may
+ *  still run when the function returns, each call waits for the previous
+ *  one and a call with height 0 waits until all blits are done. */
+typedef void (*hud_blit_t)(uint32_t* dst, int stride, const uint8_t* src, int width, int height, uint32_t color);
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void hud_layerinit(hud_layer_t* layer, uint32_t* pixels, int x, int y, int width, int height);
+void hud_composite(uint32_t* fb, const hud_layer_t* layer);
+void hud_mapinit(hud_minimap_t* map, const hud_layer_t* layer, int x, int y);
+bool hud_map(hud_minimap_t* map, const gamestate_t* game);
+uint32_t hud_fontsize(int width, int height);
+void hud_fontinit(hud_font_t* font, uint8_t* buf, const uint8_t* table, int width, int height);
+void hud_textinit(hud_text_t* text, const hud_layer_t* layer, const hud_font_t* font, int x, int y,
+                  uint32_t color, uint32_t background);
+bool hud_text(hud_text_t* text, const char* str);
+void hud_setblit(hud_blit_t blit);
+int hud_perfheight(const hud_font_t* font);
+void hud_perfinit(hud_perf_t* perf, const hud_layer_t* layer, const hud_font_t* font, int x, int y,
+                  uint32_t clock_khz, int budget);
+bool hud_perf(hud_perf_t* perf, float frame_ms, const r_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,54 @@
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "input.h"
+#include "engine.h"
+#include "sdl_scancodes.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/* LOCAL DATA --------------------------------------------------------------- */
+static in_touch_t g_touch;
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Report the touch state: down with the position (x, y) in framebuffer
+ *  pixels, or lifted (x and y are ignored) */
+void in_touch(bool down, int x, int y)
+{
+    g_touch.down = down;
+    if (down)
+    {
+        g_touch.x = r_clamp(x, 0, WIDTH - 1);
+        g_touch.y = r_clamp(y, 0, HEIGHT - 1);
+    }
+    g_touch.reports++;
+}
+
+/** Last reported touch state */
+const in_touch_t* in_state(void)
+{
+    return &g_touch;
+}
+
+/** Set the keys of the touch zones in kb (SDL scancodes, see g_update).
+ *  Until the first touch is reported kb is left as it is, e.g. for a demo
+ *  that turns on its own. */
+void in_keys(uint8_t* kb)
+{
+    if (g_touch.reports == 0)
+        return;
+
+    const bool down = g_touch.down;
+    const int col = g_touch.x * IN_ZONES / WIDTH;
+    const int row = g_touch.y * IN_ZONES / HEIGHT;
+    kb[SDL_SCANCODE_W] = down && row == 0;
+    kb[SDL_SCANCODE_S] = down && row == IN_ZONES - 1;
+    kb[SDL_SCANCODE_A] = down && col == 0;
+    kb[SDL_SCANCODE_D] = down && col == IN_ZONES - 1;
+    kb[SDL_SCANCODE_SPACE] = down && row == IN_ZONES / 2 && col == IN_ZONES / 2;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/*
+ * Touch input. The platform reports each change of the touch state with
+ * in_touch: the firmware when the STMPE811 raises its interrupt, a host
+ * build from the mouse or a test script. Once per frame in_keys turns the
+ * last state into the keys of g_update, so the game does not know where
+ * its input comes from.
+ *
+ * The screen is split into IN_ZONES x IN_ZONES zones: the top row walks
+ * forward, the bottom row back, the left column turns left, the right
+ * column right, corners do both. The center zone is the use key.
+ */
+#define IN_ZONES 3 /**< rows and columns of touch zones */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Last reported touch state */
+typedef struct
+{
+    bool     down;    /**< a finger is on the screen */
+    int      x;       /**< position in framebuffer pixels, valid if down */
+    int      y;
+    uint32_t reports; /**< number of in_touch calls so far */
+} in_touch_t;
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void in_touch(bool down, int x, int y);
+const in_touch_t* in_state(void);
+void in_keys(uint8_t* kb);
+
+#ifdef __cplusplus
+}
+#endif
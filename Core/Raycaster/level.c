@@ -0,0 +1,222 @@
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "level.h"
+#include "engine.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/* LOCAL DATA --------------------------------------------------------------- */
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+static int lvl_chunkdim(int cells, int chunk);
+static int lvl_chunkoffset(const level_t* level, int cx, int cy);
+static void lvl_load_chunk(level_t* level, int slot, int chunk);
+static bool lvl_section(uint32_t size, uint32_t offset, uint32_t count, uint32_t elem);
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+bool lvl_init(level_t* level, const uint8_t* cells, int width, int height)
+{
+    const int chunks_x = (width + LEVEL_CHUNK_MASK) >> LEVEL_CHUNK_SHIFT;
+    const int chunks_y = (height + LEVEL_CHUNK_MASK) >> LEVEL_CHUNK_SHIFT;
+
+    if (width < 1 || height < 1 || chunks_x * chunks_y > LEVEL_MAX_CHUNKS)
+        return false;
+
+    level->header = NULL;
+    level->blocks = NULL;
+    level->block_count = 0;
+    level->sprites = NULL;
+    level->sprite_count = 0;
+    level->floor_texture = 0;
+    level->ceiling_texture = 0;
+    level->dist = NULL;
+    level->cells = cells;
+    level->width = width;
+    level->height = height;
+    level->chunks_x = chunks_x;
+    level->chunks_y = chunks_y;
+    memset(level->door_open, 0, sizeof(level->door_open));
+    memset(level->door_move, 0, sizeof(level->door_move));
+    memset(level->door_wait, 0, sizeof(level->door_wait));
+    level->revision = 0;
+    memset(level->slot, LEVEL_NOT_RESIDENT, sizeof(level->slot));
+    for (int i = 0; i < LEVEL_CACHE_SLOTS; i++)
+    {
+        level->slot_chunk[i] = -1;
+    }
+    return true;
+}
+
+/** Use a level file in place. Nothing is parsed or copied, data has to
+ *  stay valid as long as the level is in use.
+ *  Returns false if data is not a valid level file. */
+bool lvl_load(level_t* level, const void* data, uint32_t size)
+{
+    const level_header_t* h = (const level_header_t*)data;
+    const uint8_t* base = (const uint8_t*)data;
+
+    if (size < sizeof(level_header_t) || ((uintptr_t)data & 3) != 0)
+        return false;
+    if (h->magic != LEVEL_MAGIC || h->version != LEVEL_VERSION || h->size > size)
+        return false;
+
+    const uint32_t max_cells = LEVEL_MAX_CHUNKS * LEVEL_CHUNK_SIZE; // per edge, lvl_init checks the chunk count
+    if (h->width > max_cells || h->height > max_cells)
+        return false;
+    const uint32_t cellcount = h->width * h->height;
+    if (!lvl_section(h->size, h->cells_offset, cellcount, 1) ||
+        !lvl_section(h->size, h->blocks_offset, h->block_count, sizeof(level_block_t)) ||
+        (h->dist_offset != 0 && !lvl_section(h->size, h->dist_offset, cellcount, 1)) ||
+        !lvl_section(h->size, h->sprites_offset, h->sprite_count, sizeof(level_sprite_t)) ||
+        ((h->blocks_offset | h->sprites_offset) & 3) != 0 || // all sections are 4 byte aligned, sprites hold floats
+        h->pyramid_levels > LEVEL_MAX_PYRAMID)
+        return false;
+    for (uint32_t k = 1; k <= h->pyramid_levels; k++)
+    {
+        const uint32_t w = (h->width + (1u << k) - 1) >> k;
+        const uint32_t ph = (h->height + (1u << k) - 1) >> k;
+        if (!lvl_section(h->size, h->pyramid_offset[k - 1], w * ph, 1))
+            return false;
+    }
+
+    if (!lvl_init(level, base + h->cells_offset, (int)h->width, (int)h->height))
+        return false;
+    level->header = h;
+    level->blocks = (const level_block_t*)(base + h->blocks_offset);
+    level->block_count = (int)h->block_count;
+    level->sprites = (const level_sprite_t*)(base + h->sprites_offset);
+    level->sprite_count = (int)h->sprite_count;
+    level->floor_texture = (int)h->floor_texture;
+    level->ceiling_texture = (int)h->ceiling_texture;
+    level->dist = h->dist_offset ? base + h->dist_offset : NULL;
+    return true;
+}
+
+/** Occupancy pyramid lookup: true if any cell in the 2^lod x 2^lod block
+ *  containing cell x (east), y (north) is not empty. lod 0 is the cell
+ *  itself. Without pyramid data this is conservative and returns true.
+ *  Rays skip empty blocks with it in levels without a distance field. */
+bool lvl_occupied(const level_t* level, int lod, int x, int y)
+{
+    const int ymap = level->height - 1 - y;
+
+    if (lod == 0)
+        return lvl_cell(level, x, y) != 0;
+    if (!level->header || lod > (int)level->header->pyramid_levels)
+        return true;
+
+    const int w = (level->width + (1 << lod) - 1) >> lod;
+    const uint8_t* p = (const uint8_t*)level->header + level->header->pyramid_offset[lod - 1];
+    return p[(ymap >> lod) * w + (x >> lod)] != 0;
+}
+
+/** True if count elements of elem bytes at offset fit into a file of size
+ *  bytes, without overflowing on the way */
+static bool lvl_section(uint32_t size, uint32_t offset, uint32_t count, uint32_t elem)
+{
+    return offset <= size && count <= (size - offset) / elem;
+}
+
+/** Make sure the chunk the player is in and the neighbouring chunks towards
+ *  the closest chunk borders are resident in the cache.
+ *  e, n: player position (east, north). */
+void lvl_stream(level_t* level, float e, float n)
+{
+    const int x = r_clamp((int)e, 0, level->width - 1);
+    const int ymap = r_clamp(level->height - 1 - (int)n, 0, level->height - 1);
+    const int cx = x >> LEVEL_CHUNK_SHIFT;
+    const int cy = ymap >> LEVEL_CHUNK_SHIFT;
+    int nx = cx + ((x & LEVEL_CHUNK_MASK) < LEVEL_CHUNK_SIZE / 2 ? -1 : 1);
+    int ny = cy + ((ymap & LEVEL_CHUNK_MASK) < LEVEL_CHUNK_SIZE / 2 ? -1 : 1);
+    nx = r_clamp(nx, 0, level->chunks_x - 1);
+    ny = r_clamp(ny, 0, level->chunks_y - 1);
+
+    int wanted[LEVEL_CACHE_SLOTS] = {
+        cy * level->chunks_x + cx, cy * level->chunks_x + nx,
+        ny * level->chunks_x + cx, ny * level->chunks_x + nx };
+
+    /* evict chunks that are no longer needed */
+    for (int s = 0; s < LEVEL_CACHE_SLOTS; s++)
+    {
+        const int chunk = level->slot_chunk[s];
+        bool keep = false;
+        for (int i = 0; i < LEVEL_CACHE_SLOTS; i++)
+        {
+            keep |= (wanted[i] == chunk);
+        }
+        if (chunk >= 0 && !keep)
+        {
+            level->slot[chunk] = LEVEL_NOT_RESIDENT;
+            level->slot_chunk[s] = -1;
+        }
+    }
+
+    /* load missing chunks into free slots */
+    for (int i = 0; i < LEVEL_CACHE_SLOTS; i++)
+    {
+        if (level->slot[wanted[i]] != LEVEL_NOT_RESIDENT)
+            continue;
+        for (int s = 0; s < LEVEL_CACHE_SLOTS; s++)
+        {
+            if (level->slot_chunk[s] < 0)
+            {
+                lvl_load_chunk(level, s, wanted[i]);
+                break;
+            }
+        }
+    }
+}
+
+/** Slow path of lvl_cell and lvl_dist: read directly from the backing
+ *  store of the cells or the distance field. */
+uint8_t lvl_cell_uncached(const level_t* level, const uint8_t* plane, int x, int ymap)
+{
+    const int cx = x >> LEVEL_CHUNK_SHIFT;
+    const int cy = ymap >> LEVEL_CHUNK_SHIFT;
+    const int cw = lvl_chunkdim(level->width, cx);
+    const uint8_t* data = plane + lvl_chunkoffset(level, cx, cy);
+
+    return data[(ymap & LEVEL_CHUNK_MASK) * cw + (x & LEVEL_CHUNK_MASK)];
+}
+
+static int lvl_chunkdim(int cells, int chunk)
+{
+    return r_min(LEVEL_CHUNK_SIZE, cells - chunk * LEVEL_CHUNK_SIZE);
+}
+
+static int lvl_chunkoffset(const level_t* level, int cx, int cy)
+{
+    /* all chunk rows above cy are LEVEL_CHUNK_SIZE cells high and all chunks
+     * left of cx in chunk row cy are LEVEL_CHUNK_SIZE cells wide */
+    const int ch = lvl_chunkdim(level->height, cy);
+    return cy * LEVEL_CHUNK_SIZE * level->width + cx * LEVEL_CHUNK_SIZE * ch;
+}
+
+static void lvl_load_chunk(level_t* level, int slot, int chunk)
+{
+    const int cx = chunk % level->chunks_x;
+    const int cy = chunk / level->chunks_x;
+    const int cw = lvl_chunkdim(level->width, cx);
+    const int ch = lvl_chunkdim(level->height, cy);
+    const int offset = lvl_chunkoffset(level, cx, cy);
+
+    assert(level->slot[chunk] == LEVEL_NOT_RESIDENT);
+    for (int row = 0; row < ch; row++)
+    {
+        memcpy(&level->cache[slot][row * LEVEL_CHUNK_SIZE], &level->cells[offset + row * cw], cw);
+    }
+    if (level->dist)
+    {
+        for (int row = 0; row < ch; row++)
+        {
+            memcpy(&level->dist_cache[slot][row * LEVEL_CHUNK_SIZE], &level->dist[offset + row * cw], cw);
+        }
+    }
+    level->slot[chunk] = (uint8_t)slot;
+    level->slot_chunk[slot] = (int16_t)chunk;
+}
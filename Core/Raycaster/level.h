@@ -0,0 +1,195 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/*
+ * Levels are stored as 64x64 cell chunks (chunk-major) in flash or SDRAM.
+ * A few chunks around the player are kept resident in internal SRAM, so the
+ * DDA in r_raycast only touches the slow backing store for far away cells.
+ *
+ * Chunk (cx, cy) is stored as a cw x ch block with cw = min(64, w - 64*cx)
+ * and ch = min(64, h - 64*cy), i.e. chunks at the east and south border are
+ * cropped. Chunk rows are stored north to south, like the C array maps.
+ * A level that fits into a single chunk is therefore just a plain row-major
+ * array.
+ */
+#define LEVEL_CHUNK_SHIFT  6
+#define LEVEL_CHUNK_SIZE   (1 << LEVEL_CHUNK_SHIFT) /**< chunk edge length in cells */
+#define LEVEL_CHUNK_MASK   (LEVEL_CHUNK_SIZE - 1)
+#define LEVEL_CACHE_SLOTS  4   /**< number of chunks resident in SRAM */
+#define LEVEL_MAX_CHUNKS   256 /**< max. chunks per level (e.g. 16x16 chunks = 1024x1024 cells) */
+#define LEVEL_NOT_RESIDENT 0xff
+
+/*
+ * Binary level file (see tools/levelc.c). All sections are 4 byte aligned
+ * and referenced by byte offsets from the start of the file, so the file can
+ * be used in place from memory-mapped flash or a mmap'd file.
+ */
+#define LEVEL_MAGIC        0x314c564cu /**< "LVL1" */
+#define LEVEL_VERSION      4
+#define LEVEL_MAX_PYRAMID  16 /**< max. number of occupancy pyramid levels */
+#define LEVEL_MAX_BLOCKS   256 /**< number of cell values */
+
+/* Block types (level_block_t.type) */
+#define LEVEL_BLOCK_SOLID  0 /**< wall filling the whole cell */
+#define LEVEL_BLOCK_DOOR   1 /**< sliding door, a plane inside the cell that opens sideways */
+#define LEVEL_BLOCK_THIN   2 /**< thin wall, a plane inside the cell */
+
+/* Plane orientation of doors and thin walls (level_block_t.axis) */
+#define LEVEL_AXIS_E       0 /**< plane at east = const, faces east and west */
+#define LEVEL_AXIS_N       1 /**< plane at north = const, faces north and south */
+
+#define LEVEL_DOOR_OPEN    255 /**< level_t.door_open of a fully open door */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Level file header */
+typedef struct
+{
+    uint32_t magic;          /**< LEVEL_MAGIC */
+    uint32_t version;        /**< LEVEL_VERSION */
+    uint32_t size;           /**< total file size in bytes */
+    uint32_t width;          /**< level width in cells (east) */
+    uint32_t height;         /**< level height in cells (north) */
+    float    spawn_e;        /**< player spawn position (east) */
+    float    spawn_n;        /**< player spawn position (north) */
+    float    spawn_dir_e;    /**< player spawn view direction (east) */
+    float    spawn_dir_n;    /**< player spawn view direction (north) */
+    uint32_t cells_offset;   /**< chunk-major cell data */
+    uint32_t blocks_offset;  /**< block table, one level_block_t per cell value */
+    uint32_t block_count;    /**< number of entries in block table */
+    uint32_t dist_offset;    /**< chunk-major Chebyshev distance to the next wall or 0 */
+    uint32_t pyramid_levels; /**< number of occupancy pyramid levels */
+    uint32_t pyramid_offset[LEVEL_MAX_PYRAMID]; /**< level k: one byte per 2^(k+1) x 2^(k+1) cells */
+    uint32_t sprites_offset; /**< sprite spawn table, one level_sprite_t per sprite */
+    uint32_t sprite_count;   /**< number of entries in sprite spawn table */
+    uint32_t floor_texture;  /**< index in texture dictionary or 0 for a flat floor */
+    uint32_t ceiling_texture; /**< index in texture dictionary or 0 for a flat ceiling */
+} level_header_t;
+
+/** Block table entry: properties of a cell value. Every door has a cell
+ *  value of its own (levelc assigns them), so its state can be looked up
+ *  by cell value. */
+typedef struct
+{
+    uint8_t texture; /**< index in texture dictionary */
+    uint8_t type;    /**< LEVEL_BLOCK_SOLID, LEVEL_BLOCK_DOOR or LEVEL_BLOCK_THIN */
+    uint8_t axis;    /**< LEVEL_BLOCK_DOOR/THIN: LEVEL_AXIS_E or LEVEL_AXIS_N */
+    uint8_t offset;  /**< LEVEL_BLOCK_DOOR/THIN: plane position in the cell in 1/256 */
+    uint8_t height;  /**< wall height in 1/256 of a full wall, 0 for full height */
+    uint8_t alpha;   /**< see-through wall (window, grate): opacity of its texels 1..255, 0 for an opaque wall */
+    uint8_t reserved[2];
+} level_block_t;
+
+/** Sprite spawn table entry */
+typedef struct
+{
+    float    e;       /**< position (east) */
+    float    n;       /**< position (north) */
+    uint32_t texture; /**< index in sprite dictionary */
+} level_sprite_t;
+
+typedef struct
+{
+    const level_header_t* header; /**< level file or NULL for plain cell arrays */
+    const level_block_t* blocks;  /**< block table or NULL */
+    int block_count;
+    const level_sprite_t* sprites; /**< sprite spawn table or NULL */
+    int sprite_count;
+    int floor_texture;            /**< index in texture dictionary or 0 */
+    int ceiling_texture;          /**< index in texture dictionary or 0 */
+    const uint8_t* dist;          /**< chunk-major distance field or NULL */
+    const uint8_t* cells; /**< chunk-major cell data (flash/SDRAM) */
+    int width;            /**< level width in cells (east) */
+    int height;           /**< level height in cells (north) */
+    int chunks_x;         /**< number of chunks in east direction */
+    int chunks_y;         /**< number of chunks in north direction */
+
+    uint8_t door_open[LEVEL_MAX_BLOCKS];   /**< open fraction of door by cell value, 0 .. LEVEL_DOOR_OPEN */
+    int8_t  door_move[LEVEL_MAX_BLOCKS];   /**< door is opening (1), closing (-1) or not moving (0) */
+    float   door_wait[LEVEL_MAX_BLOCKS];   /**< seconds an open door stays open */
+    uint32_t revision;                     /**< incremented when a door moves */
+
+    uint8_t slot[LEVEL_MAX_CHUNKS];        /**< chunk index -> cache slot */
+    int16_t slot_chunk[LEVEL_CACHE_SLOTS]; /**< cache slot -> chunk index or -1 */
+    uint8_t cache[LEVEL_CACHE_SLOTS][LEVEL_CHUNK_SIZE * LEVEL_CHUNK_SIZE];
+    uint8_t dist_cache[LEVEL_CACHE_SLOTS][LEVEL_CHUNK_SIZE * LEVEL_CHUNK_SIZE];
+} level_t;
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool lvl_init(level_t* level, const uint8_t* cells, int width, int height);
+bool lvl_load(level_t* level, const void* data, uint32_t size);
+bool lvl_occupied(const level_t* level, int lod, int x, int y);
+void lvl_stream(level_t* level, float e, float n);
+uint8_t lvl_cell_uncached(const level_t* level, const uint8_t* data, int x, int ymap);
+
+/** Return cell at position x (east) and y (north). The caller has to make
+ *  sure that x and y are inside the map. */
+static inline uint8_t lvl_cell(const level_t* level, int x, int y)
+{
+    const int ymap = level->height - 1 - y;
+    const int chunk = (ymap >> LEVEL_CHUNK_SHIFT) * level->chunks_x + (x >> LEVEL_CHUNK_SHIFT);
+    const uint8_t s = level->slot[chunk];
+
+    if (s != LEVEL_NOT_RESIDENT)
+    {
+        return level->cache[s][(ymap & LEVEL_CHUNK_MASK) * LEVEL_CHUNK_SIZE + (x & LEVEL_CHUNK_MASK)];
+    }
+    return lvl_cell_uncached(level, level->cells, x, ymap);
+}
+
+/** Return Chebyshev distance from cell x (east), y (north) to the next
+ *  non-empty cell. Only valid if level->dist is available. */
+static inline uint8_t lvl_dist(const level_t* level, int x, int y)
+{
+    const int ymap = level->height - 1 - y;
+    const int chunk = (ymap >> LEVEL_CHUNK_SHIFT) * level->chunks_x + (x >> LEVEL_CHUNK_SHIFT);
+    const uint8_t s = level->slot[chunk];
+
+    if (s != LEVEL_NOT_RESIDENT)
+    {
+        return level->dist_cache[s][(ymap & LEVEL_CHUNK_MASK) * LEVEL_CHUNK_SIZE + (x & LEVEL_CHUNK_MASK)];
+    }
+    return lvl_cell_uncached(level, level->dist, x, ymap);
+}
+
+/** Block table entry of non-empty cell value b or NULL for a plain solid wall */
+static inline const level_block_t* lvl_block(const level_t* level, uint8_t b)
+{
+    return (b < level->block_count) ? &level->blocks[b] : NULL;
+}
+
+/** Wall height of cell value b as a fraction of a full wall, 0 .. 1 */
+static inline float lvl_height(const level_t* level, uint8_t b)
+{
+    const uint8_t height = (b < level->block_count) ? level->blocks[b].height : 0;
+    return height ? height * (1.0f / 256.0f) : 1.0f;
+}
+
+/** Opacity of the see-through walls of cell value b or 0 for opaque walls */
+static inline int lvl_alpha(const level_t* level, uint8_t b)
+{
+    return (b < level->block_count) ? level->blocks[b].alpha : 0;
+}
+
+/** Index in texture dictionary for cell value b */
+static inline int lvl_texture(const level_t* level, uint8_t b)
+{
+    return (b < level->block_count) ? level->blocks[b].texture : b;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,113 @@
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "lz4.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define LZ4_MIN_MATCH 4
+
+/* LOCAL DATA --------------------------------------------------------------- */
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+static inline bool lz4_length(const uint8_t** ip, const uint8_t* iend, uint32_t* len);
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/*
+ * Decompress a LZ4 block (block format only, no frame header).
+ * Returns the number of bytes written to dst or -1 if src is corrupt or the
+ * output does not fit into dstsize bytes.
+ *
+ * Copies are done in 8 byte chunks with memcpy, which the compiler turns
+ * into unaligned word loads/stores (Cortex-M4 supports unaligned LDR/STR).
+ * The chunked copies may run up to 7 bytes past the end of a literal run or
+ * match, so they are only used when there is enough room left in dst.
+ */
+int32_t lz4_decompress(const uint8_t* src, uint32_t srcsize, uint8_t* dst, uint32_t dstsize)
+{
+    const uint8_t* ip = src;
+    const uint8_t* const iend = src + srcsize;
+    uint8_t* op = dst;
+    uint8_t* const oend = dst + dstsize;
+
+    while (ip < iend)
+    {
+        const uint32_t token = *ip++;
+
+        /* literals */
+        uint32_t len = token >> 4;
+        if (len == 15 && !lz4_length(&ip, iend, &len))
+            return -1;
+        if (len > (uint32_t)(iend - ip) || len > (uint32_t)(oend - op))
+            return -1;
+        if (len <= 16 && iend - ip >= 16 && oend - op >= 16)
+        {
+            memcpy(op, ip, 8); // short run: fixed size copy, no loop
+            memcpy(op + 8, ip + 8, 8);
+        }
+        else
+        {
+            memcpy(op, ip, len);
+        }
+        op += len;
+        ip += len;
+        if (ip == iend)
+            break; // the last sequence has no match
+
+        /* match */
+        if (iend - ip < 2)
+            return -1;
+        const uint32_t offset = ip[0] | ((uint32_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (uint32_t)(op - dst))
+            return -1;
+        len = token & 15;
+        if (len == 15 && !lz4_length(&ip, iend, &len))
+            return -1;
+        len += LZ4_MIN_MATCH;
+        if (len > (uint32_t)(oend - op))
+            return -1;
+
+        const uint8_t* match = op - offset;
+        uint8_t* const end = op + len;
+        if (offset >= 8 && (uint32_t)(oend - op) >= len + 8)
+        {
+            do
+            {
+                memcpy(op, match, 8);
+                op += 8;
+                match += 8;
+            } while (op < end);
+        }
+        else if (offset == 1)
+        {
+            memset(op, *match, len); // run of a single byte
+        }
+        else
+        {
+            while (op < end)
+            {
+                *op++ = *match++;
+            }
+        }
+        op = end;
+    }
+    return (int32_t)(op - dst);
+}
+
+/** Add the extra length bytes following a token nibble of 15 to len */
+static inline bool lz4_length(const uint8_t** ip, const uint8_t* iend, uint32_t* len)
+{
+    uint32_t b;
+    do
+    {
+        if (*ip >= iend)
+            return false;
+        b = *(*ip)++;
+        *len += b;
+    } while (b == 255);
+    return true;
+}
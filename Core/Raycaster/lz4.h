@@ -0,0 +1,16 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int32_t lz4_decompress(const uint8_t* src, uint32_t srcsize, uint8_t* dst, uint32_t dstsize);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,42 @@
+/* Sector world demo: a room, a corridor with steps up and a lower ceiling,
+ * and a hall with a high ceiling, most walls not aligned to the grid */
+#pragma once
+
+#include "sector.h"
+
+static const sector_vertex_t m_plaza_vertices[] = {
+    { 0.0f, 1.0f }, { 1.0f, 0.0f }, { 5.0f, 0.0f }, { 6.0f, 1.0f },  /*  0 ..  3 */
+    { 6.0f, 2.0f }, { 6.0f, 4.0f }, { 6.0f, 5.0f }, { 5.0f, 6.0f },  /*  4 ..  7 */
+    { 1.0f, 6.0f }, { 0.0f, 5.0f }, { 8.0f, 2.0f }, { 8.0f, 4.0f },  /*  8 .. 11 */
+    { 10.0f, 2.0f }, { 11.0f, 5.0f }, { 14.0f, 1.0f }, { 16.0f, 5.0f }, /* 12 .. 15 */
+    { 13.0f, 8.0f },                                                 /* 16 */
+};
+
+static const sector_wall_t m_plaza_walls[] = {
+    /* 0: room */
+    { 0, 1, SECTOR_NONE, 3, 0 }, { 1, 2, SECTOR_NONE, 1, 0 }, { 2, 3, SECTOR_NONE, 3, 0 },
+    { 3, 4, SECTOR_NONE, 1, 0 }, { 4, 5, 1, 3, 0 }, { 5, 6, SECTOR_NONE, 1, 0 },
+    { 6, 7, SECTOR_NONE, 3, 0 }, { 7, 8, SECTOR_NONE, 1, 0 }, { 8, 9, SECTOR_NONE, 3, 0 },
+    { 9, 0, SECTOR_NONE, 1, 0 },
+    /* 1: corridor, one step up */
+    { 4, 10, SECTOR_NONE, 1, 0 }, { 10, 11, 2, 3, 0 }, { 11, 5, SECTOR_NONE, 1, 0 }, { 5, 4, 0, 3, 0 },
+    /* 2: slanted corridor, another step up, low ceiling */
+    { 10, 12, SECTOR_NONE, 3, 0 }, { 12, 13, 3, 3, 0 }, { 13, 11, SECTOR_NONE, 3, 0 }, { 11, 10, 1, 3, 0 },
+    /* 3: hall */
+    { 12, 14, SECTOR_NONE, 1, 0 }, { 14, 15, SECTOR_NONE, 3, 0 }, { 15, 16, SECTOR_NONE, 1, 0 },
+    { 16, 13, SECTOR_NONE, 3, 0 }, { 13, 12, 2, 3, 0 },
+};
+
+static const sector_t m_plaza_sectors[] = {
+    { 0.0f, 1.0f, 0, 10, 4, 5, { 0 } },
+    { 0.2f, 1.4f, 10, 4, 4, 5, { 0 } },
+    { 0.4f, 1.2f, 14, 4, 4, 5, { 0 } },
+    { 0.0f, 2.0f, 18, 5, 4, 0, { 0 } },
+};
+
+static const sector_map_t m_plaza = {
+    m_plaza_vertices, m_plaza_walls, m_plaza_sectors,
+    sizeof(m_plaza_vertices) / sizeof(m_plaza_vertices[0]),
+    sizeof(m_plaza_walls) / sizeof(m_plaza_walls[0]),
+    sizeof(m_plaza_sectors) / sizeof(m_plaza_sectors[0]),
+};
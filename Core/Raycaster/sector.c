@@ -0,0 +1,166 @@
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "sector.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define SECTOR_EPSILON 0.00001f
+
+/* LOCAL DATA --------------------------------------------------------------- */
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+static inline float sec_side(const sector_map_t* map, const sector_wall_t* w, float e, float n);
+static bool sec_passable(const sector_map_t* map, int from, int to);
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Check the indices of a sector world and that all sectors are closed,
+ *  convex and counter-clockwise. Returns false if map is not valid. */
+bool sec_check(const sector_map_t* map)
+{
+    if (map->sector_count < 1 || map->sector_count >= SECTOR_NONE)
+        return false;
+    for (int s = 0; s < map->sector_count; s++)
+    {
+        const sector_t* sector = &map->sectors[s];
+        if (sector->count < 3 || sector->first + sector->count > map->wall_count ||
+            !(sector->ceiling > sector->floor))
+            return false;
+        for (int i = 0; i < sector->count; i++)
+        {
+            const sector_wall_t* w = &map->walls[sector->first + i];
+            const sector_wall_t* next = &map->walls[sector->first + (i + 1) % sector->count];
+            if (w->v0 >= map->vertex_count || w->v1 >= map->vertex_count || w->v1 != next->v0 ||
+                (w->portal != SECTOR_NONE && w->portal >= map->sector_count))
+                return false;
+            const sector_vertex_t* v = &map->vertices[next->v1];
+            if (sec_side(map, w, v->e, v->n) < 0.0f)
+                return false; // the sector turns right, not convex
+        }
+    }
+    return true;
+}
+
+/** True if the point (e, n) is inside or on the border of sector */
+bool sec_inside(const sector_map_t* map, int sector, float e, float n)
+{
+    const sector_t* s = &map->sectors[sector];
+    for (int i = 0; i < s->count; i++)
+    {
+        if (sec_side(map, &map->walls[s->first + i], e, n) < -SECTOR_EPSILON)
+            return false;
+    }
+    return true;
+}
+
+/** Sector that contains the point (e, n) or -1 */
+int sec_find(const sector_map_t* map, float e, float n)
+{
+    for (int s = 0; s < map->sector_count; s++)
+    {
+        if (sec_inside(map, s, e, n))
+            return s;
+    }
+    return -1;
+}
+
+/** Wall through which the ray (e, n) + t * (de, dn) leaves the convex
+ *  sector, t is returned in *t. The ray has to start inside the sector or
+ *  enter it, e.g. through a portal. Of collinear walls (a portal in a
+ *  straight wall) the one that contains the exit point is returned.
+ *  Returns -1 if the ray does not move. */
+int sec_exit(const sector_map_t* map, int sector, float e, float n, float de, float dn, float* t)
+{
+    const sector_t* s = &map->sectors[sector];
+    int exit = -1;
+    bool contained = false; // the exit point is on wall exit
+    float tmin = INFINITY;
+
+    for (int i = s->first; i < s->first + s->count; i++)
+    {
+        const sector_wall_t* w = &map->walls[i];
+        const sector_vertex_t* p0 = &map->vertices[w->v0];
+        const sector_vertex_t* p1 = &map->vertices[w->v1];
+        const float we = p1->e - p0->e, wn = p1->n - p0->n;
+        // the distance to the wall (times its length) decreases by speed per unit of t
+        const float speed = we * dn - wn * de;
+        if (speed >= 0.0f)
+            continue; // the ray moves away from the wall or along it
+        const float ti = sec_side(map, w, e, n) / -speed;
+        if (ti > tmin + SECTOR_EPSILON || (ti >= tmin - SECTOR_EPSILON && contained))
+            continue;
+        const float u = ((e + de * ti - p0->e) * we + (n + dn * ti - p0->n) * wn) / (we * we + wn * wn);
+        const bool on = u >= -SECTOR_EPSILON && u <= 1.0f + SECTOR_EPSILON;
+        if (ti < tmin - SECTOR_EPSILON || on)
+        {
+            tmin = fminf(tmin, ti);
+            exit = i;
+            contained = on;
+        }
+    }
+    *t = fmaxf(tmin, 0.0f);
+    return exit;
+}
+
+/** Move the point (e, n) of sector by (de, dn). Portals are crossed if the
+ *  floor step is low enough and the sector behind them high enough, other
+ *  walls are kept SECTOR_WALL_DIST away, the movement slides along them.
+ *  Returns the sector of the new position. The point stays where it is if
+ *  it gets stuck in a corner. */
+int sec_move(const sector_map_t* map, int sector, float* e, float* n, float de, float dn)
+{
+    for (int i = 0; i < SECTOR_MAX_DEPTH; i++)
+    {
+        float t;
+        const int exit = sec_exit(map, sector, *e, *n, de, dn, &t);
+        if (exit < 0 || t >= 1.0f)
+        {
+            *e += de;
+            *n += dn;
+            break;
+        }
+        const sector_wall_t* w = &map->walls[exit];
+        if (sec_passable(map, sector, w->portal))
+        {
+            sector = w->portal;
+            continue;
+        }
+
+        // stop in front of the wall, slide along it with the rest of the movement
+        const sector_vertex_t* p0 = &map->vertices[w->v0];
+        const sector_vertex_t* p1 = &map->vertices[w->v1];
+        const float len = sqrtf((p1->e - p0->e) * (p1->e - p0->e) + (p1->n - p0->n) * (p1->n - p0->n));
+        const float ue = (p1->e - p0->e) / len, un = (p1->n - p0->n) / len;
+        const float dist = sec_side(map, w, *e, *n) / len;
+        const float speed = ue * dn - un * de; // approach of the wall per unit of movement, < 0
+        const float f = fmaxf(0.0f, (dist - SECTOR_WALL_DIST) / -speed);
+        *e += de * f;
+        *n += dn * f;
+        const float slide = (de * ue + dn * un) * (1.0f - f);
+        de = ue * slide;
+        dn = un * slide;
+    }
+    return sector;
+}
+
+/** Distance of (e, n) to the line through wall w, times the wall length.
+ *  Positive on the left (inside of the sector). */
+static inline float sec_side(const sector_map_t* map, const sector_wall_t* w, float e, float n)
+{
+    const sector_vertex_t* p0 = &map->vertices[w->v0];
+    const sector_vertex_t* p1 = &map->vertices[w->v1];
+    return (p1->e - p0->e) * (n - p0->n) - (p1->n - p0->n) * (e - p0->e);
+}
+
+/** True if the player can walk from sector from into sector to */
+static bool sec_passable(const sector_map_t* map, int from, int to)
+{
+    if (to == SECTOR_NONE)
+        return false;
+    const sector_t* a = &map->sectors[from];
+    const sector_t* b = &map->sectors[to];
+    return b->floor - a->floor <= SECTOR_STEP && b->ceiling - b->floor >= SECTOR_HEADROOM;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/*
+ * Sector world, an alternative to the uniform grid of level_t: convex
+ * sectors bounded by wall segments of any orientation, each with its own
+ * floor and ceiling height. A wall is either solid or a portal into the
+ * neighbouring sector. The renderer walks the portals front to back (see
+ * r_render), so its cost is proportional to the visible geometry.
+ *
+ * The walls of a sector are stored back to back in counter-clockwise order
+ * (seen from above, east to the right and north up), so the inside of the
+ * sector is on the left of each wall. All arrays are const and can be used
+ * in place from flash.
+ */
+#define SECTOR_NONE       0xffff /**< sector_wall_t.portal of a solid wall */
+#define SECTOR_MAX_DEPTH  32     /**< max. portals a ray is followed through */
+#define SECTOR_STEP       0.25f  /**< max. floor step the player can climb */
+#define SECTOR_HEADROOM   0.75f  /**< min. floor to ceiling height the player fits into */
+#define SECTOR_WALL_DIST  0.05f  /**< distance the player keeps from walls */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Corner of a wall */
+typedef struct
+{
+    float e; /**< East  */
+    float n; /**< North */
+} sector_vertex_t;
+
+/** Wall segment from v0 to v1 */
+typedef struct
+{
+    uint16_t v0;      /**< first vertex */
+    uint16_t v1;      /**< second vertex */
+    uint16_t portal;  /**< sector behind the wall or SECTOR_NONE */
+    uint8_t  texture; /**< wall texture, of a portal: texture of the steps up to the floor or down to the ceiling behind it */
+    uint8_t  reserved;
+} sector_wall_t;
+
+/** Convex sector */
+typedef struct
+{
+    float    floor;           /**< floor height in wall heights */
+    float    ceiling;         /**< ceiling height in wall heights */
+    uint16_t first;           /**< first wall */
+    uint16_t count;           /**< number of walls, >= 3 */
+    uint8_t  floor_texture;   /**< 0 for a flat color */
+    uint8_t  ceiling_texture; /**< 0 for a flat color */
+    uint8_t  reserved[2];
+} sector_t;
+
+/** Sector world */
+typedef struct
+{
+    const sector_vertex_t* vertices;
+    const sector_wall_t* walls;
+    const sector_t* sectors;
+    int vertex_count;
+    int wall_count;
+    int sector_count;
+} sector_map_t;
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool sec_check(const sector_map_t* map);
+bool sec_inside(const sector_map_t* map, int sector, float e, float n);
+int sec_find(const sector_map_t* map, float e, float n);
+int sec_exit(const sector_map_t* map, int sector, float e, float n, float de, float dn, float* t);
+int sec_move(const sector_map_t* map, int sector, float* e, float* n, float de, float dn);
+
+#ifdef __cplusplus
+}
+#endif
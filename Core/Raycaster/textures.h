@@ -0,0 +1,1412 @@
+/* Generated from assets/textures/wood1.bmp, assets/textures/stone2.bmp, assets/sprites/ball.png, do not edit */
+#pragma once
+
+#include <stdint.h>
+
+const uint8_t m_textures[22464] __attribute__((aligned(32))) =
+{
+    0x41, 0x50, 0x41, 0x4b, 0x05, 0x00, 0x00, 0x00, 0xc0, 0x57, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x61, 0x74, 0x6c, 0x61, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x00, 0x00, 0x00, 0x36, 0xdc, 0x00, 0x00, 0xd7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x01, 0x80, 0x00, 0x00, 0x03, 0x07, 0x01, 0x52, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x77, 0x6f, 0x6f, 0x64, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x01, 0x03, 0x07, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x73, 0x74, 0x6f, 0x6e, 0x65, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x01, 0x03, 0x07, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x62, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x01, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x17, 0xff, 0x27, 0x3f, 0x37, 0xff, 0x40, 0x40,
+    0x40, 0xff, 0x47, 0x47, 0x47, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x4f, 0x6b, 0x67, 0xff, 0x43, 0x57,
+    0x6f, 0xff, 0x23, 0x43, 0x5f, 0xff, 0x64, 0x64, 0x64, 0xff, 0x4b, 0x6b, 0x83, 0xff, 0x6f, 0x6f,
+    0x6f, 0xff, 0x88, 0xaf, 0xff, 0xff, 0x68, 0x8f, 0xff, 0xff, 0x77, 0x77, 0x77, 0xff, 0x0d, 0x1b,
+    0x3d, 0x08, 0x00, 0x71, 0x63, 0x7b, 0x93, 0xff, 0x27, 0x47, 0x6b, 0x30, 0x00, 0xf1, 0x14, 0x3f,
+    0x5e, 0x76, 0xff, 0x3f, 0x5f, 0x77, 0xff, 0x57, 0x6b, 0x83, 0xff, 0x2f, 0x53, 0x7f, 0xff, 0x41,
+    0x67, 0xe9, 0xff, 0x52, 0x78, 0xfd, 0xff, 0x5b, 0x73, 0x8b, 0xff, 0xb6, 0xde, 0xff, 0xff, 0x4b,
+    0x5f, 0x77, 0x04, 0x00, 0x31, 0x3d, 0x62, 0xe4, 0x38, 0x00, 0x00, 0x04, 0x00, 0xf1, 0x00, 0x6b,
+    0x7f, 0x9b, 0xff, 0x53, 0x77, 0x8f, 0xff, 0x21, 0x43, 0xb4, 0xff, 0x43, 0x6f, 0xab, 0x0c, 0x00,
+    0xf1, 0x28, 0x4d, 0x74, 0xf8, 0xff, 0x49, 0x6f, 0xf3, 0xff, 0x0f, 0x1e, 0x48, 0xff, 0x5f, 0x86,
+    0xff, 0xff, 0x1b, 0x37, 0x4b, 0xff, 0x10, 0x21, 0x50, 0xff, 0x18, 0x30, 0x7d, 0xff, 0xd7, 0xfe,
+    0xff, 0xff, 0x47, 0x73, 0xb3, 0xff, 0x1f, 0x3e, 0xa6, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x27, 0x4a,
+    0xc4, 0xff, 0x9b, 0xc3, 0xff, 0xff, 0x3b, 0x3b, 0x3b, 0x04, 0x00, 0xb1, 0x18, 0x30, 0x40, 0xff,
+    0x39, 0x5e, 0xdf, 0xff, 0x13, 0x27, 0x63, 0x6c, 0x00, 0xf1, 0x20, 0x3f, 0x6b, 0xa3, 0xff, 0x1e,
+    0x3c, 0xa0, 0xff, 0x20, 0x20, 0x20, 0xff, 0x0f, 0x23, 0x2b, 0xff, 0x3f, 0x53, 0x67, 0xff, 0x57,
+    0x57, 0x57, 0xff, 0x1b, 0x37, 0x92, 0xff, 0xed, 0xff, 0xff, 0xff, 0x0b, 0x17, 0x1f, 0xff, 0x33,
+    0x43, 0x57, 0xff, 0x1b, 0x33, 0x43, 0xff, 0x37, 0x5f, 0x8f, 0x04, 0x01, 0x71, 0x78, 0x9f, 0xff,
+    0xff, 0x5b, 0x5b, 0x5b, 0x50, 0x00, 0x00, 0x18, 0x00, 0x32, 0x3b, 0x57, 0x53, 0x08, 0x00, 0x03,
+    0x64, 0x00, 0x00, 0x04, 0x00, 0x31, 0x2f, 0x53, 0xd1, 0x08, 0x00, 0x39, 0x1f, 0x3f, 0x53, 0x04,
+    0x00, 0x71, 0x2b, 0x47, 0x3f, 0xff, 0x7f, 0x7f, 0x7f, 0x1c, 0x01, 0x31, 0x1b, 0x1b, 0x1b, 0x84,
+    0x00, 0x00, 0x4c, 0x00, 0x00, 0xec, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x04, 0x14, 0x00,
+    0x04, 0x0c, 0x00, 0xf9, 0x00, 0xc7, 0xee, 0xff, 0xff, 0x12, 0x24, 0x59, 0xff, 0xa6, 0xcd, 0xff,
+    0xff, 0x33, 0x57, 0x87, 0x04, 0x00, 0xf1, 0x00, 0x1b, 0x36, 0x4a, 0xff, 0x15, 0x2b, 0x6e, 0xff,
+    0x0a, 0x14, 0x28, 0xff, 0x63, 0x63, 0x63, 0x6c, 0x01, 0x31, 0x2f, 0x3f, 0x53, 0x04, 0x00, 0x01,
+    0xa0, 0x00, 0x21, 0x1b, 0x1b, 0x18, 0x00, 0x00, 0x0c, 0x00, 0x71, 0x0f, 0x33, 0x17, 0xff, 0x4f,
+    0x63, 0x7b, 0x04, 0x00, 0x04, 0x14, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x2c, 0x00, 0x31, 0x59, 0x7f,
+    0xff, 0xc4, 0x00, 0x04, 0x04, 0x00, 0xf5, 0x04, 0x0f, 0x1f, 0x4b, 0xff, 0x13, 0x2b, 0x33, 0xff,
+    0x22, 0x3a, 0x4e, 0xff, 0x0a, 0x15, 0x24, 0xff, 0x17, 0x2f, 0x3f, 0x04, 0x00, 0xf1, 0x04, 0x0e,
+    0x1c, 0x41, 0xff, 0x1a, 0x34, 0x88, 0xff, 0x4e, 0x62, 0x7a, 0xff, 0x2b, 0x47, 0x5b, 0xff, 0x23,
+    0x23, 0x23, 0x38, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x01, 0x00, 0xe4, 0x00, 0x31, 0x13, 0x26,
+    0x5f, 0x50, 0x01, 0x0c, 0x04, 0x00, 0x08, 0x64, 0x00, 0x04, 0x68, 0x00, 0x00, 0x34, 0x00, 0x31,
+    0x21, 0x3d, 0x51, 0x10, 0x00, 0x00, 0x44, 0x00, 0xf2, 0x13, 0x92, 0xb9, 0xff, 0xff, 0xf5, 0xff,
+    0xff, 0xff, 0x34, 0x59, 0xd9, 0xff, 0x0e, 0x1c, 0x42, 0xff, 0x0e, 0x1d, 0x44, 0xff, 0x0e, 0x1d,
+    0x43, 0xff, 0x24, 0x46, 0xbc, 0xff, 0x1d, 0x3a, 0x9a, 0xff, 0x7f, 0xa6, 0xf4, 0x01, 0x00, 0x04,
+    0x00, 0x35, 0x12, 0x25, 0x5c, 0x98, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x14, 0x00, 0x04, 0x48, 0x02,
+    0x00, 0x04, 0x00, 0x00, 0xac, 0x02, 0xf2, 0x08, 0x37, 0x4b, 0x5f, 0xff, 0x33, 0x52, 0x66, 0xff,
+    0x33, 0x57, 0x86, 0xff, 0x46, 0x6c, 0xef, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x20, 0x40, 0xad, 0x90,
+    0x00, 0x21, 0x1b, 0x1b, 0x04, 0x00, 0x00, 0xe8, 0x01, 0x22, 0x4b, 0x4b, 0x8c, 0x00, 0x00, 0xe4,
+    0x01, 0x04, 0x44, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x04, 0x38, 0x00, 0x39, 0x57, 0x73, 0x6f, 0x04,
+    0x00, 0x31, 0x23, 0x3b, 0x4f, 0x04, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x78, 0x00, 0x35, 0x0a, 0x15,
+    0x2d, 0x60, 0x00, 0x04, 0x04, 0x00, 0x00, 0x5c, 0x00, 0x05, 0x0c, 0x01, 0x21, 0x1b, 0x1b, 0x2c,
+    0x00, 0x00, 0xa8, 0x00, 0x35, 0x0c, 0x19, 0x37, 0x1c, 0x00, 0x31, 0x47, 0x63, 0x5b, 0x0c, 0x00,
+    0x00, 0x8c, 0x00, 0xe0, 0x11, 0x23, 0x55, 0xff, 0xad, 0xd4, 0xff, 0xff, 0x70, 0x97, 0xff, 0xff,
+    0xcf, 0xf7, 0x90, 0x02, 0xf1, 0x0a, 0x32, 0xff, 0x14, 0x29, 0x69, 0xff, 0x13, 0x13, 0x13, 0xff,
+    0x43, 0x43, 0x43, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x55, 0x69, 0x81, 0xff, 0x33, 0x53, 0x67, 0x04,
+    0x00, 0x00, 0x00, 0x02, 0x04, 0xfc, 0x00, 0xf1, 0x14, 0x42, 0x5f, 0x77, 0xff, 0xbc, 0xe4, 0xff,
+    0xff, 0x37, 0x37, 0x37, 0xff, 0x2a, 0x4e, 0xca, 0xff, 0xa2, 0xca, 0xff, 0xff, 0x16, 0x2d, 0x75,
+    0xff, 0x2b, 0x4f, 0x77, 0xff, 0x30, 0x49, 0x5d, 0xff, 0x27, 0x27, 0x27, 0x70, 0x00, 0x31, 0x0e,
+    0x1f, 0x2d, 0x00, 0x01, 0x04, 0x04, 0x00, 0xf2, 0x22, 0x11, 0x14, 0x16, 0xff, 0x2a, 0x4a, 0x6a,
+    0xff, 0x3d, 0x43, 0x3c, 0xf8, 0x6e, 0x42, 0x83, 0x58, 0x01, 0x01, 0x01, 0x58, 0x58, 0x01, 0x01,
+    0x41, 0x80, 0x80, 0x80, 0x3c, 0x80, 0x80, 0x83, 0x43, 0x80, 0x80, 0x8a, 0x41, 0x58, 0x41, 0x41,
+    0x41, 0x41, 0x3c, 0x58, 0x3c, 0x80, 0x3c, 0x3c, 0x83, 0x43, 0x01, 0x00, 0xf0, 0x03, 0x30, 0x80,
+    0x80, 0x80, 0x83, 0x83, 0x3c, 0x3c, 0x80, 0x80, 0x30, 0x80, 0x83, 0x3c, 0xe7, 0x58, 0x3c, 0x3c,
+    0x35, 0x00, 0xff, 0x0c, 0x58, 0x41, 0x01, 0x41, 0xf8, 0x43, 0x80, 0x3c, 0x3c, 0x41, 0x3c, 0x3c,
+    0x3c, 0x80, 0x3c, 0x58, 0x3c, 0x3c, 0x3c, 0x58, 0x3c, 0x41, 0x58, 0x58, 0x3c, 0x58, 0x41, 0x58,
+    0x00, 0x0a, 0xf0, 0x26, 0x3d, 0x43, 0x3c, 0x3d, 0x43, 0x3c, 0x80, 0x6e, 0x4a, 0x3c, 0x3c, 0x07,
+    0x4a, 0x4a, 0x05, 0x05, 0x04, 0x04, 0x04, 0x05, 0x07, 0x07, 0x1c, 0x1c, 0x1c, 0x07, 0x3d, 0x05,
+    0x05, 0x4a, 0x05, 0x04, 0x04, 0x4a, 0x05, 0x05, 0x4a, 0x3d, 0x4a, 0x4a, 0x04, 0x4a, 0x4a, 0x47,
+    0x07, 0x07, 0x07, 0x47, 0x3d, 0x07, 0x4a, 0x05, 0x05, 0x27, 0x00, 0x00, 0x2d, 0x00, 0x20, 0x05,
+    0x4a, 0x19, 0x00, 0x62, 0x07, 0x47, 0x07, 0x47, 0x07, 0x4a, 0x0c, 0x00, 0x50, 0x3d, 0x07, 0x1c,
+    0x1c, 0x07, 0x39, 0x00, 0xbf, 0x3d, 0x07, 0x07, 0x07, 0x3d, 0x4a, 0x05, 0x3d, 0x3d, 0x05, 0x07,
+    0x58, 0x00, 0x0a, 0xf1, 0x05, 0x3d, 0x43, 0x3c, 0x75, 0x07, 0x80, 0x83, 0xb2, 0x3d, 0x89, 0x83,
+    0x83, 0x43, 0xf8, 0x3c, 0x3c, 0xf8, 0xf8, 0xf8, 0x41, 0xeb, 0x00, 0x80, 0x83, 0xf8, 0xf8, 0x43,
+    0xf2, 0x80, 0xf8, 0x80, 0x0f, 0x00, 0x10, 0x3c, 0x01, 0x00, 0xf0, 0x00, 0x41, 0x3c, 0x83, 0x83,
+    0x43, 0x43, 0x3c, 0xf8, 0x41, 0xf8, 0x83, 0x43, 0x3c, 0xf8, 0x43, 0x2a, 0x00, 0x00, 0x01, 0x00,
+    0xa0, 0x83, 0x3c, 0x3c, 0xf8, 0x3c, 0x41, 0x43, 0x3c, 0x43, 0x43, 0x09, 0x00, 0x80, 0x3c, 0x41,
+    0xf8, 0x6e, 0x89, 0x3d, 0x07, 0x6e, 0x2b, 0x00, 0x8f, 0xf2, 0x6e, 0x43, 0x3c, 0x3c, 0x83, 0xf8,
+    0xf8, 0x58, 0x00, 0x0a, 0xb1, 0x75, 0x07, 0x80, 0x3d, 0x2a, 0x80, 0x80, 0x42, 0x06, 0x89, 0x80,
+    0x52, 0x00, 0x10, 0x41, 0x4e, 0x00, 0x00, 0x45, 0x01, 0x00, 0x5b, 0x00, 0x30, 0xf8, 0xf8, 0xf2,
+    0x05, 0x00, 0x50, 0xf8, 0x43, 0x83, 0x83, 0x3c, 0x73, 0x01, 0x71, 0xf8, 0x83, 0x83, 0xf8, 0xf8,
+    0x3c, 0x80, 0x73, 0x00, 0x11, 0x3c, 0x23, 0x00, 0xe0, 0xf8, 0x3c, 0xf8, 0xf8, 0x43, 0xf8, 0x3c,
+    0x80, 0xf2, 0x43, 0x2a, 0x6e, 0x6e, 0x43, 0x10, 0x00, 0xf0, 0x00, 0x3c, 0x3c, 0x83, 0x2a, 0x2a,
+    0x89, 0xb2, 0x6e, 0x80, 0x80, 0xf2, 0x43, 0x43, 0x3c, 0x80, 0x31, 0x00, 0x0f, 0x58, 0x00, 0x09,
+    0x50, 0x3d, 0x2a, 0x80, 0x3e, 0x6e, 0x00, 0x01, 0x30, 0x51, 0x83, 0x80, 0xad, 0x00, 0x30, 0x6e,
+    0x83, 0x83, 0x2a, 0x00, 0x40, 0x41, 0x3c, 0x41, 0x41, 0x6d, 0x00, 0xb1, 0x43, 0x83, 0x83, 0x43,
+    0x83, 0xf8, 0x43, 0x43, 0x3c, 0x83, 0x83, 0x5b, 0x00, 0x01, 0x40, 0x00, 0x51, 0x80, 0x2a, 0x83,
+    0x43, 0x43, 0xcc, 0x00, 0x00, 0x85, 0x00, 0x00, 0x13, 0x00, 0x90, 0x3c, 0x43, 0xf8, 0x3c, 0x41,
+    0xf8, 0x43, 0x3c, 0x41, 0x0f, 0x01, 0x00, 0x15, 0x00, 0xcf, 0x6e, 0x89, 0xf6, 0x2a, 0x43, 0x83,
+    0xf8, 0x2a, 0x2a, 0xf2, 0xf2, 0x43, 0x58, 0x00, 0x0a, 0x20, 0x3e, 0x6e, 0x80, 0x00, 0x80, 0x80,
+    0x42, 0x3d, 0x89, 0x83, 0x2a, 0x43, 0x6e, 0xe7, 0x00, 0x30, 0x43, 0x43, 0x80, 0x55, 0x00, 0x21,
+    0x43, 0x3c, 0x11, 0x00, 0xf0, 0x0a, 0x83, 0xf2, 0xf2, 0x83, 0x80, 0x43, 0x43, 0x83, 0x2a, 0x6e,
+    0xf2, 0x43, 0x43, 0x43, 0xf2, 0x43, 0x83, 0x83, 0xf8, 0x43, 0x2a, 0x43, 0x43, 0x43, 0x6e, 0x80,
+    0x00, 0x10, 0x6e, 0x0a, 0x00, 0xa0, 0x89, 0x6e, 0x6e, 0x6e, 0x43, 0x04, 0x3d, 0x43, 0x43, 0x6e,
+    0x5d, 0x01, 0x40, 0x3c, 0x3c, 0x2a, 0x2a, 0x06, 0x00, 0x60, 0x41, 0x41, 0x43, 0x6e, 0x43, 0x6e,
+    0x2f, 0x00, 0x1f, 0x3c, 0x58, 0x00, 0x0a, 0xf0, 0x04, 0x3e, 0x6e, 0x80, 0xb2, 0x89, 0x3c, 0x83,
+    0x42, 0x3d, 0x08, 0x80, 0x43, 0xf2, 0x6e, 0x6e, 0x6e, 0x89, 0x89, 0x83, 0x29, 0x01, 0x10, 0x83,
+    0xa0, 0x00, 0x20, 0x83, 0x3c, 0x76, 0x01, 0x20, 0xf8, 0x83, 0xfd, 0x02, 0x10, 0x80, 0xae, 0x00,
+    0x40, 0x2a, 0x43, 0x83, 0x43, 0xc5, 0x01, 0x90, 0x89, 0x89, 0x07, 0x3d, 0xeb, 0xf6, 0x89, 0x6e,
+    0x89, 0x80, 0x00, 0x00, 0x0b, 0x01, 0x40, 0xf2, 0x6e, 0x6e, 0x2a, 0x24, 0x01, 0xf0, 0x02, 0x41,
+    0x43, 0xeb, 0x2a, 0x43, 0x43, 0x83, 0x41, 0x43, 0x43, 0xf8, 0x43, 0xf8, 0x83, 0x6e, 0x89, 0x2a,
+    0x82, 0x00, 0x0f, 0x58, 0x00, 0x0a, 0xa0, 0xb2, 0x89, 0x3c, 0x3d, 0x2a, 0x80, 0x83, 0xb2, 0x07,
+    0x3d, 0x14, 0x02, 0x60, 0x80, 0x43, 0x51, 0x6e, 0xb2, 0x6e, 0xeb, 0x00, 0x30, 0x89, 0x6e, 0x6e,
+    0x03, 0x00, 0xc0, 0x75, 0x3d, 0x1c, 0x1c, 0x07, 0x07, 0x3d, 0xb2, 0x51, 0xb2, 0x43, 0xf2, 0xfd,
+    0x00, 0xa1, 0x2a, 0x2a, 0x89, 0x3d, 0x3d, 0x89, 0x6e, 0x43, 0x6e, 0x6e, 0x7a, 0x00, 0x71, 0x3d,
+    0x07, 0x07, 0x89, 0x51, 0xb2, 0x89, 0xdc, 0x01, 0x81, 0x3c, 0x43, 0x83, 0x83, 0x83, 0x83, 0x6e,
+    0x6e, 0x0a, 0x02, 0x00, 0x67, 0x02, 0x7f, 0x83, 0x43, 0x3d, 0x3d, 0x04, 0x04, 0x6e, 0x58, 0x00,
+    0x0b, 0x00, 0x00, 0x02, 0x90, 0x2a, 0x80, 0x80, 0xb2, 0x3d, 0x89, 0x2a, 0x80, 0x80, 0xa0, 0x01,
+    0x70, 0xf8, 0x83, 0x43, 0x6e, 0xf2, 0x43, 0x2a, 0x6e, 0x01, 0x60, 0x43, 0x2a, 0x2a, 0x83, 0x43,
+    0xf8, 0x6c, 0x00, 0x60, 0x6e, 0x2a, 0x6e, 0x89, 0x6e, 0x04, 0x7a, 0x00, 0x02, 0x88, 0x01, 0x00,
+    0x13, 0x00, 0x90, 0x6e, 0xf2, 0x43, 0xf8, 0xf8, 0x43, 0x43, 0x51, 0x6e, 0x80, 0x01, 0xe0, 0x2a,
+    0x43, 0xf8, 0x43, 0x2a, 0x2a, 0xf2, 0x83, 0xf2, 0x43, 0x6e, 0x51, 0x2a, 0x2a, 0x2e, 0x00, 0x20,
+    0x83, 0x3c, 0xe1, 0x01, 0x00, 0x19, 0x01, 0x0f, 0x58, 0x00, 0x0a, 0xe0, 0x3e, 0x2a, 0x80, 0x3e,
+    0x08, 0x3c, 0x80, 0x6e, 0x3d, 0x51, 0x3c, 0x51, 0x2a, 0x80, 0x60, 0x03, 0x71, 0xf8, 0x43, 0x83,
+    0x43, 0x6e, 0x43, 0xf8, 0xed, 0x01, 0x02, 0xec, 0x01, 0x01, 0x6f, 0x03, 0x20, 0x3c, 0x43, 0xb0,
+    0x01, 0x20, 0x43, 0xf2, 0x58, 0x03, 0x60, 0x2a, 0x2a, 0x43, 0x43, 0x2a, 0xf2, 0x0e, 0x03, 0x00,
+    0xd8, 0x01, 0xf0, 0x02, 0xf2, 0x6e, 0x83, 0x6e, 0x6e, 0x80, 0xf8, 0xf2, 0x43, 0x83, 0xf2, 0x83,
+    0x83, 0x83, 0x3c, 0x43, 0x15, 0x90, 0x00, 0xbf, 0x89, 0x6e, 0x43, 0x43, 0x41, 0xf8, 0xf8, 0x43,
+    0x6e, 0xde, 0xf6, 0x58, 0x00, 0x0a, 0xe0, 0x3e, 0x08, 0x3c, 0x3e, 0x89, 0x80, 0x80, 0x04, 0x3d,
+    0x83, 0x83, 0x51, 0x2a, 0x83, 0x9f, 0x04, 0x31, 0x43, 0x43, 0xf8, 0xac, 0x02, 0x00, 0x07, 0x00,
+    0x00, 0xad, 0x01, 0x03, 0xf7, 0x04, 0x10, 0x43, 0x5f, 0x00, 0x00, 0xd8, 0x01, 0x11, 0x83, 0x8d,
+    0x02, 0x00, 0xf5, 0x00, 0x11, 0xf8, 0x1c, 0x00, 0x10, 0x2a, 0x97, 0x01, 0x50, 0x43, 0x2a, 0x43,
+    0x3c, 0x6e, 0x18, 0x01, 0x01, 0xd7, 0x02, 0x01, 0x98, 0x02, 0x9f, 0x6e, 0x2a, 0x6e, 0x6e, 0x83,
+    0xf8, 0x41, 0x83, 0x51, 0x58, 0x00, 0x0a, 0xf0, 0x03, 0x3e, 0x89, 0x80, 0x3d, 0x51, 0x80, 0x83,
+    0x05, 0x06, 0x89, 0x83, 0x83, 0x2a, 0x83, 0x83, 0x83, 0x30, 0xf8, 0xe5, 0x00, 0x01, 0xde, 0x01,
+    0x50, 0x83, 0x30, 0x83, 0x43, 0x6e, 0x46, 0x00, 0x20, 0x2a, 0x08, 0x2b, 0x01, 0x00, 0xdb, 0x00,
+    0x00, 0x1a, 0x00, 0x01, 0xe1, 0x01, 0x80, 0x6e, 0xf2, 0x43, 0x80, 0x2a, 0x43, 0x83, 0x3c, 0xc8,
+    0x00, 0x80, 0x83, 0xf8, 0x43, 0x3c, 0x80, 0x3c, 0xf8, 0x6e, 0xf3, 0x01, 0x00, 0xa1, 0x03, 0x90,
+    0x33, 0xf8, 0x2a, 0x89, 0x3d, 0x89, 0x43, 0x3c, 0xf8, 0x09, 0x02, 0x3f, 0x80, 0xf8, 0x3c, 0x58,
+    0x00, 0x0a, 0xf0, 0x0e, 0x3d, 0x51, 0x80, 0x3d, 0x02, 0x3c, 0x80, 0xb2, 0x3d, 0x2a, 0x80, 0xf8,
+    0x43, 0x83, 0x6e, 0x6e, 0x6e, 0x51, 0x6e, 0x43, 0x80, 0xf2, 0x83, 0x3c, 0x83, 0x43, 0x2a, 0x89,
+    0xb2, 0x67, 0x01, 0x10, 0x6e, 0xf4, 0x01, 0xc1, 0xb2, 0x3d, 0x89, 0x6e, 0xb2, 0x89, 0x07, 0x89,
+    0xf2, 0x6e, 0x6e, 0x04, 0x3b, 0x00, 0x01, 0xd2, 0x02, 0x00, 0x4a, 0x02, 0x01, 0x69, 0x01, 0x01,
+    0x92, 0x00, 0x50, 0x43, 0x3c, 0x6e, 0x6e, 0x6e, 0xa4, 0x01, 0x10, 0xf8, 0xdc, 0x00, 0x31, 0x2a,
+    0x51, 0xeb, 0x06, 0x01, 0x2f, 0x43, 0x3c, 0x58, 0x00, 0x0b, 0xb0, 0x3d, 0x02, 0x3c, 0x04, 0xf8,
+    0x58, 0xf8, 0xe8, 0xe8, 0xf8, 0x41, 0xd9, 0x04, 0x00, 0x52, 0x02, 0x11, 0x83, 0x4f, 0x00, 0x01,
+    0xb3, 0x03, 0x41, 0x83, 0x43, 0x80, 0x83, 0x27, 0x05, 0x11, 0x83, 0x55, 0x00, 0x13, 0xf8, 0x38,
+    0x01, 0x11, 0x83, 0x01, 0x02, 0x01, 0x42, 0x01, 0x01, 0x05, 0x00, 0x01, 0x89, 0x00, 0x10, 0x6e,
+    0x28, 0x00, 0x51, 0x43, 0x07, 0x43, 0xf8, 0xf2, 0x2a, 0x01, 0xaf, 0x83, 0x3c, 0x6e, 0xeb, 0x07,
+    0x3d, 0x02, 0x3c, 0x43, 0x3c, 0x58, 0x00, 0x0a, 0x35, 0x04, 0xf8, 0x58, 0x80, 0x00, 0x10, 0x3c,
+    0x4b, 0x02, 0x00, 0xa3, 0x01, 0x00, 0xd6, 0x05, 0x00, 0xa6, 0x01, 0x10, 0x80, 0xde, 0x01, 0x00,
+    0xd8, 0x02, 0x32, 0x43, 0x6e, 0xf2, 0xca, 0x03, 0x10, 0x89, 0x5c, 0x03, 0x21, 0x6e, 0x2a, 0xf4,
+    0x00, 0x20, 0x2a, 0x43, 0x4c, 0x03, 0x10, 0x51, 0xd5, 0x00, 0x00, 0x19, 0x06, 0x20, 0x3c, 0x83,
+    0x10, 0x05, 0x10, 0xf8, 0xa9, 0x01, 0x02, 0xfa, 0x00, 0x00, 0x72, 0x01, 0x20, 0x3d, 0x51, 0x14,
+    0x07, 0x0f, 0x58, 0x00, 0x08, 0xc0, 0x04, 0xf8, 0x58, 0x33, 0x3c, 0xe7, 0xf8, 0xf2, 0xf2, 0x41,
+    0x58, 0x80, 0x4a, 0x05, 0x01, 0xd0, 0x00, 0x10, 0xf2, 0xd7, 0x00, 0x20, 0xf2, 0xf2, 0xd2, 0x04,
+    0x00, 0xaa, 0x01, 0x00, 0xb9, 0x00, 0x02, 0x77, 0x02, 0x10, 0x83, 0xcd, 0x01, 0x80, 0x89, 0x89,
+    0x89, 0xb2, 0x3d, 0x51, 0x2a, 0x89, 0x7a, 0x01, 0x02, 0x8a, 0x02, 0x00, 0xff, 0x00, 0x00, 0x51,
+    0x01, 0x00, 0x9c, 0x00, 0x20, 0x83, 0xf8, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0x01, 0xb1, 0x05, 0x20,
+    0x43, 0x2a, 0x81, 0x00, 0x0f, 0x58, 0x00, 0x07, 0xd1, 0x33, 0x3c, 0xe7, 0x04, 0x3c, 0x58, 0x80,
+    0x6e, 0xbc, 0x43, 0x8a, 0x6e, 0x51, 0x4b, 0x05, 0x10, 0x3c, 0xaa, 0x00, 0x20, 0x83, 0x2a, 0x1f,
+    0x00, 0x10, 0x80, 0x55, 0x05, 0x00, 0x5a, 0x01, 0x20, 0x6e, 0x2a, 0xb1, 0x01, 0x00, 0x33, 0x02,
+    0x00, 0x3c, 0x05, 0x00, 0xe7, 0x02, 0x30, 0x2a, 0x2a, 0x6e, 0x91, 0x04, 0x00, 0x0f, 0x04, 0x70,
+    0x2a, 0x89, 0x89, 0x89, 0x51, 0x6e, 0xb2, 0x3d, 0x00, 0x60, 0x51, 0x51, 0x89, 0x89, 0xb2, 0xb2,
+    0xdf, 0x03, 0x00, 0x61, 0x00, 0x00, 0x00, 0x07, 0x3f, 0x41, 0xf8, 0xf8, 0x58, 0x00, 0x0a, 0x31,
+    0x04, 0x3c, 0x58, 0x00, 0x05, 0x90, 0x42, 0x43, 0x58, 0x43, 0x80, 0x2a, 0x6e, 0xb2, 0x2a, 0x2a,
+    0x02, 0x12, 0x6e, 0x64, 0x02, 0xf1, 0x18, 0xeb, 0x89, 0x89, 0x2a, 0xb2, 0x89, 0x3d, 0x3d, 0xb2,
+    0x07, 0x6e, 0xb2, 0x07, 0xf6, 0x07, 0x07, 0x15, 0x15, 0x07, 0xf6, 0x89, 0xb2, 0x07, 0x65, 0x75,
+    0xb2, 0x07, 0x75, 0x1c, 0x0a, 0x75, 0x07, 0xb2, 0x07, 0xf6, 0x12, 0x07, 0x3d, 0x07, 0x03, 0x00,
+    0x30, 0x6e, 0x04, 0x89, 0x39, 0x00, 0x10, 0x3d, 0x00, 0x01, 0x50, 0x08, 0x2a, 0x2a, 0x51, 0x6e,
+    0x0d, 0x02, 0x00, 0xf4, 0x05, 0x00, 0xec, 0x01, 0x0f, 0x58, 0x00, 0x08, 0xf1, 0x01, 0x3d, 0x2a,
+    0x80, 0x07, 0x89, 0x80, 0x80, 0x42, 0x4a, 0x43, 0x3c, 0x43, 0x08, 0x2a, 0x3c, 0x3c, 0x1c, 0x01,
+    0x02, 0xd7, 0x05, 0xf0, 0x00, 0x6e, 0x43, 0x2a, 0x2a, 0x6e, 0x6e, 0x08, 0x6e, 0x89, 0x3d, 0xb2,
+    0x89, 0x89, 0x2a, 0x6e, 0xe6, 0x00, 0x90, 0x2a, 0x6e, 0x08, 0x89, 0xb2, 0x89, 0x12, 0x07, 0x3d,
+    0x74, 0x01, 0x50, 0x2a, 0x2a, 0x89, 0x12, 0x65, 0x17, 0x00, 0x90, 0x3d, 0x65, 0x3d, 0x07, 0x3d,
+    0x3d, 0x1c, 0x07, 0x08, 0x60, 0x00, 0x00, 0x00, 0x01, 0x70, 0x43, 0x2a, 0x89, 0x2a, 0x51, 0x51,
+    0x43, 0xef, 0x01, 0x3f, 0x80, 0x3c, 0xf2, 0x58, 0x00, 0x0a, 0xb0, 0x07, 0x89, 0x80, 0x3d, 0x43,
+    0x41, 0xf8, 0x6e, 0x6e, 0xf8, 0x58, 0x37, 0x04, 0x03, 0x4d, 0x05, 0x53, 0x43, 0x43, 0x89, 0xb2,
+    0xb2, 0xd9, 0x01, 0x30, 0xb2, 0x6e, 0x89, 0x65, 0x00, 0x20, 0x6e, 0x2a, 0xfd, 0x05, 0x00, 0xb4,
+    0x03, 0x30, 0x89, 0x08, 0x2a, 0x88, 0x01, 0x11, 0x2a, 0x94, 0x00, 0x60, 0x3d, 0x07, 0x89, 0xb2,
+    0x6e, 0x6e, 0x04, 0x00, 0x00, 0x25, 0x00, 0xb0, 0x07, 0x07, 0x6e, 0x6e, 0x43, 0xb2, 0x65, 0x75,
+    0x15, 0x89, 0x6e, 0x14, 0x04, 0x31, 0x6e, 0x6e, 0x51, 0x71, 0x00, 0x0f, 0x58, 0x00, 0x08, 0x30,
+    0x3d, 0x43, 0x41, 0x80, 0x07, 0x50, 0x04, 0x4a, 0x83, 0x58, 0x43, 0xbc, 0x05, 0x00, 0x58, 0x07,
+    0x00, 0xc1, 0x05, 0x00, 0x63, 0x00, 0x50, 0x2a, 0x2a, 0x08, 0x2a, 0x51, 0x0b, 0x00, 0x00, 0xea,
+    0x06, 0x00, 0x36, 0x06, 0x51, 0x08, 0x43, 0x51, 0x89, 0x08, 0xdf, 0x05, 0x50, 0x89, 0x89, 0x3d,
+    0x6e, 0xb2, 0x95, 0x00, 0x05, 0x0d, 0x04, 0x71, 0x89, 0x51, 0x08, 0x51, 0x89, 0x6e, 0x2a, 0x65,
+    0x01, 0x30, 0x89, 0x2a, 0x89, 0x0f, 0x02, 0x40, 0xeb, 0x6e, 0x83, 0x3c, 0x30, 0x05, 0x0f, 0x58,
+    0x00, 0x09, 0xf0, 0x06, 0x3e, 0x6e, 0x80, 0x05, 0x43, 0x58, 0xf8, 0xe8, 0x6e, 0xf8, 0x58, 0xcc,
+    0x43, 0x43, 0x6e, 0x08, 0x6e, 0x07, 0x89, 0x1c, 0x07, 0x5b, 0x07, 0x00, 0x63, 0x00, 0xa0, 0x89,
+    0x12, 0x89, 0xeb, 0x89, 0xb2, 0x6e, 0x89, 0x07, 0x07, 0x76, 0x04, 0x30, 0xb2, 0x07, 0x65, 0x84,
+    0x00, 0x70, 0x12, 0x6e, 0x89, 0xb2, 0x07, 0x89, 0x07, 0x21, 0x00, 0x90, 0x89, 0x07, 0x89, 0x3d,
+    0x89, 0x89, 0x3d, 0x75, 0x6e, 0x8c, 0x00, 0x60, 0x51, 0x3d, 0x07, 0x89, 0xeb, 0x89, 0x6e, 0x00,
+    0xff, 0x00, 0x6e, 0x89, 0x08, 0x89, 0x2a, 0x08, 0x3d, 0x07, 0x89, 0x89, 0xb2, 0x43, 0xcc, 0xcc,
+    0xcc, 0x58, 0x00, 0x0a, 0xd0, 0x05, 0x43, 0x58, 0x3d, 0x43, 0x8a, 0x80, 0x6e, 0x4a, 0x43, 0x8a,
+    0x83, 0x80, 0x1f, 0x08, 0x32, 0x83, 0x89, 0x6e, 0x5a, 0x01, 0x20, 0x2a, 0x2a, 0xc6, 0x01, 0x00,
+    0xd1, 0x00, 0x01, 0x3b, 0x04, 0x30, 0x89, 0x2a, 0x6e, 0x73, 0x03, 0x10, 0x6e, 0x04, 0x08, 0x02,
+    0x58, 0x01, 0x31, 0x89, 0x2a, 0x2a, 0xfe, 0x06, 0x40, 0x2a, 0x6e, 0x6e, 0x3d, 0x11, 0x02, 0x10,
+    0xb2, 0x26, 0x03, 0x00, 0x9c, 0x04, 0xa0, 0x89, 0xeb, 0x08, 0x6e, 0x2a, 0x51, 0x2a, 0x43, 0x2a,
+    0xb2, 0x6e, 0x00, 0x1f, 0x08, 0x58, 0x00, 0x0a, 0x50, 0x3d, 0x43, 0x8a, 0x3d, 0xf8, 0x80, 0x00,
+    0x80, 0x6e, 0x80, 0xb2, 0xb2, 0xbc, 0x3d, 0xb2, 0xbc, 0x41, 0x03, 0x06, 0x01, 0x00, 0xf1, 0x0a,
+    0x89, 0xbc, 0x3d, 0x3d, 0x3d, 0xeb, 0x07, 0x3d, 0x3d, 0x89, 0xb2, 0x3d, 0x3d, 0x07, 0xb2, 0xb2,
+    0x3d, 0xb2, 0xb2, 0xb2, 0x3d, 0xeb, 0x3d, 0xb2, 0xeb, 0xca, 0x0a, 0x00, 0x01, 0x00, 0x61, 0xbc,
+    0x07, 0x07, 0x3d, 0x3d, 0xbc, 0x1a, 0x00, 0xf1, 0x00, 0x3d, 0xb2, 0x3d, 0x07, 0x3d, 0xeb, 0x07,
+    0x07, 0x07, 0xeb, 0x15, 0x1c, 0x07, 0xeb, 0x3d, 0x49, 0x00, 0x10, 0xeb, 0x19, 0x00, 0x0f, 0x58,
+    0x00, 0x08, 0xb1, 0x3d, 0xf8, 0x8a, 0xc8, 0x3d, 0x80, 0x83, 0x3d, 0x1c, 0x3d, 0x30, 0xba, 0x09,
+    0x00, 0xbd, 0x0b, 0x0f, 0x01, 0x00, 0x01, 0x22, 0x80, 0x80, 0x1a, 0x00, 0x00, 0x08, 0x00, 0x0a,
+    0x16, 0x00, 0x03, 0x06, 0x00, 0x00, 0xde, 0x0b, 0x01, 0x26, 0x0b, 0x08, 0x44, 0x00, 0x08, 0x2d,
+    0x00, 0x0f, 0x58, 0x00, 0x03, 0xb0, 0xc8, 0x3d, 0x80, 0x05, 0x43, 0x3c, 0x80, 0x04, 0x42, 0x43,
+    0x41, 0xce, 0x00, 0x10, 0x07, 0xb7, 0x0b, 0x00, 0xc3, 0x00, 0x00, 0xef, 0x00, 0xa0, 0x3d, 0xb2,
+    0xb2, 0x07, 0x3d, 0xb2, 0x07, 0x07, 0xeb, 0x07, 0x12, 0x00, 0x30, 0x07, 0x07, 0xb2, 0xeb, 0x00,
+    0x10, 0xb2, 0x22, 0x00, 0x01, 0xda, 0x00, 0x33, 0x07, 0x3d, 0xb2, 0x32, 0x00, 0x00, 0x0a, 0x00,
+    0x30, 0xb2, 0x3d, 0xb2, 0xcf, 0x00, 0x11, 0x07, 0x21, 0x01, 0x00, 0x06, 0x0c, 0x00, 0x49, 0x00,
+    0x00, 0x21, 0x00, 0x1f, 0xeb, 0x58, 0x00, 0x0a, 0xc0, 0x05, 0x43, 0x3c, 0x04, 0x83, 0x3c, 0x80,
+    0x6e, 0x6e, 0xf8, 0x01, 0x83, 0x99, 0x03, 0x00, 0xd7, 0x03, 0x00, 0xa4, 0x02, 0x00, 0x3b, 0x04,
+    0x02, 0x30, 0x04, 0x30, 0x89, 0x08, 0x89, 0x50, 0x02, 0x80, 0x6e, 0x3d, 0x12, 0x89, 0x08, 0x51,
+    0x89, 0x2a, 0xee, 0x04, 0x63, 0x6e, 0x3d, 0xf6, 0x1c, 0x07, 0x89, 0x14, 0x05, 0xa0, 0x3d, 0x12,
+    0x89, 0xf6, 0xf6, 0x65, 0x07, 0xf6, 0x07, 0x65, 0x65, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x41, 0x00,
+    0x00, 0x11, 0x05, 0x7f, 0x3d, 0xeb, 0xeb, 0x6e, 0x6e, 0xcc, 0x43, 0x58, 0x00, 0x0a, 0x31, 0x04,
+    0x83, 0x3c, 0x80, 0x05, 0x31, 0xe8, 0xf8, 0x41, 0x37, 0x07, 0x01, 0xeb, 0x03, 0x10, 0x89, 0x6f,
+    0x03, 0x31, 0x89, 0xb2, 0x89, 0x22, 0x04, 0x52, 0x89, 0x89, 0x89, 0x12, 0x12, 0x16, 0x00, 0x10,
+    0x08, 0x07, 0x00, 0x02, 0xbe, 0x03, 0x01, 0x08, 0x00, 0x60, 0x12, 0x12, 0x89, 0x12, 0x3d, 0x08,
+    0x98, 0x02, 0x50, 0xb2, 0x07, 0xf6, 0xeb, 0x65, 0x85, 0x00, 0xa0, 0x07, 0x65, 0x07, 0x15, 0x75,
+    0x0a, 0x0a, 0x44, 0xeb, 0x07, 0x3b, 0x00, 0x41, 0x51, 0x89, 0xcc, 0xcc, 0x33, 0x07, 0x0f, 0x58,
+    0x00, 0x06, 0x60, 0x04, 0x3c, 0x58, 0x04, 0x3c, 0x41, 0x00, 0x01, 0x11, 0x58, 0xaa, 0x03, 0x01,
+    0xc3, 0x04, 0x01, 0xc3, 0x00, 0x00, 0xed, 0x05, 0x01, 0x37, 0x00, 0x30, 0x89, 0x51, 0x6e, 0xb2,
+    0x03, 0x20, 0x2a, 0x08, 0x80, 0x00, 0x00, 0xba, 0x04, 0x01, 0xfa, 0x06, 0x00, 0x3c, 0x04, 0x00,
+    0x03, 0x00, 0x70, 0xb2, 0x12, 0x3d, 0x3d, 0x89, 0xeb, 0xb2, 0x1c, 0x01, 0x00, 0xa6, 0x00, 0x10,
+    0x08, 0x28, 0x04, 0x30, 0x89, 0xeb, 0x12, 0x6d, 0x00, 0x21, 0x51, 0x2a, 0x80, 0x00, 0x0f, 0x58,
+    0x00, 0x0a, 0x34, 0x04, 0x3c, 0x41, 0x80, 0x0e, 0x02, 0x1d, 0x05, 0x11, 0x2a, 0xdc, 0x07, 0x00,
+    0xe0, 0x04, 0x00, 0x27, 0x05, 0x00, 0x6f, 0x00, 0x51, 0x89, 0x89, 0x89, 0x17, 0xf6, 0xb0, 0x00,
+    0xa0, 0x08, 0x89, 0x89, 0x3d, 0x12, 0x08, 0x08, 0x89, 0x6e, 0x51, 0x4c, 0x00, 0x00, 0x11, 0x01,
+    0x30, 0x2a, 0x51, 0x6e, 0xfd, 0x00, 0xb0, 0x07, 0x3d, 0x65, 0xf6, 0x65, 0x65, 0x07, 0x89, 0x2a,
+    0xeb, 0x07, 0xa0, 0x05, 0x21, 0x89, 0xeb, 0x2f, 0x00, 0x7f, 0x51, 0x89, 0x51, 0x89, 0x89, 0x2a,
+    0xcc, 0x58, 0x00, 0x0a, 0x07, 0x80, 0x0e, 0x41, 0xcc, 0x83, 0x43, 0x08, 0x16, 0x00, 0x01, 0x6e,
+    0x05, 0x04, 0xe1, 0x08, 0x60, 0x6e, 0x08, 0x51, 0xeb, 0x89, 0x08, 0xf7, 0x04, 0x30, 0x08, 0x12,
+    0x08, 0xbf, 0x00, 0x40, 0x2a, 0x83, 0x51, 0x89, 0x49, 0x01, 0x51, 0x89, 0x6e, 0x2a, 0x43, 0x51,
+    0xc4, 0x00, 0x11, 0xb2, 0xd8, 0x03, 0x10, 0x08, 0x9c, 0x01, 0x70, 0x51, 0xeb, 0x89, 0x89, 0xb2,
+    0xf6, 0xeb, 0xed, 0x00, 0x9f, 0x89, 0xeb, 0xf6, 0x07, 0x07, 0xf6, 0x07, 0xeb, 0x89, 0x58, 0x00,
+    0x0a, 0x30, 0x3d, 0x43, 0x3c, 0x00, 0x03, 0x90, 0x42, 0xb2, 0x89, 0x43, 0x89, 0xcc, 0x3c, 0x80,
+    0x43, 0x26, 0x01, 0x12, 0xf2, 0xde, 0x01, 0x00, 0xac, 0x00, 0x01, 0x54, 0x07, 0xe0, 0x2a, 0x89,
+    0x08, 0x07, 0x89, 0x89, 0x3d, 0xf6, 0xf6, 0x12, 0x89, 0x89, 0xb2, 0x89, 0x63, 0x00, 0x20, 0x51,
+    0x89, 0x90, 0x09, 0x00, 0x08, 0x0c, 0x00, 0x8f, 0x02, 0x20, 0x08, 0x6e, 0x0b, 0x08, 0x61, 0x83,
+    0x08, 0xb2, 0x89, 0x89, 0x08, 0x80, 0x05, 0x60, 0xeb, 0x07, 0x12, 0xf6, 0x07, 0xeb, 0x21, 0x00,
+    0x00, 0x23, 0x05, 0x0f, 0x58, 0x00, 0x0a, 0xf0, 0x01, 0x05, 0x43, 0x3c, 0x47, 0x3d, 0x80, 0x83,
+    0xb2, 0xb2, 0x6e, 0x8a, 0x89, 0xeb, 0xeb, 0x51, 0x43, 0xb5, 0x01, 0x41, 0x43, 0x2a, 0x51, 0x08,
+    0xb4, 0x02, 0x10, 0x07, 0x5b, 0x01, 0x10, 0x07, 0xfc, 0x00, 0x00, 0x36, 0x00, 0xa4, 0x51, 0x51,
+    0x12, 0x6e, 0x89, 0x07, 0x89, 0xeb, 0x2a, 0x2a, 0x89, 0x02, 0xe2, 0x6e, 0xf2, 0x6e, 0x2a, 0x89,
+    0x07, 0x3d, 0x12, 0x89, 0x51, 0x89, 0x65, 0x12, 0x12, 0xf9, 0x05, 0x00, 0x5d, 0x03, 0x10, 0xeb,
+    0x93, 0x06, 0x01, 0xa5, 0x06, 0x4f, 0x83, 0x2a, 0x43, 0xcc, 0x58, 0x00, 0x0a, 0x60, 0x47, 0x3d,
+    0x80, 0xb2, 0x80, 0x3c, 0x80, 0x08, 0xb1, 0x3c, 0xcc, 0x89, 0x07, 0x15, 0xf6, 0xf6, 0xf6, 0x89,
+    0xeb, 0x3d, 0xd3, 0x00, 0x00, 0x75, 0x06, 0x40, 0x08, 0xb2, 0xb2, 0x89, 0xf1, 0x01, 0x00, 0x39,
+    0x01, 0x00, 0x81, 0x02, 0x00, 0x79, 0x01, 0x01, 0x6c, 0x06, 0x02, 0x43, 0x03, 0x01, 0x4b, 0x05,
+    0x30, 0x2a, 0x2a, 0x12, 0xf1, 0x00, 0x20, 0x89, 0x08, 0xa6, 0x02, 0x00, 0x7f, 0x02, 0x03, 0x9b,
+    0x02, 0x30, 0x12, 0x07, 0x07, 0xa9, 0x07, 0x2f, 0x43, 0x43, 0x58, 0x00, 0x0a, 0x90, 0xb2, 0x80,
+    0x3c, 0xb2, 0xf2, 0x3c, 0x80, 0x6e, 0xe8, 0xc2, 0x0f, 0xf0, 0x01, 0x43, 0x51, 0xf6, 0xf6, 0xeb,
+    0xeb, 0x07, 0x65, 0x15, 0x15, 0x65, 0x65, 0x65, 0x07, 0x07, 0x3d, 0xea, 0x03, 0x20, 0x08, 0x12,
+    0x77, 0x01, 0x02, 0xba, 0x02, 0x01, 0x56, 0x06, 0x35, 0x12, 0x89, 0x89, 0x48, 0x06, 0x01, 0x19,
+    0x07, 0x10, 0x89, 0x4b, 0x06, 0x00, 0x76, 0x02, 0x23, 0x2a, 0xb2, 0x91, 0x00, 0x00, 0x5f, 0x01,
+    0x00, 0x08, 0x00, 0x12, 0x83, 0x32, 0x09, 0x0f, 0x58, 0x00, 0x09, 0xc0, 0xb2, 0xf2, 0x3c, 0xb2,
+    0x3c, 0x3c, 0x80, 0x04, 0x3d, 0x43, 0x80, 0xb2, 0xc1, 0x00, 0x60, 0xeb, 0x15, 0x22, 0x75, 0x89,
+    0x89, 0x9b, 0x00, 0x80, 0x12, 0x3d, 0x07, 0x12, 0x07, 0x65, 0x65, 0x15, 0xed, 0x01, 0x41, 0x89,
+    0x08, 0x08, 0x51, 0x3f, 0x04, 0x41, 0x89, 0x08, 0x2a, 0x12, 0x0a, 0x00, 0x12, 0x12, 0x66, 0x04,
+    0x10, 0x51, 0x10, 0x01, 0x00, 0x09, 0x00, 0x01, 0x8b, 0x07, 0x13, 0xf2, 0x7d, 0x04, 0x20, 0x2a,
+    0x2a, 0x67, 0x01, 0x30, 0x43, 0x51, 0x51, 0x80, 0x00, 0x00, 0x98, 0x06, 0x0f, 0x58, 0x00, 0x07,
+    0xa0, 0xb2, 0x3c, 0x3c, 0x1c, 0x07, 0x80, 0xf8, 0xb2, 0x3d, 0x04, 0x95, 0x0a, 0x01, 0x64, 0x01,
+    0x00, 0x3e, 0x09, 0x20, 0x2a, 0x89, 0x6e, 0x02, 0xf0, 0x01, 0x65, 0x07, 0x0a, 0x65, 0x07, 0x07,
+    0x15, 0x0a, 0x15, 0x89, 0x12, 0x3d, 0xeb, 0x12, 0x89, 0x12, 0x74, 0x02, 0x50, 0x89, 0x07, 0x07,
+    0x3d, 0x51, 0xc5, 0x01, 0x03, 0xce, 0x02, 0x01, 0x50, 0x02, 0x10, 0x6e, 0xf8, 0x09, 0x30, 0x89,
+    0x89, 0x04, 0xfd, 0x0d, 0x00, 0xab, 0x01, 0x20, 0x6e, 0xb2, 0x99, 0x02, 0x11, 0x2a, 0x7e, 0x08,
+    0x01, 0x2b, 0x0b, 0x0f, 0x58, 0x00, 0x06, 0xc0, 0x1c, 0x07, 0x80, 0x3d, 0x43, 0x58, 0x80, 0x6e,
+    0x42, 0x83, 0x3c, 0x08, 0x91, 0x00, 0x02, 0xe6, 0x03, 0x00, 0x4f, 0x04, 0xd2, 0x08, 0x89, 0x07,
+    0x0a, 0x75, 0x65, 0x65, 0x75, 0x75, 0x15, 0x75, 0x22, 0x1c, 0x51, 0x00, 0xa1, 0x6e, 0x6e, 0x89,
+    0x43, 0x6e, 0x3d, 0x89, 0x89, 0x15, 0xf6, 0x48, 0x07, 0x00, 0x42, 0x07, 0x10, 0x2a, 0x8a, 0x0e,
+    0x21, 0x89, 0x43, 0x9d, 0x0a, 0x10, 0x6e, 0x77, 0x05, 0x70, 0x2a, 0x6e, 0x51, 0x6e, 0xeb, 0x07,
+    0x89, 0xa4, 0x02, 0x02, 0x24, 0x08, 0x00, 0x9a, 0x04, 0x0f, 0x58, 0x00, 0x07, 0xf1, 0x04, 0x3d,
+    0x43, 0x58, 0xb2, 0x83, 0x3c, 0xf8, 0xb2, 0x3d, 0x6e, 0x3c, 0x2a, 0x6e, 0x89, 0x12, 0x89, 0x07,
+    0x07, 0x07, 0x45, 0x02, 0x12, 0x08, 0x44, 0x04, 0xf2, 0x09, 0x75, 0x0a, 0x16, 0x0a, 0x65, 0x15,
+    0x75, 0x75, 0x65, 0x1c, 0x16, 0x75, 0x07, 0x12, 0x89, 0xb2, 0x89, 0xeb, 0x6e, 0x3d, 0x07, 0x3d,
+    0x07, 0xf6, 0xf8, 0x00, 0x00, 0xc6, 0x05, 0x02, 0x9b, 0x02, 0x00, 0x92, 0x02, 0x00, 0x8a, 0x01,
+    0x00, 0x17, 0x0f, 0x20, 0x80, 0x43, 0x71, 0x00, 0x31, 0x6e, 0x08, 0x89, 0xa9, 0x01, 0x10, 0xf2,
+    0x3d, 0x03, 0x0f, 0x58, 0x00, 0x07, 0xa0, 0xb2, 0x83, 0x3c, 0xb2, 0x2a, 0x80, 0x80, 0x6e, 0x42,
+    0x2a, 0x3f, 0x0d, 0x20, 0x12, 0xf6, 0xac, 0x06, 0x41, 0x65, 0x07, 0x65, 0x3d, 0x9c, 0x09, 0x60,
+    0xf6, 0xeb, 0x07, 0x65, 0x3d, 0x07, 0xa9, 0x0f, 0x71, 0x3d, 0xf6, 0x3d, 0x07, 0x07, 0xf6, 0x12,
+    0xfe, 0x02, 0x40, 0x6e, 0x43, 0x3d, 0x3d, 0xe9, 0x00, 0x01, 0xc8, 0x03, 0x00, 0x7b, 0x00, 0x70,
+    0x2a, 0x2a, 0x2a, 0x3c, 0x2a, 0x2a, 0x43, 0x89, 0x00, 0xc0, 0x43, 0x6e, 0x43, 0x04, 0x6e, 0x2a,
+    0x51, 0x43, 0x83, 0x08, 0x2a, 0x08, 0xa3, 0x01, 0x11, 0x3d, 0x10, 0x03, 0x0f, 0x58, 0x00, 0x08,
+    0x40, 0xb2, 0x2a, 0x80, 0x1c, 0x80, 0x12, 0x11, 0xb2, 0x97, 0x06, 0x60, 0x89, 0xeb, 0x3d, 0x07,
+    0x07, 0x1c, 0xd3, 0x00, 0x11, 0x51, 0xe2, 0x0a, 0x03, 0x74, 0x06, 0x00, 0x77, 0x03, 0x10, 0x2a,
+    0xbb, 0x01, 0x00, 0x36, 0x01, 0x00, 0x38, 0x07, 0x10, 0x89, 0xf1, 0x01, 0x12, 0xf6, 0x8c, 0x03,
+    0x50, 0x89, 0x51, 0x51, 0xf6, 0x89, 0xfc, 0x05, 0x03, 0x93, 0x03, 0x01, 0x8d, 0x09, 0x00, 0xe4,
+    0x02, 0x30, 0x2a, 0x6e, 0xb2, 0x19, 0x03, 0x01, 0x91, 0x03, 0x0f, 0x58, 0x00, 0x06, 0xa2, 0x1c,
+    0x2a, 0x80, 0x75, 0x15, 0x83, 0x02, 0xb2, 0x3d, 0xb2, 0x29, 0x02, 0x01, 0x4e, 0x03, 0x00, 0x0a,
+    0x00, 0x00, 0xcf, 0x03, 0x00, 0x26, 0x05, 0x00, 0x3b, 0x05, 0x21, 0x07, 0x07, 0x61, 0x00, 0xf0,
+    0x03, 0x89, 0xf6, 0x12, 0x12, 0x07, 0x15, 0x22, 0x1a, 0x0a, 0x15, 0x75, 0x07, 0xf6, 0x07, 0x89,
+    0x89, 0x07, 0x12, 0xf2, 0x04, 0x00, 0xd5, 0x01, 0x30, 0x89, 0xf6, 0x65, 0x73, 0x01, 0x00, 0x9b,
+    0x0b, 0x20, 0x89, 0xf6, 0xdf, 0x09, 0x00, 0x21, 0x04, 0x00, 0x76, 0x06, 0x00, 0x6b, 0x03, 0x0f,
+    0x58, 0x00, 0x0a, 0x51, 0x75, 0x15, 0x83, 0x1c, 0x89, 0x00, 0x11, 0x42, 0x83, 0x07, 0x07, 0x07,
+    0x22, 0x07, 0x00, 0x5b, 0x01, 0x11, 0x51, 0xde, 0x11, 0x40, 0x6e, 0x2a, 0x12, 0x07, 0xd7, 0x0b,
+    0x03, 0xba, 0x0a, 0x20, 0x6e, 0x6e, 0xfd, 0x03, 0x61, 0xf6, 0xf6, 0x15, 0x07, 0xf6, 0xf6, 0xf6,
+    0x01, 0x00, 0x94, 0x00, 0x21, 0xeb, 0x07, 0x58, 0x03, 0xc1, 0x3d, 0x6e, 0xf6, 0xf6, 0x07, 0x12,
+    0x89, 0x07, 0x65, 0xf6, 0x07, 0xf6, 0x9d, 0x03, 0x02, 0xa3, 0x02, 0x20, 0x83, 0x6e, 0x16, 0x08,
+    0x0f, 0x58, 0x00, 0x07, 0xb2, 0x1c, 0x89, 0x80, 0xb2, 0x2a, 0x3c, 0x83, 0xb2, 0xb2, 0x08, 0x80,
+    0x38, 0x04, 0x00, 0xdf, 0x0b, 0x70, 0x08, 0x89, 0x51, 0x51, 0x2a, 0x51, 0x08, 0x4e, 0x0d, 0x32,
+    0x89, 0x6e, 0x6e, 0xfe, 0x07, 0x41, 0x6e, 0x2a, 0x6e, 0xf6, 0x36, 0x01, 0x80, 0xf6, 0xf6, 0x89,
+    0x51, 0x08, 0x07, 0x89, 0xf6, 0x4b, 0x04, 0xa0, 0xf6, 0x07, 0xf6, 0xeb, 0xeb, 0xb2, 0xf6, 0xf6,
+    0x65, 0x12, 0x4d, 0x08, 0x00, 0x90, 0x00, 0xc0, 0x2a, 0x2a, 0x08, 0x51, 0x08, 0xf6, 0x65, 0x0a,
+    0xeb, 0x2a, 0x83, 0x83, 0x18, 0x08, 0x03, 0x90, 0x08, 0x0f, 0x58, 0x00, 0x06, 0x21, 0xb2, 0x2a,
+    0x00, 0x11, 0x40, 0x42, 0x3d, 0x08, 0x3c, 0xaf, 0x00, 0x51, 0x43, 0x6e, 0x3d, 0x12, 0xeb, 0x45,
+    0x00, 0x11, 0x51, 0xef, 0x0c, 0x01, 0x73, 0x04, 0x01, 0xcd, 0x07, 0x00, 0x38, 0x04, 0x00, 0x6a,
+    0x0d, 0x41, 0x89, 0x89, 0x12, 0xeb, 0x8f, 0x00, 0xd0, 0x08, 0x89, 0xf6, 0x15, 0x44, 0x22, 0x11,
+    0x22, 0x11, 0x11, 0x15, 0xf6, 0x3d, 0xd7, 0x04, 0xe0, 0x65, 0x65, 0x07, 0x11, 0x0a, 0x11, 0x15,
+    0x0a, 0x0a, 0x15, 0x17, 0x89, 0x2a, 0x51, 0x2a, 0x00, 0x20, 0x89, 0x43, 0x27, 0x00, 0x0f, 0x58,
+    0x00, 0x0a, 0xe0, 0x3e, 0x89, 0x80, 0x1c, 0x07, 0x43, 0x80, 0xb2, 0x3d, 0x08, 0x83, 0x89, 0x51,
+    0x08, 0x2b, 0x0e, 0x01, 0x4f, 0x0e, 0x01, 0x49, 0x02, 0x31, 0x89, 0x08, 0x3d, 0xa7, 0x07, 0x12,
+    0x12, 0xc5, 0x00, 0x10, 0xb2, 0x02, 0x04, 0x10, 0x89, 0x38, 0x09, 0x30, 0x07, 0x6e, 0x89, 0xc1,
+    0x01, 0x01, 0x16, 0x00, 0xf0, 0x01, 0xeb, 0xeb, 0x65, 0x75, 0x22, 0x21, 0x75, 0x75, 0x07, 0x65,
+    0x2e, 0x24, 0x75, 0x1c, 0xb2, 0x65, 0x6a, 0x05, 0xa1, 0x17, 0x75, 0x1a, 0xf6, 0x08, 0x89, 0x07,
+    0x75, 0xb2, 0x89, 0x6f, 0x06, 0x0f, 0x58, 0x00, 0x09, 0x40, 0x1c, 0x07, 0x43, 0x3e, 0x80, 0x0e,
+    0xa0, 0x3d, 0x2a, 0x3c, 0x89, 0xf6, 0x12, 0x89, 0xf6, 0x89, 0xb2, 0xd7, 0x05, 0x02, 0xac, 0x07,
+    0x00, 0x24, 0x00, 0x20, 0x6e, 0x2a, 0xb1, 0x03, 0x70, 0xf6, 0x2a, 0x08, 0x12, 0xb2, 0x3d, 0xb2,
+    0xed, 0x10, 0x10, 0x51, 0xf9, 0x03, 0x50, 0x89, 0x12, 0x89, 0x08, 0x89, 0xcb, 0x01, 0x40, 0x08,
+    0x89, 0x51, 0xeb, 0x18, 0x09, 0x20, 0x51, 0x51, 0x24, 0x08, 0x01, 0x3b, 0x00, 0x81, 0x07, 0xeb,
+    0xeb, 0xf6, 0xf6, 0x6e, 0xeb, 0x65, 0x16, 0x08, 0x11, 0xeb, 0x29, 0x03, 0x0f, 0x58, 0x00, 0x08,
+    0x00, 0x00, 0x13, 0x70, 0x89, 0x3c, 0x80, 0xb2, 0xb2, 0x2a, 0x3c, 0x9f, 0x16, 0x00, 0x63, 0x01,
+    0x01, 0x05, 0x00, 0x00, 0x47, 0x07, 0x00, 0x25, 0x07, 0x00, 0xb3, 0x0a, 0xf0, 0x03, 0xb2, 0x3d,
+    0x15, 0x15, 0x44, 0x75, 0x16, 0x16, 0x16, 0x16, 0x44, 0x16, 0x22, 0x16, 0x11, 0x16, 0x75, 0x44,
+    0x1b, 0x00, 0x00, 0xce, 0x0a, 0x90, 0x15, 0x15, 0x07, 0x07, 0x07, 0x1c, 0x15, 0x07, 0x07, 0x96,
+    0x03, 0x21, 0x3d, 0x15, 0xa1, 0x01, 0x20, 0xeb, 0x15, 0x16, 0x00, 0x50, 0x1c, 0x1c, 0x16, 0x16,
+    0x15, 0xe3, 0x0b, 0x10, 0x1c, 0x7a, 0x03, 0x0f, 0x58, 0x00, 0x07, 0x50, 0x3e, 0x89, 0x3c, 0x3e,
+    0xb2, 0x00, 0x08, 0x22, 0x08, 0x83, 0xbc, 0x0b, 0x01, 0xcc, 0x0b, 0x05, 0xdf, 0x0b, 0x03, 0xd6,
+    0x0b, 0x02, 0xd6, 0x17, 0x00, 0xf9, 0x17, 0x03, 0x04, 0x00, 0x11, 0x80, 0x24, 0x00, 0x21, 0x41,
+    0x41, 0x16, 0x00, 0x20, 0x83, 0x80, 0xcb, 0x14, 0x05, 0x37, 0x00, 0x06, 0xe9, 0x0b, 0x00, 0x36,
+    0x00, 0x13, 0x41, 0x14, 0x0c, 0x0f, 0x58, 0x00, 0x04, 0x25, 0x3e, 0xb2, 0x80, 0x16, 0x01, 0xd0,
+    0x0c, 0x00, 0xb8, 0x0b, 0x60, 0x15, 0x15, 0x15, 0x44, 0x1c, 0xeb, 0xd0, 0x0b, 0x50, 0xb2, 0xb2,
+    0x89, 0x3d, 0xb2, 0xb9, 0x00, 0x30, 0x44, 0x44, 0x1c, 0xdc, 0x00, 0x10, 0x1c, 0x1d, 0x00, 0x11,
+    0x1c, 0xcb, 0x00, 0x03, 0xfe, 0x00, 0x10, 0xeb, 0xc5, 0x04, 0x00, 0x38, 0x00, 0x01, 0x0f, 0x0d,
+    0x21, 0x07, 0x15, 0xeb, 0x00, 0x01, 0x20, 0x0c, 0x10, 0xb2, 0xee, 0x00, 0x01, 0xfa, 0x0b, 0x0f,
+    0x58, 0x00, 0x09, 0x00, 0x80, 0x16, 0x00, 0x80, 0x09, 0x31, 0x3d, 0x2a, 0x80, 0x5a, 0x13, 0x10,
+    0x83, 0x1f, 0x02, 0x03, 0xa9, 0x0d, 0x20, 0x6e, 0x6e, 0x6d, 0x15, 0x00, 0xc8, 0x02, 0x21, 0x12,
+    0x12, 0x53, 0x11, 0x00, 0xbc, 0x04, 0x10, 0x12, 0x4e, 0x08, 0xa0, 0x75, 0x0a, 0x1c, 0xf6, 0x07,
+    0x15, 0xf6, 0x89, 0x07, 0xf6, 0xe6, 0x06, 0x20, 0x89, 0x3d, 0xfe, 0x04, 0x01, 0x5a, 0x0f, 0x00,
+    0x54, 0x09, 0x00, 0x0e, 0x0b, 0x01, 0xf7, 0x04, 0x01, 0xe7, 0x12, 0x11, 0x2a, 0xf1, 0x0f, 0x0f,
+    0x58, 0x00, 0x06, 0x11, 0x3e, 0x03, 0x17, 0x10, 0x83, 0x00, 0x17, 0x30, 0x51, 0x6e, 0x51, 0x15,
+    0x11, 0x10, 0xb2, 0x61, 0x02, 0xf0, 0x00, 0x80, 0x2a, 0x2a, 0x6e, 0x12, 0x89, 0xb2, 0xf6, 0x65,
+    0x1c, 0xeb, 0x07, 0xf6, 0xb2, 0x07, 0xd3, 0x04, 0x00, 0x54, 0x05, 0xd0, 0x08, 0x89, 0x3d, 0x3d,
+    0x65, 0xf6, 0xeb, 0x89, 0x07, 0x12, 0x3d, 0x17, 0xf6, 0xd5, 0x02, 0x00, 0x8c, 0x16, 0x90, 0x08,
+    0x89, 0x07, 0xf6, 0x1c, 0x1c, 0x3d, 0xb2, 0xb2, 0x7e, 0x07, 0x00, 0x74, 0x0b, 0x01, 0x7c, 0x05,
+    0x03, 0x95, 0x0f, 0x00, 0x78, 0x09, 0x0f, 0x58, 0x00, 0x09, 0x02, 0x80, 0x17, 0x01, 0x00, 0x03,
+    0x00, 0x20, 0x10, 0x10, 0x6e, 0xe9, 0x0b, 0x00, 0x1f, 0x05, 0x00, 0xe1, 0x0f, 0x01, 0x24, 0x14,
+    0x01, 0x73, 0x03, 0x50, 0x3d, 0x07, 0x12, 0x12, 0x12, 0x38, 0x00, 0x00, 0x73, 0x05, 0x11, 0xeb,
+    0x55, 0x0a, 0x01, 0xc6, 0x00, 0x01, 0x5c, 0x01, 0x41, 0xeb, 0x3d, 0x12, 0x12, 0xdc, 0x02, 0x40,
+    0xb2, 0xeb, 0x89, 0xeb, 0x13, 0x17, 0x01, 0x16, 0x06, 0x01, 0x10, 0x0f, 0x00, 0xb0, 0x08, 0x1f,
+    0x51, 0x58, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x00, 0x80, 0x03, 0x31, 0xb2, 0x08, 0x83, 0x20, 0x10,
+    0x00, 0x1b, 0x0f, 0x00, 0x64, 0x0b, 0x11, 0x80, 0xc7, 0x16, 0x01, 0x3e, 0x01, 0x01, 0xae, 0x04,
+    0x00, 0x43, 0x08, 0x00, 0xb3, 0x03, 0xf0, 0x04, 0x65, 0x07, 0x75, 0x15, 0x07, 0x15, 0x65, 0x07,
+    0x07, 0xf6, 0x75, 0xf6, 0xeb, 0x89, 0x3d, 0x89, 0x3d, 0x12, 0x6e, 0x0b, 0x06, 0x02, 0xe9, 0x0a,
+    0x10, 0x89, 0xef, 0x01, 0x12, 0xeb, 0xdd, 0x0c, 0x00, 0x9d, 0x0a, 0x4f, 0x6e, 0x6e, 0x51, 0x08,
+    0x58, 0x00, 0x0c, 0xa1, 0x3e, 0x2a, 0x80, 0x3d, 0xf6, 0x80, 0x02, 0x3d, 0x07, 0xf6, 0x5e, 0x04,
+    0x40, 0x89, 0x6e, 0x89, 0xf6, 0xb7, 0x04, 0x01, 0xce, 0x12, 0x00, 0x26, 0x00, 0x00, 0x68, 0x07,
+    0x00, 0xed, 0x12, 0x01, 0xe0, 0x03, 0x02, 0x38, 0x0c, 0x20, 0x2a, 0x51, 0xd9, 0x09, 0x02, 0xfe,
+    0x05, 0x02, 0x54, 0x04, 0x00, 0x04, 0x07, 0x03, 0xdb, 0x03, 0x01, 0xf9, 0x0a, 0x21, 0x89, 0x51,
+    0x8d, 0x13, 0x00, 0x80, 0x00, 0x00, 0x1f, 0x02, 0x0f, 0x58, 0x00, 0x09, 0xa1, 0x3d, 0xf6, 0x80,
+    0x16, 0x15, 0x80, 0x02, 0xb2, 0x07, 0x08, 0xaf, 0x12, 0x00, 0xb7, 0x09, 0x01, 0xa5, 0x13, 0x00,
+    0x33, 0x00, 0x00, 0x28, 0x07, 0x53, 0x12, 0x07, 0xf6, 0xeb, 0x15, 0x5a, 0x0d, 0x01, 0x64, 0x09,
+    0x20, 0x07, 0xf6, 0x59, 0x0c, 0x00, 0x51, 0x00, 0x12, 0x12, 0x48, 0x05, 0x00, 0x6f, 0x07, 0x22,
+    0x2a, 0x43, 0x76, 0x17, 0x00, 0xf0, 0x04, 0x01, 0x2b, 0x12, 0x01, 0xf0, 0x11, 0x10, 0x83, 0xe9,
+    0x00, 0x2f, 0x51, 0x02, 0x58, 0x00, 0x0a, 0x20, 0x16, 0x15, 0x00, 0x13, 0x51, 0x43, 0x07, 0x1a,
+    0x0a, 0x42, 0xa3, 0x0d, 0x11, 0x08, 0xb9, 0x0d, 0x02, 0xa8, 0x0c, 0x30, 0xb2, 0x89, 0x6e, 0xd2,
+    0x0a, 0x00, 0x31, 0x0d, 0x02, 0xb2, 0x0d, 0x20, 0x6e, 0xb2, 0x3b, 0x13, 0x21, 0x08, 0xf6, 0x4c,
+    0x10, 0x02, 0x97, 0x0b, 0x01, 0xc9, 0x19, 0x01, 0x63, 0x01, 0x00, 0xdb, 0x06, 0x20, 0x6e, 0x89,
+    0xd5, 0x06, 0x00, 0xed, 0x02, 0x40, 0x42, 0x43, 0x83, 0x83, 0x2a, 0x14, 0x01, 0x13, 0x09, 0x0f,
+    0x58, 0x00, 0x08, 0x50, 0x07, 0x89, 0x80, 0x07, 0x2a, 0x80, 0x03, 0x10, 0x08, 0x16, 0x17, 0x40,
+    0x43, 0x83, 0x51, 0x08, 0xd6, 0x08, 0x10, 0x51, 0x69, 0x0c, 0x53, 0xb2, 0xb2, 0x6e, 0x3d, 0x07,
+    0x52, 0x12, 0x01, 0x48, 0x08, 0x01, 0xc9, 0x12, 0x22, 0x89, 0x2a, 0xd0, 0x09, 0x04, 0x6a, 0x08,
+    0x01, 0xe7, 0x02, 0x01, 0x0b, 0x12, 0x00, 0x5b, 0x01, 0x52, 0x12, 0x08, 0x6e, 0x89, 0xb2, 0x95,
+    0x18, 0x01, 0x04, 0x15, 0x00, 0x7b, 0x06, 0x0f, 0x58, 0x00, 0x0a, 0x60, 0x07, 0x2a, 0x3c, 0x3e,
+    0xeb, 0x43, 0x00, 0x1c, 0x11, 0x80, 0x96, 0x0d, 0x00, 0x63, 0x19, 0x20, 0x2a, 0x6e, 0x8c, 0x00,
+    0x02, 0xaa, 0x0e, 0x01, 0xae, 0x08, 0x00, 0x1a, 0x00, 0x01, 0x43, 0x10, 0x05, 0x6b, 0x00, 0x04,
+    0xfd, 0x0a, 0x00, 0xfa, 0x00, 0x60, 0xeb, 0x89, 0xeb, 0x07, 0x89, 0x51, 0x70, 0x0c, 0x34, 0x65,
+    0x3d, 0xf6, 0x2f, 0x00, 0x01, 0x1f, 0x08, 0x00, 0x2d, 0x02, 0x01, 0xea, 0x16, 0x0f, 0x58, 0x00,
+    0x07, 0x50, 0x3e, 0xeb, 0x43, 0x3d, 0x51, 0x80, 0x17, 0x51, 0x89, 0x83, 0x6e, 0x43, 0x55, 0x32,
+    0x02, 0x10, 0x89, 0x52, 0x18, 0x50, 0x80, 0x83, 0x2a, 0x2a, 0xf2, 0xa7, 0x01, 0x00, 0xec, 0x03,
+    0x10, 0x3d, 0x60, 0x12, 0x00, 0x2e, 0x02, 0x20, 0x2a, 0x2a, 0xd1, 0x09, 0x11, 0x2a, 0x45, 0x03,
+    0x20, 0x89, 0x51, 0x5a, 0x01, 0x11, 0x08, 0xdb, 0x01, 0x02, 0x0b, 0x0a, 0x20, 0x6e, 0x08, 0x7f,
+    0x01, 0x41, 0xeb, 0x3d, 0x1c, 0x3d, 0x8f, 0x0a, 0x10, 0x43, 0x6a, 0x1a, 0x00, 0xf1, 0x03, 0x0f,
+    0x58, 0x00, 0x09, 0x30, 0x3d, 0x51, 0x3c, 0x00, 0x09, 0x01, 0x00, 0x0a, 0x00, 0xba, 0x17, 0x10,
+    0x51, 0x4c, 0x0c, 0x00, 0x5e, 0x00, 0x60, 0x2a, 0x89, 0x6e, 0xb2, 0x12, 0x12, 0x5f, 0x01, 0x51,
+    0xb2, 0x07, 0x07, 0x12, 0x6e, 0x59, 0x0d, 0x90, 0x89, 0x89, 0xeb, 0x89, 0x51, 0x89, 0xb2, 0x08,
+    0x08, 0xe2, 0x02, 0x01, 0xeb, 0x0c, 0x00, 0x50, 0x01, 0x62, 0x89, 0x89, 0x43, 0x89, 0x07, 0x75,
+    0x9a, 0x0d, 0x01, 0xf9, 0x18, 0x40, 0x08, 0xb2, 0x89, 0x6e, 0xf5, 0x0d, 0x00, 0x63, 0x0e, 0x00,
+    0xff, 0x01, 0x0f, 0x58, 0x00, 0x09, 0x40, 0x1c, 0x89, 0x80, 0x1c, 0x00, 0x09, 0x50, 0x3d, 0xeb,
+    0x83, 0x89, 0x3d, 0xc8, 0x0e, 0x12, 0x51, 0x9d, 0x16, 0x00, 0xd6, 0x01, 0x80, 0x2a, 0x6e, 0x08,
+    0x12, 0x51, 0x89, 0xb2, 0x05, 0xff, 0x07, 0x10, 0x08, 0x5d, 0x15, 0x01, 0x7e, 0x07, 0x33, 0x89,
+    0x3d, 0x15, 0x0e, 0x03, 0x00, 0x80, 0x00, 0x52, 0x51, 0x83, 0x83, 0x80, 0x80, 0xef, 0x0c, 0x00,
+    0x74, 0x00, 0x10, 0x6e, 0x07, 0x0b, 0x01, 0x62, 0x03, 0x30, 0x80, 0x3c, 0x43, 0x84, 0x13, 0x3f,
+    0x6e, 0x6e, 0x43, 0x58, 0x00, 0x0a, 0x22, 0x1c, 0x2a, 0x80, 0x1b, 0x50, 0x3d, 0x2a, 0x3c, 0xf2,
+    0xf2, 0xc2, 0x02, 0x03, 0xd2, 0x1b, 0x01, 0x56, 0x02, 0x02, 0xb4, 0x04, 0x10, 0xb2, 0xd7, 0x16,
+    0x60, 0x08, 0x2a, 0x43, 0x83, 0x89, 0x2a, 0x57, 0x0c, 0x20, 0x6e, 0x43, 0xf9, 0x07, 0x10, 0x89,
+    0x4b, 0x07, 0x21, 0x07, 0xeb, 0xea, 0x14, 0x11, 0x51, 0x88, 0x0b, 0x40, 0x51, 0x2a, 0x43, 0x80,
+    0x44, 0x0d, 0x00, 0x91, 0x10, 0x02, 0x83, 0x0d, 0x01, 0x71, 0x00, 0x2f, 0x83, 0xf8, 0x58, 0x00,
+    0x0a, 0x32, 0x3d, 0x2a, 0x80, 0x80, 0x01, 0x10, 0x51, 0x13, 0x1b, 0x11, 0xf2, 0x2d, 0x06, 0x12,
+    0x51, 0xe8, 0x00, 0x40, 0x12, 0x12, 0x07, 0xf6, 0xd1, 0x04, 0x20, 0x3d, 0x12, 0xdc, 0x02, 0x00,
+    0xe5, 0x01, 0x32, 0x89, 0x89, 0xeb, 0xfa, 0x17, 0x10, 0xf6, 0xc2, 0x11, 0x02, 0xca, 0x1b, 0x00,
+    0x76, 0x05, 0x00, 0x84, 0x01, 0x00, 0xfd, 0x0c, 0x61, 0x51, 0x6e, 0x08, 0x89, 0x43, 0x51, 0xfc,
+    0x01, 0x00, 0x7f, 0x00, 0x00, 0x15, 0x10, 0x00, 0xec, 0x18, 0x0f, 0x58, 0x00, 0x09, 0x00, 0x80,
+    0x01, 0xb0, 0xeb, 0x80, 0x80, 0xb2, 0x06, 0xf6, 0x83, 0xf2, 0xe8, 0x55, 0xf2, 0xa0, 0x00, 0x00,
+    0x9e, 0x04, 0x11, 0x43, 0x51, 0x1e, 0x31, 0x6e, 0x2a, 0x55, 0xc6, 0x1a, 0x01, 0x01, 0x00, 0x01,
+    0xd1, 0x1a, 0x10, 0x6e, 0x7c, 0x00, 0x61, 0x89, 0x89, 0xf6, 0x07, 0x3d, 0x04, 0x49, 0x12, 0x01,
+    0x86, 0x0d, 0x02, 0x1f, 0x16, 0x30, 0x2a, 0x6e, 0xeb, 0xfe, 0x05, 0x01, 0x94, 0x10, 0x50, 0x51,
+    0x2a, 0x83, 0x6e, 0x89, 0x33, 0x19, 0x00, 0x02, 0x00, 0x0f, 0x58, 0x00, 0x0a, 0x21, 0x1c, 0xeb,
+    0x80, 0x0c, 0x20, 0xb2, 0x3d, 0xb4, 0x04, 0x10, 0x43, 0x62, 0x1b, 0x02, 0x5a, 0x0e, 0x10, 0xb2,
+    0x9f, 0x09, 0x00, 0xec, 0x15, 0x01, 0x0f, 0x00, 0x11, 0x3d, 0x51, 0x07, 0x01, 0x84, 0x01, 0x00,
+    0xc3, 0x09, 0x00, 0x50, 0x01, 0x31, 0x3d, 0xb2, 0x89, 0xf5, 0x01, 0x01, 0x51, 0x0c, 0x51, 0x6e,
+    0x6e, 0xb2, 0x04, 0xb2, 0x55, 0x03, 0x01, 0x7e, 0x06, 0x20, 0x2a, 0x83, 0x7b, 0x07, 0x60, 0xb2,
+    0x6e, 0x89, 0x51, 0x83, 0x2a, 0x7d, 0x1a, 0x0f, 0x58, 0x00, 0x08, 0x12, 0x1c, 0x80, 0x01, 0x20,
+    0xb2, 0xb2, 0x9a, 0x13, 0x00, 0x61, 0x02, 0x01, 0x24, 0x02, 0x00, 0xb9, 0x0c, 0x03, 0xdd, 0x00,
+    0x10, 0x12, 0x5a, 0x14, 0x11, 0x89, 0xe4, 0x01, 0x01, 0x54, 0x06, 0x31, 0x83, 0x08, 0x89, 0x3b,
+    0x04, 0x00, 0xbf, 0x02, 0x21, 0x15, 0x89, 0xeb, 0x05, 0x02, 0x0b, 0x11, 0x00, 0x5b, 0x05, 0x22,
+    0x08, 0x2a, 0xec, 0x1d, 0x01, 0x9a, 0x0e, 0x01, 0x89, 0x0f, 0x01, 0x74, 0x1b, 0x0f, 0x58, 0x00,
+    0x08, 0x00, 0x80, 0x01, 0x10, 0x89, 0x80, 0x02, 0x11, 0x6e, 0xa7, 0x19, 0x10, 0x3c, 0xba, 0x1a,
+    0x01, 0x62, 0x16, 0x01, 0xa4, 0x0c, 0x00, 0xe1, 0x05, 0x02, 0xb4, 0x02, 0x10, 0xeb, 0x3c, 0x0d,
+    0x40, 0x89, 0xb2, 0x3e, 0x3d, 0x46, 0x08, 0x02, 0xcd, 0x1d, 0x00, 0x46, 0x04, 0x00, 0x54, 0x0f,
+    0x01, 0x60, 0x06, 0x41, 0x89, 0x89, 0x3e, 0xeb, 0x9b, 0x14, 0x01, 0x80, 0x06, 0x00, 0x1e, 0x02,
+    0x00, 0x0a, 0x03, 0x00, 0x70, 0x01, 0x00, 0x98, 0x20, 0x0f, 0x58, 0x00, 0x07, 0x20, 0x1c, 0x89,
+    0x00, 0x06, 0x00, 0x00, 0x12, 0x01, 0x5e, 0x1d, 0x10, 0xf8, 0x31, 0x1a, 0x20, 0x83, 0x80, 0x33,
+    0x05, 0x01, 0xbb, 0x10, 0x11, 0x30, 0x76, 0x1b, 0x01, 0xb7, 0x1e, 0x30, 0x43, 0x43, 0x02, 0x45,
+    0x19, 0x00, 0xe8, 0x02, 0x00, 0x63, 0x08, 0x00, 0xdd, 0x0d, 0x00, 0x4d, 0x13, 0x00, 0xd2, 0x01,
+    0x00, 0x72, 0x02, 0x00, 0x20, 0x12, 0x11, 0x08, 0x8d, 0x06, 0x00, 0xae, 0x1c, 0x10, 0x43, 0x30,
+    0x01, 0x00, 0x1d, 0x01, 0x01, 0xb8, 0x1b, 0x0f, 0x58, 0x00, 0x08, 0x13, 0x07, 0x00, 0x01, 0x20,
+    0x06, 0x12, 0x16, 0x1b, 0x20, 0xf2, 0xf2, 0x42, 0x1c, 0x01, 0xab, 0x13, 0x00, 0x43, 0x1c, 0x00,
+    0xaf, 0x01, 0x01, 0x27, 0x17, 0x01, 0x80, 0x00, 0x00, 0xed, 0x1d, 0x70, 0xf2, 0x43, 0x51, 0x51,
+    0x89, 0x6e, 0xeb, 0xd7, 0x0c, 0x11, 0xf2, 0x96, 0x1e, 0x10, 0x89, 0x52, 0x1e, 0x10, 0x2a, 0x0f,
+    0x0c, 0x01, 0x02, 0x07, 0x00, 0xe9, 0x04, 0x02, 0x94, 0x18, 0x11, 0xb2, 0x8c, 0x1d, 0x00, 0xfa,
+    0x01, 0x0f, 0x58, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x10, 0x12, 0x00, 0x0d, 0x10, 0x6e, 0x00, 0x12,
+    0x00, 0xaa, 0x20, 0x01, 0xab, 0x1d, 0x01, 0xad, 0x03, 0x01, 0x3d, 0x03, 0x40, 0x2a, 0x83, 0x3c,
+    0x83, 0xef, 0x17, 0x20, 0x2a, 0x43, 0x5e, 0x1e, 0x10, 0xf8, 0x26, 0x01, 0x00, 0xfc, 0x17, 0x70,
+    0x51, 0x08, 0x04, 0x89, 0xb2, 0x6e, 0xf8, 0x64, 0x0d, 0x00, 0x81, 0x14, 0x00, 0x16, 0x0e, 0x10,
+    0x08, 0xe6, 0x18, 0x01, 0xe1, 0x00, 0x20, 0x51, 0xb2, 0x23, 0x1c, 0x02, 0x15, 0x02, 0x01, 0xf9,
+    0x03, 0x0f, 0x58, 0x00, 0x07, 0x50, 0x07, 0x12, 0x80, 0x1c, 0xf6, 0x00, 0x20, 0x52, 0x89, 0x80,
+    0x04, 0x05, 0x4a, 0x9d, 0x22, 0x50, 0x05, 0x4a, 0x4a, 0x3d, 0x07, 0xc2, 0x22, 0x10, 0x4a, 0xc4,
+    0x22, 0x20, 0x4a, 0x4a, 0xdc, 0x22, 0x41, 0x05, 0x07, 0x3d, 0x05, 0xf7, 0x0a, 0x50, 0x3d, 0x4a,
+    0x4a, 0x07, 0x05, 0xdb, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0xfe, 0x0b, 0x00, 0x01, 0x00, 0x81, 0x07,
+    0x75, 0x07, 0x75, 0x07, 0x07, 0x75, 0x75, 0x0d, 0x00, 0x21, 0x75, 0x1c, 0xf2, 0x0b, 0x9f, 0x3d,
+    0x07, 0x47, 0x47, 0x1c, 0x47, 0x47, 0x07, 0x05, 0x58, 0x00, 0x0a, 0x36, 0x1c, 0xf6, 0x80, 0x00,
+    0x18, 0x02, 0xbd, 0x17, 0x01, 0xa6, 0x21, 0x03, 0xde, 0x0b, 0x02, 0x0f, 0x00, 0x00, 0xc4, 0x0b,
+    0x03, 0x0d, 0x00, 0x13, 0x3c, 0xfa, 0x0b, 0x03, 0xd3, 0x0b, 0x03, 0xef, 0x17, 0x03, 0x08, 0x18,
+    0x01, 0x2b, 0x00, 0x05, 0x2a, 0x00, 0x03, 0x4b, 0x00, 0x05, 0x15, 0x18, 0x0f, 0x58, 0x00, 0x02,
+    0x07, 0x00, 0x18, 0xb0, 0x16, 0x0a, 0x1c, 0x15, 0x15, 0x0a, 0x1c, 0x07, 0x1c, 0x75, 0x16, 0xc3,
+    0x00, 0x00, 0xcb, 0x23, 0x30, 0x3e, 0x75, 0x16, 0xd0, 0x00, 0x20, 0x1c, 0x1c, 0xf7, 0x0b, 0xc1,
+    0x1c, 0x16, 0x0a, 0x0a, 0x1c, 0x16, 0x1a, 0x75, 0x75, 0x1c, 0x75, 0x0a, 0xe8, 0x00, 0x10, 0x1a,
+    0x0a, 0x00, 0x00, 0x17, 0x0d, 0xf0, 0x05, 0x16, 0x0a, 0x0a, 0x75, 0x0a, 0x1c, 0x15, 0x1c, 0x1a,
+    0x1a, 0x16, 0x1c, 0x15, 0x1c, 0x1c, 0x0a, 0x0a, 0x1c, 0x1c, 0x75, 0x45, 0x00, 0x00, 0x01, 0x00,
+    0x2f, 0x15, 0x1c, 0x58, 0x00, 0x0a, 0x07, 0x00, 0x18, 0x60, 0xf6, 0xf6, 0x65, 0x65, 0x15, 0x07,
+    0xc7, 0x14, 0x02, 0xa2, 0x1b, 0x01, 0x5b, 0x13, 0x02, 0x4d, 0x03, 0x01, 0xfc, 0x09, 0x30, 0x89,
+    0x12, 0x17, 0x35, 0x0d, 0x40, 0x65, 0x3d, 0x12, 0x17, 0x7e, 0x09, 0xd0, 0x89, 0x51, 0xf6, 0x44,
+    0x12, 0x08, 0x12, 0x3d, 0x3d, 0x07, 0xf6, 0xb2, 0x12, 0x9a, 0x0a, 0x30, 0x17, 0x3d, 0x3d, 0xa8,
+    0x06, 0xff, 0x02, 0x2a, 0x89, 0x65, 0x39, 0x07, 0x07, 0x89, 0x12, 0x65, 0x12, 0x08, 0x43, 0x2a,
+    0x89, 0x12, 0x17, 0x65, 0x58, 0x00, 0x0a, 0x07, 0x00, 0x18, 0x50, 0x17, 0xf6, 0x65, 0xf6, 0x3d,
+    0x86, 0x09, 0x01, 0xd8, 0x02, 0x00, 0xbc, 0x0a, 0x00, 0xf2, 0x05, 0x00, 0x2b, 0x10, 0x00, 0xdd,
+    0x10, 0x00, 0xf1, 0x08, 0x01, 0x82, 0x17, 0x30, 0x12, 0x65, 0x07, 0x39, 0x0f, 0x60, 0x12, 0x3d,
+    0x12, 0x2a, 0x89, 0x65, 0x01, 0x18, 0x00, 0x06, 0x02, 0x20, 0xf6, 0xeb, 0x61, 0x0a, 0x20, 0x12,
+    0x12, 0x70, 0x0b, 0x90, 0x08, 0x08, 0x17, 0x89, 0x89, 0x17, 0x17, 0x12, 0xf6, 0x64, 0x09, 0x3f,
+    0x12, 0x12, 0x44, 0x58, 0x00, 0x0a, 0x07, 0x00, 0x18, 0x20, 0x44, 0x07, 0x12, 0x10, 0x11, 0x3d,
+    0xa7, 0x00, 0x00, 0xc8, 0x13, 0x00, 0xa3, 0x00, 0x50, 0x08, 0x2a, 0x89, 0x44, 0x65, 0xf8, 0x06,
+    0x01, 0xd0, 0x08, 0x10, 0x08, 0x81, 0x00, 0x20, 0xf6, 0x15, 0x46, 0x15, 0x21, 0x2a, 0x08, 0x3e,
+    0x0f, 0x12, 0x65, 0xd1, 0x16, 0x00, 0xec, 0x0e, 0x00, 0x93, 0x00, 0xd0, 0x08, 0x6e, 0x2a, 0x80,
+    0x83, 0x83, 0x08, 0x12, 0x12, 0x3d, 0x08, 0x12, 0x2a, 0x0f, 0x0f, 0x4f, 0x08, 0x08, 0x2a, 0x12,
+    0x58, 0x00, 0x0a, 0x07, 0x00, 0x18, 0x01, 0xcf, 0x0f, 0x00, 0x39, 0x06, 0x50, 0x6e, 0x02, 0x2a,
+    0x83, 0x89, 0x4e, 0x09, 0x10, 0x12, 0xeb, 0x08, 0x32, 0x65, 0xf6, 0x3d, 0x54, 0x0c, 0x80, 0x44,
+    0x15, 0xf6, 0x51, 0x2a, 0x89, 0x0a, 0x07, 0x42, 0x14, 0x00, 0x08, 0x1d, 0xa0, 0x51, 0x89, 0x12,
+    0x2a, 0x17, 0x6e, 0x08, 0x2a, 0x6e, 0x3d, 0x6f, 0x16, 0x01, 0xdf, 0x00, 0x00, 0x28, 0x0b, 0xe2,
+    0x51, 0x51, 0x89, 0x12, 0x65, 0x1c, 0x65, 0x65, 0xf6, 0x2a, 0x89, 0xb2, 0x12, 0x08, 0x7e, 0x14,
+    0x0f, 0x58, 0x00, 0x07, 0x07, 0x00, 0x18, 0x00, 0x31, 0x05, 0x01, 0x1d, 0x16, 0x40, 0x2a, 0x83,
+    0x43, 0x51, 0xdd, 0x06, 0x60, 0x2a, 0x2a, 0x07, 0x15, 0x0a, 0xf6, 0xc1, 0x0b, 0x00, 0x78, 0x0b,
+    0x10, 0xeb, 0xeb, 0x07, 0x30, 0x07, 0x65, 0xf6, 0x39, 0x12, 0x12, 0x2a, 0x03, 0x16, 0x50, 0x12,
+    0x08, 0x17, 0x39, 0x17, 0x19, 0x10, 0x01, 0x81, 0x05, 0x00, 0x03, 0x16, 0x22, 0x89, 0x89, 0xe1,
+    0x09, 0x30, 0x07, 0x17, 0x17, 0x20, 0x01, 0x21, 0x08, 0x08, 0xac, 0x20, 0x0f, 0x58, 0x00, 0x08,
+    0x07, 0x00, 0x18, 0x20, 0x2a, 0x08, 0xc8, 0x08, 0x00, 0xc2, 0x04, 0x01, 0x29, 0x17, 0xd0, 0x2a,
+    0x08, 0xf6, 0xeb, 0x89, 0xf6, 0x89, 0x83, 0x2a, 0x08, 0x08, 0x12, 0xb2, 0x35, 0x17, 0x10, 0x3d,
+    0x68, 0x00, 0x90, 0x12, 0x89, 0x43, 0x6e, 0x08, 0x12, 0x89, 0x75, 0x07, 0x77, 0x01, 0x60, 0x08,
+    0xf6, 0x44, 0x17, 0x12, 0x12, 0x76, 0x12, 0x41, 0x07, 0x89, 0x08, 0x12, 0x92, 0x08, 0x01, 0xa9,
+    0x02, 0x51, 0x6e, 0x6e, 0x89, 0xf6, 0x0a, 0x5f, 0x01, 0x01, 0x75, 0x12, 0x0f, 0x58, 0x00, 0x09,
+    0x07, 0x00, 0x18, 0x10, 0x08, 0xbf, 0x00, 0x12, 0x12, 0x24, 0x0d, 0x60, 0x89, 0x12, 0x6e, 0x6e,
+    0x65, 0x65, 0x69, 0x0b, 0xb2, 0x51, 0x89, 0x2a, 0x08, 0x80, 0x2a, 0x89, 0x12, 0x2a, 0x07, 0x1c,
+    0x6f, 0x0b, 0xb0, 0x2a, 0x89, 0x65, 0x17, 0x08, 0x6e, 0x6e, 0x89, 0x1c, 0x1c, 0x08, 0x0c, 0x1e,
+    0x02, 0xc9, 0x1a, 0x00, 0x1e, 0x19, 0x11, 0x65, 0x05, 0x0e, 0x01, 0x87, 0x05, 0x01, 0xfa, 0x0e,
+    0x8f, 0x3d, 0x07, 0xb2, 0x12, 0x89, 0x08, 0x08, 0x08, 0x58, 0x00, 0x0a, 0x07, 0x00, 0x18, 0x11,
+    0x08, 0x50, 0x00, 0x00, 0x40, 0x08, 0x02, 0x65, 0x1a, 0x00, 0x2f, 0x0f, 0x01, 0x35, 0x11, 0x70,
+    0x08, 0x2a, 0x08, 0x6e, 0x08, 0x12, 0x65, 0xc8, 0x09, 0x00, 0x7b, 0x01, 0x01, 0x8e, 0x1f, 0x90,
+    0x07, 0x11, 0x75, 0x3d, 0x12, 0x51, 0x12, 0x89, 0x51, 0x12, 0x03, 0x61, 0x12, 0x3d, 0x3d, 0x12,
+    0xf6, 0x65, 0x27, 0x12, 0x01, 0x9a, 0x0d, 0x40, 0x43, 0x6e, 0x89, 0x43, 0xfa, 0x05, 0x30, 0xb2,
+    0x3d, 0x6e, 0x80, 0x00, 0x0f, 0x58, 0x00, 0x09, 0x07, 0x00, 0x18, 0x20, 0x08, 0x51, 0x45, 0x18,
+    0x02, 0x21, 0x03, 0x10, 0x6e, 0x5d, 0x08, 0x00, 0xe5, 0x01, 0x01, 0xb4, 0x02, 0x60, 0x12, 0x08,
+    0x6e, 0x08, 0x17, 0xf6, 0xd8, 0x0d, 0x00, 0xcf, 0x12, 0x00, 0x79, 0x01, 0x51, 0x6e, 0x89, 0x12,
+    0x16, 0x65, 0x8b, 0x08, 0x02, 0x87, 0x0c, 0x51, 0x6e, 0x65, 0x12, 0x07, 0x12, 0x0f, 0x07, 0x01,
+    0x5a, 0x07, 0x01, 0xf9, 0x0a, 0x20, 0x43, 0x6e, 0xf0, 0x0a, 0x00, 0xb0, 0x0c, 0x0f, 0x58, 0x00,
+    0x08, 0x07, 0x00, 0x18, 0x00, 0x2d, 0x03, 0x00, 0x5e, 0x1e, 0x00, 0x1f, 0x25, 0x02, 0xd0, 0x0b,
+    0x20, 0x2a, 0x2a, 0xfa, 0x01, 0x61, 0x3c, 0x43, 0x2a, 0x12, 0x89, 0x17, 0x83, 0x1b, 0x01, 0x3e,
+    0x03, 0x20, 0x6e, 0x6e, 0x67, 0x0c, 0x00, 0xfb, 0x10, 0x00, 0xf4, 0x02, 0x10, 0x08, 0x02, 0x04,
+    0x00, 0x59, 0x0f, 0x01, 0x8a, 0x06, 0x02, 0x92, 0x01, 0x20, 0x6e, 0x89, 0x23, 0x0f, 0x21, 0xf6,
+    0x12, 0x35, 0x0c, 0x1f, 0x43, 0x58, 0x00, 0x0a, 0x01, 0x00, 0x18, 0x32, 0x83, 0x58, 0x83, 0x00,
+    0x18, 0x52, 0x43, 0x2a, 0x83, 0x80, 0x83, 0x58, 0x08, 0x90, 0x2a, 0x2a, 0x83, 0x83, 0x89, 0x89,
+    0x07, 0x1c, 0x89, 0xb0, 0x21, 0x10, 0x83, 0xd2, 0x0a, 0x02, 0xe5, 0x0d, 0x51, 0x2a, 0x2a, 0x12,
+    0x65, 0x65, 0xfd, 0x20, 0x11, 0xeb, 0xd7, 0x02, 0x00, 0x07, 0x03, 0x01, 0x4c, 0x14, 0x00, 0xd2,
+    0x10, 0x10, 0x08, 0x87, 0x00, 0x60, 0x3d, 0x07, 0x07, 0x17, 0x07, 0x65, 0x14, 0x14, 0x02, 0x73,
+    0x04, 0x0f, 0x58, 0x00, 0x0a, 0x40, 0x1c, 0x07, 0x83, 0x3d, 0x0e, 0x08, 0x31, 0x42, 0x83, 0x3c,
+    0x3c, 0x0c, 0x03, 0xa3, 0x21, 0x00, 0x37, 0x26, 0x02, 0xa9, 0x15, 0x01, 0x28, 0x0e, 0x30, 0xb2,
+    0x83, 0x6e, 0xc6, 0x00, 0x11, 0x08, 0xde, 0x03, 0x00, 0xe8, 0x04, 0x60, 0x6e, 0x08, 0x08, 0x07,
+    0x0a, 0xf6, 0x21, 0x00, 0x62, 0x51, 0x6e, 0x3d, 0x89, 0x12, 0x65, 0x19, 0x15, 0x00, 0x63, 0x17,
+    0xc0, 0x89, 0x07, 0x75, 0x65, 0xf6, 0x17, 0x65, 0x12, 0x17, 0x3d, 0xf6, 0x3d, 0x24, 0x14, 0x03,
+    0x8d, 0x25, 0x0f, 0x58, 0x00, 0x05, 0x80, 0x3d, 0x43, 0x30, 0xb2, 0x83, 0x43, 0x80, 0x6e, 0x00,
+    0x18, 0x01, 0x22, 0x01, 0x10, 0x83, 0x67, 0x09, 0x11, 0xb2, 0xad, 0x11, 0x00, 0xec, 0x1f, 0x20,
+    0x83, 0x2a, 0xca, 0x04, 0x40, 0x43, 0x2a, 0x65, 0x08, 0xc5, 0x04, 0x00, 0x3d, 0x01, 0xf0, 0x00,
+    0x51, 0x08, 0x89, 0x12, 0x08, 0x2a, 0x3d, 0x0a, 0x11, 0x0a, 0x89, 0x43, 0x89, 0x3d, 0xb2, 0x99,
+    0x09, 0xf0, 0x05, 0x2a, 0x89, 0x89, 0x43, 0x83, 0x2a, 0x08, 0x17, 0x15, 0x15, 0xf6, 0x89, 0x89,
+    0xeb, 0x65, 0x07, 0x65, 0x44, 0xf6, 0x17, 0xe3, 0x0c, 0x00, 0x61, 0x25, 0x02, 0x8c, 0x0a, 0x0f,
+    0x58, 0x00, 0x06, 0xb0, 0xb2, 0x83, 0x43, 0xb2, 0x2a, 0x6e, 0xcc, 0x43, 0x42, 0x2a, 0x3c, 0x95,
+    0x0d, 0x11, 0x6e, 0x99, 0x02, 0x20, 0x3d, 0xb2, 0x2a, 0x06, 0x01, 0xb9, 0x03, 0x01, 0xf0, 0x0a,
+    0x01, 0x42, 0x03, 0x21, 0x08, 0x08, 0xea, 0x21, 0x30, 0x89, 0xf6, 0x12, 0x79, 0x17, 0x22, 0x15,
+    0x15, 0x8d, 0x20, 0x10, 0x80, 0x70, 0x04, 0x10, 0x89, 0xe4, 0x14, 0x20, 0x08, 0x08, 0x54, 0x19,
+    0x70, 0x65, 0x07, 0x89, 0x08, 0xf6, 0xf6, 0x07, 0x80, 0x00, 0x10, 0x89, 0x71, 0x02, 0x00, 0xff,
+    0x1a, 0x0f, 0x58, 0x00, 0x09, 0xb0, 0xb2, 0x2a, 0x6e, 0x1c, 0x2a, 0xcc, 0x83, 0xcc, 0xb2, 0x43,
+    0x80, 0xe5, 0x1e, 0x01, 0xbd, 0x0f, 0x11, 0x08, 0x2d, 0x29, 0x01, 0x36, 0x05, 0x60, 0x43, 0x89,
+    0x08, 0x2a, 0xb2, 0x44, 0xca, 0x01, 0x00, 0xcf, 0x0e, 0x00, 0x3d, 0x00, 0x80, 0x51, 0x12, 0x07,
+    0x2a, 0x89, 0x15, 0x0a, 0x3d, 0x93, 0x20, 0x32, 0x08, 0x51, 0x6e, 0x45, 0x1b, 0x10, 0x51, 0x19,
+    0x06, 0x00, 0x87, 0x04, 0x20, 0x75, 0x65, 0x2a, 0x12, 0x50, 0xf6, 0x3d, 0x12, 0x12, 0x12, 0xe1,
+    0x10, 0x10, 0x83, 0x7f, 0x00, 0x0f, 0x58, 0x00, 0x0a, 0xb0, 0x1c, 0x2a, 0xcc, 0x75, 0x15, 0x6e,
+    0x55, 0x6e, 0x3d, 0xb2, 0x43, 0xb7, 0x18, 0x01, 0x63, 0x00, 0x00, 0x35, 0x0f, 0x00, 0x40, 0x03,
+    0x20, 0x89, 0x07, 0xed, 0x24, 0x10, 0x1c, 0x5b, 0x1f, 0x20, 0x3d, 0xb2, 0x53, 0x11, 0x20, 0x2a,
+    0x83, 0x4a, 0x15, 0x10, 0x89, 0x46, 0x04, 0x00, 0x00, 0x23, 0x10, 0x3d, 0x96, 0x0b, 0x11, 0x08,
+    0x93, 0x1f, 0x30, 0xf6, 0x12, 0xf6, 0x9f, 0x0f, 0x20, 0x6e, 0xeb, 0x11, 0x23, 0x00, 0xaa, 0x12,
+    0x00, 0xac, 0x1d, 0x00, 0x8b, 0x04, 0x10, 0xcc, 0x77, 0x1a, 0x0f, 0x58, 0x00, 0x08, 0x60, 0x75,
+    0x15, 0x6e, 0x1c, 0x89, 0x55, 0x56, 0x1a, 0x20, 0x83, 0xcc, 0xa8, 0x0b, 0x00, 0xa0, 0x02, 0x00,
+    0x2a, 0x0a, 0x04, 0x6b, 0x1f, 0x50, 0x12, 0x07, 0xb2, 0x89, 0x51, 0xad, 0x12, 0x00, 0x59, 0x10,
+    0x01, 0xd0, 0x06, 0x41, 0x80, 0x43, 0x08, 0x65, 0xc2, 0x1d, 0x03, 0xfa, 0x19, 0x60, 0x89, 0xf6,
+    0x07, 0x12, 0x12, 0x08, 0x79, 0x10, 0x00, 0x8e, 0x04, 0x01, 0x1c, 0x1e, 0x50, 0x2a, 0x2a, 0x6e,
+    0x08, 0x80, 0x48, 0x00, 0x5f, 0x43, 0xcc, 0x6e, 0x51, 0xcc, 0x58, 0x00, 0x0a, 0x30, 0x1c, 0x89,
+    0x55, 0x30, 0x24, 0x30, 0x6e, 0xb2, 0x08, 0x8e, 0x2a, 0x00, 0x2f, 0x02, 0x00, 0x2a, 0x10, 0x01,
+    0x2e, 0x0d, 0x00, 0x62, 0x0c, 0x00, 0xd4, 0x13, 0x02, 0x56, 0x19, 0x50, 0x12, 0x6e, 0x3d, 0x6e,
+    0x89, 0xfc, 0x25, 0x20, 0x1c, 0x07, 0x49, 0x12, 0x02, 0x47, 0x19, 0x00, 0xca, 0x01, 0x00, 0xc9,
+    0x0d, 0x22, 0x89, 0xf6, 0xa5, 0x1d, 0x00, 0xf0, 0x06, 0x01, 0x66, 0x03, 0x73, 0x6e, 0x2a, 0x2a,
+    0x80, 0x3c, 0x43, 0x6e, 0xfd, 0x1e, 0x0f, 0x58, 0x00, 0x08, 0xb2, 0xb2, 0x2a, 0x43, 0x3e, 0x89,
+    0xcc, 0x83, 0xcc, 0x3d, 0x08, 0x3c, 0x22, 0x1f, 0x02, 0x2b, 0x10, 0x30, 0x89, 0xeb, 0x65, 0xa5,
+    0x04, 0x10, 0x83, 0x32, 0x14, 0x50, 0xb2, 0xf6, 0x65, 0x15, 0xf6, 0x1f, 0x11, 0x20, 0x12, 0x12,
+    0x14, 0x00, 0x01, 0xc1, 0x06, 0x21, 0x6e, 0xcc, 0x64, 0x1c, 0x40, 0x89, 0x08, 0x89, 0x15, 0x16,
+    0x11, 0x02, 0x74, 0x00, 0x00, 0x8b, 0x01, 0x12, 0x3c, 0xdc, 0x24, 0x00, 0x7e, 0x12, 0x01, 0x32,
+    0x0e, 0x02, 0x25, 0x01, 0x0f, 0x58, 0x00, 0x07, 0xf0, 0x09, 0x3e, 0x89, 0xcc, 0x1c, 0x07, 0x6e,
+    0x83, 0x6e, 0x3d, 0x08, 0x83, 0x6e, 0x2a, 0x3d, 0x3d, 0x43, 0x6e, 0xb2, 0x3d, 0xeb, 0xeb, 0x89,
+    0x43, 0x51, 0xaf, 0x0c, 0x02, 0xd8, 0x0c, 0x21, 0x6e, 0x04, 0x29, 0x13, 0x02, 0x5b, 0x21, 0x22,
+    0x43, 0xcc, 0xbe, 0x1f, 0x92, 0x89, 0x07, 0x65, 0x65, 0x6e, 0x89, 0x07, 0xf6, 0x65, 0xe0, 0x1a,
+    0x01, 0x67, 0x03, 0xc2, 0x6e, 0x08, 0x43, 0x08, 0x2a, 0x51, 0x89, 0x65, 0x89, 0xb2, 0x65, 0x3d,
+    0x96, 0x0e, 0x11, 0x42, 0x9a, 0x03, 0x0f, 0x58, 0x00, 0x0a, 0x80, 0x1c, 0x07, 0x6e, 0x3e, 0x2a,
+    0x55, 0x2a, 0x6e, 0x00, 0x15, 0x00, 0x22, 0x0d, 0x02, 0xed, 0x23, 0x00, 0x47, 0x05, 0x10, 0x80,
+    0x29, 0x0c, 0x50, 0x08, 0x08, 0xb2, 0xb2, 0x04, 0x3b, 0x11, 0x00, 0xe6, 0x05, 0x20, 0xb2, 0x08,
+    0x60, 0x2b, 0x51, 0x6e, 0x89, 0x3d, 0x12, 0x65, 0x7e, 0x0b, 0x00, 0xce, 0x21, 0x01, 0xfa, 0x28,
+    0x02, 0xe9, 0x15, 0x41, 0x6e, 0x08, 0x65, 0x65, 0x8c, 0x1d, 0x01, 0xe6, 0x04, 0x00, 0xe6, 0x03,
+    0x02, 0xe6, 0x27, 0x0f, 0x58, 0x00, 0x0a, 0xc0, 0x3e, 0x2a, 0x55, 0x3e, 0x89, 0x02, 0x43, 0x6e,
+    0xb2, 0x2a, 0x3c, 0xb2, 0xae, 0x22, 0x00, 0xa0, 0x22, 0x40, 0x1c, 0x07, 0x15, 0x07, 0x07, 0x00,
+    0x60, 0x3d, 0x07, 0x3d, 0x15, 0x07, 0x1c, 0xc1, 0x17, 0x01, 0xe1, 0x16, 0x00, 0xfe, 0x0b, 0x42,
+    0x16, 0x16, 0x75, 0x0a, 0xbe, 0x17, 0x00, 0xf7, 0x09, 0x31, 0x1c, 0x15, 0x15, 0xcf, 0x0a, 0x02,
+    0xf7, 0x0b, 0x40, 0x75, 0x75, 0x07, 0x15, 0xde, 0x22, 0x02, 0xed, 0x16, 0x02, 0x23, 0x17, 0x00,
+    0xef, 0x0a, 0x0f, 0x58, 0x00, 0x0a, 0xb5, 0x3e, 0x89, 0x02, 0x3e, 0xb2, 0xcc, 0x43, 0x6e, 0xb2,
+    0x08, 0x83, 0xa7, 0x17, 0x09, 0xc0, 0x17, 0x01, 0xa8, 0x0b, 0x04, 0xb3, 0x0b, 0x02, 0xfc, 0x17,
+    0x01, 0xc8, 0x2f, 0x07, 0x01, 0x00, 0x02, 0x11, 0x18, 0x10, 0x3c, 0x1b, 0x0d, 0x02, 0x1e, 0x0c,
+    0x07, 0xff, 0x0b, 0x3f, 0x41, 0x41, 0x58, 0x58, 0x00, 0x0a, 0x80, 0x3e, 0xb2, 0xcc, 0x3e, 0x6e,
+    0xcc, 0x43, 0x6e, 0x00, 0x18, 0x15, 0x1c, 0x9f, 0x24, 0xb0, 0xeb, 0xeb, 0xeb, 0x1c, 0x07, 0xeb,
+    0x1c, 0x15, 0x07, 0xeb, 0xeb, 0xe8, 0x06, 0x03, 0xcc, 0x00, 0x20, 0xeb, 0xeb, 0x0f, 0x00, 0x60,
+    0x07, 0x0a, 0x75, 0x16, 0x0a, 0x1c, 0x88, 0x1c, 0x40, 0x07, 0x1c, 0x07, 0xeb, 0xfa, 0x18, 0x00,
+    0x27, 0x00, 0x10, 0xeb, 0x03, 0x0d, 0x44, 0x1c, 0x75, 0x16, 0x0a, 0x2f, 0x00, 0x00, 0x20, 0x00,
+    0x03, 0x01, 0x00, 0x0f, 0x58, 0x00, 0x09, 0xb0, 0x3e, 0x6e, 0xcc, 0x3e, 0x43, 0x30, 0x80, 0x43,
+    0x3d, 0x2a, 0x80, 0xa1, 0x10, 0x00, 0x1a, 0x05, 0x02, 0xc8, 0x09, 0x10, 0xb2, 0x52, 0x03, 0x00,
+    0xce, 0x07, 0x01, 0x59, 0x03, 0x71, 0x89, 0x3d, 0x89, 0x2a, 0x6e, 0xeb, 0x65, 0x60, 0x0a, 0x80,
+    0x2a, 0x83, 0x2a, 0x51, 0xb2, 0x89, 0x08, 0xeb, 0x5a, 0x1e, 0x20, 0x08, 0xf6, 0x14, 0x08, 0x00,
+    0x95, 0x09, 0x10, 0x43, 0x61, 0x17, 0xb1, 0x89, 0x3d, 0x07, 0x0a, 0x75, 0x75, 0x07, 0x12, 0x08,
+    0x6e, 0x02, 0xa5, 0x14, 0x10, 0xb2, 0x75, 0x1c, 0x0f, 0x58, 0x00, 0x0a, 0xf1, 0x00, 0x3e, 0x43,
+    0x30, 0x3e, 0x6e, 0x02, 0x80, 0x43, 0x3d, 0x89, 0x83, 0xf8, 0x2a, 0x6e, 0xb2, 0xa8, 0x1a, 0x01,
+    0x6f, 0x0b, 0x00, 0x3d, 0x06, 0x00, 0x35, 0x18, 0x03, 0x4d, 0x17, 0x00, 0x37, 0x0c, 0x01, 0x6a,
+    0x16, 0x03, 0x5c, 0x17, 0x00, 0x43, 0x20, 0x00, 0xf0, 0x26, 0x20, 0x2a, 0xeb, 0x7d, 0x1d, 0x00,
+    0x59, 0x06, 0x12, 0x12, 0x74, 0x20, 0x01, 0xf3, 0x01, 0x50, 0xf6, 0x15, 0xeb, 0x15, 0x75, 0x91,
+    0x24, 0x4f, 0xeb, 0xb2, 0x89, 0x51, 0x58, 0x00, 0x0a, 0x51, 0x3e, 0x6e, 0x02, 0x3e, 0x6e, 0x00,
+    0x01, 0x00, 0xc0, 0x2c, 0x02, 0x29, 0x23, 0x00, 0x9b, 0x07, 0x01, 0x46, 0x0a, 0x00, 0xf3, 0x05,
+    0x01, 0x66, 0x24, 0x11, 0xb2, 0x2c, 0x12, 0x01, 0xcc, 0x03, 0x01, 0x38, 0x17, 0x00, 0xcb, 0x10,
+    0x20, 0x3d, 0x07, 0x0b, 0x21, 0x00, 0xc5, 0x04, 0x00, 0x7c, 0x03, 0x01, 0x10, 0x05, 0x20, 0x12,
+    0x89, 0x97, 0x0a, 0x10, 0x2a, 0x79, 0x06, 0x13, 0xeb, 0x20, 0x24, 0x00, 0xbb, 0x12, 0x0f, 0x58,
+    0x00, 0x09, 0x80, 0x3e, 0x6e, 0x30, 0x3e, 0x2a, 0x02, 0x80, 0x55, 0x00, 0x18, 0x01, 0xc8, 0x2b,
+    0x00, 0x61, 0x10, 0x10, 0x6e, 0xb9, 0x13, 0x01, 0x74, 0x01, 0x00, 0xc9, 0x14, 0x10, 0x08, 0x50,
+    0x04, 0x00, 0xf7, 0x09, 0x01, 0x73, 0x17, 0x20, 0xeb, 0x89, 0x5a, 0x27, 0x01, 0xe3, 0x12, 0x01,
+    0x57, 0x25, 0x00, 0x81, 0x09, 0x00, 0x53, 0x0c, 0x20, 0x07, 0x89, 0x07, 0x10, 0x00, 0x22, 0x01,
+    0x81, 0xeb, 0x89, 0xeb, 0xeb, 0x08, 0xeb, 0xf6, 0xf6, 0xa8, 0x11, 0x01, 0x80, 0x03, 0x0f, 0x58,
+    0x00, 0x08, 0xa0, 0x3e, 0x2a, 0x02, 0x3d, 0xf6, 0xcc, 0x02, 0x6e, 0x07, 0xf6, 0x4d, 0x21, 0x00,
+    0x53, 0x06, 0x03, 0x6e, 0x18, 0x00, 0xeb, 0x2b, 0x00, 0x75, 0x08, 0x50, 0x6e, 0x07, 0x07, 0x12,
+    0xf6, 0xc7, 0x00, 0x02, 0xf0, 0x1d, 0x01, 0x88, 0x13, 0x32, 0x6e, 0x89, 0x43, 0x4f, 0x25, 0x01,
+    0x0f, 0x00, 0x03, 0x0e, 0x24, 0x01, 0x59, 0x14, 0x01, 0x7e, 0x0a, 0x00, 0x82, 0x00, 0x02, 0xb5,
+    0x01, 0x41, 0x89, 0x12, 0xb2, 0x89, 0x15, 0x2b, 0x0f, 0x58, 0x00, 0x06, 0xb0, 0x3d, 0xf6, 0xcc,
+    0x16, 0x15, 0xcc, 0x55, 0x6e, 0x07, 0x08, 0x3c, 0xca, 0x12, 0x40, 0x89, 0x17, 0xf6, 0x08, 0x63,
+    0x05, 0x01, 0x4d, 0x23, 0x10, 0x89, 0x23, 0x22, 0x00, 0xd4, 0x0d, 0x20, 0x08, 0x3d, 0x4c, 0x01,
+    0x00, 0xfa, 0x06, 0x00, 0x66, 0x17, 0x00, 0x57, 0x28, 0x00, 0x02, 0x18, 0x02, 0x82, 0x16, 0x01,
+    0xfd, 0x00, 0x02, 0xd9, 0x12, 0x00, 0x22, 0x00, 0x01, 0x04, 0x02, 0x10, 0x51, 0xe7, 0x1f, 0x00,
+    0x7e, 0x13, 0x02, 0x97, 0x11, 0x0f, 0x58, 0x00, 0x09, 0x82, 0x16, 0x15, 0xcc, 0x07, 0x89, 0xcc,
+    0x43, 0x6e, 0x00, 0x18, 0x01, 0x1d, 0x00, 0x02, 0xa0, 0x16, 0x01, 0xba, 0x0a, 0x00, 0xc5, 0x21,
+    0x02, 0x6c, 0x15, 0x00, 0xe6, 0x05, 0x51, 0xeb, 0x08, 0x51, 0x89, 0x3d, 0x6a, 0x06, 0x03, 0x0f,
+    0x18, 0x12, 0x2a, 0xd1, 0x08, 0x10, 0xb2, 0xf0, 0x15, 0x10, 0x07, 0x95, 0x0a, 0x01, 0x8a, 0x21,
+    0x10, 0x08, 0xe5, 0x0c, 0x02, 0x60, 0x12, 0x10, 0x3d, 0xb6, 0x02, 0x0f, 0x58, 0x00, 0x0b, 0xb1,
+    0x89, 0xcc, 0x07, 0x2a, 0x02, 0x43, 0xcc, 0x3d, 0x08, 0x83, 0xcc, 0x19, 0x01, 0x00, 0xb7, 0x08,
+    0x01, 0x4b, 0x01, 0x02, 0x62, 0x2b, 0x00, 0x3b, 0x18, 0x01, 0xc8, 0x25, 0x00, 0x14, 0x00, 0x00,
+    0x05, 0x16, 0x01, 0xe4, 0x23, 0x00, 0x85, 0x01, 0x02, 0x4d, 0x18, 0x02, 0x12, 0x03, 0x01, 0x9d,
+    0x1f, 0x04, 0xde, 0x24, 0x00, 0xad, 0x19, 0x00, 0x9e, 0x08, 0x00, 0xff, 0x12, 0x00, 0x76, 0x06,
+    0x0f, 0x58, 0x00, 0x0a, 0xc0, 0x07, 0x2a, 0x02, 0x3e, 0xeb, 0x55, 0x43, 0x55, 0x3d, 0x89, 0x80,
+    0xcc, 0x5c, 0x06, 0x0f, 0x00, 0x28, 0x3e, 0x2f, 0x89, 0x6e, 0x58, 0x00, 0x0a, 0x40, 0x3e, 0xeb,
+    0x55, 0x3d, 0xa0, 0x08, 0x00, 0x80, 0x34, 0x0f, 0x00, 0x28, 0x41, 0x3f, 0x89, 0x6e, 0xcc, 0x58,
+    0x00, 0x0a, 0x91, 0x3d, 0x51, 0x43, 0x1c, 0x89, 0xcc, 0x80, 0x43, 0xb2, 0x2a, 0x2d, 0x0f, 0x00,
+    0x28, 0x5f, 0xa2, 0x1c, 0x89, 0xcc, 0x1c, 0x2a, 0x55, 0xcc, 0x6e, 0x3d, 0xeb, 0x1f, 0x13, 0x0f,
+    0x00, 0x28, 0x3a, 0x05, 0xbb, 0x31, 0x0f, 0x58, 0x00, 0x07, 0x71, 0x1c, 0x2a, 0x55, 0x3d, 0x2a,
+    0x02, 0x43, 0x00, 0x08, 0x00, 0xa9, 0x09, 0x04, 0x62, 0x05, 0x0f, 0x00, 0x28, 0x36, 0x2f, 0xb2,
+    0xcc, 0x58, 0x00, 0x0a, 0xdf, 0x3d, 0x2a, 0x02, 0x1c, 0x89, 0x02, 0x80, 0x43, 0xb2, 0x51, 0x83,
+    0xb2, 0x43, 0x00, 0x28, 0x40, 0x3f, 0xcc, 0xb2, 0xeb, 0x58, 0x00, 0x0a, 0xef, 0x1c, 0x89, 0x02,
+    0x1c, 0xeb, 0x02, 0x80, 0x55, 0x06, 0xf6, 0x83, 0x89, 0xeb, 0x42, 0x00, 0x28, 0x41, 0x0f, 0x58,
+    0x00, 0x0b, 0x50, 0x1c, 0xeb, 0x02, 0x1c, 0x2a, 0x00, 0x07, 0x00, 0x93, 0x0b, 0x0f, 0x00, 0x28,
+    0x42, 0x00, 0x65, 0x04, 0x0f, 0x58, 0x00, 0x07, 0x10, 0x1c, 0x80, 0x01, 0xbf, 0xcc, 0x83, 0x6e,
+    0xb2, 0x2a, 0x83, 0x6e, 0xb2, 0x08, 0x51, 0x3d, 0x00, 0x28, 0x40, 0x0f, 0x58, 0x00, 0x0a, 0x00,
+    0x00, 0x03, 0x00, 0x80, 0x05, 0x21, 0x3d, 0x6e, 0x00, 0x28, 0x1f, 0x42, 0x00, 0x28, 0x44, 0x0f,
+    0x58, 0x00, 0x06, 0x41, 0x1c, 0x89, 0xcc, 0x07, 0x80, 0x0a, 0x12, 0x6e, 0x99, 0x0d, 0x01, 0xbf,
+    0x0c, 0x0a, 0xa8, 0x27, 0x10, 0x75, 0x7f, 0x20, 0x06, 0x00, 0x28, 0x00, 0xe6, 0x20, 0x0f, 0x00,
+    0x28, 0x15, 0x02, 0x7b, 0x13, 0x0f, 0x58, 0x00, 0x09, 0xa0, 0x07, 0x89, 0x02, 0x1c, 0x89, 0x55,
+    0xcc, 0x6e, 0x06, 0x12, 0xdc, 0x0c, 0x0f, 0xa8, 0x27, 0x04, 0x2a, 0x07, 0x3d, 0x00, 0x28, 0x13,
+    0x42, 0x5d, 0x25, 0x0f, 0x00, 0x28, 0x13, 0x0f, 0x58, 0x00, 0x0a, 0x8f, 0x1c, 0x89, 0x55, 0x07,
+    0x12, 0x43, 0x80, 0x43, 0x00, 0x28, 0x17, 0x40, 0xb2, 0x6e, 0x6e, 0xb2, 0x2c, 0x07, 0x0f, 0x00,
+    0x28, 0x33, 0x80, 0x07, 0x12, 0x43, 0x1c, 0xf6, 0x43, 0x02, 0x6e, 0x08, 0x19, 0x21, 0x1c, 0x1c,
+    0xe5, 0x23, 0x60, 0x16, 0x1a, 0x16, 0x1a, 0x16, 0x75, 0xc2, 0x16, 0x01, 0x0c, 0x00, 0x00, 0x03,
+    0x00, 0x03, 0x01, 0x00, 0xa2, 0x75, 0x75, 0x07, 0x1c, 0x75, 0x75, 0x1c, 0x07, 0x16, 0xc8, 0xe1,
+    0x2e, 0x01, 0xe6, 0x0b, 0x00, 0xd4, 0x16, 0x00, 0xd2, 0x17, 0x02, 0x09, 0x00, 0x80, 0x1c, 0x07,
+    0x6c, 0x1c, 0x07, 0x1c, 0x07, 0x3d, 0x05, 0x00, 0x10, 0x75, 0x05, 0x17, 0x10, 0xc8, 0xe7, 0x16,
+    0x0f, 0x58, 0x00, 0x07, 0xb0, 0x1c, 0xf6, 0x43, 0x07, 0x51, 0x43, 0x80, 0x6e, 0x1c, 0x89, 0x43,
+    0x20, 0x3a, 0x11, 0x01, 0x95, 0x0b, 0x01, 0xc6, 0x17, 0x03, 0x09, 0x00, 0x03, 0x0a, 0x00, 0xa6,
+    0x3c, 0x41, 0x01, 0x3c, 0x80, 0x41, 0x41, 0x41, 0x01, 0x01, 0x1d, 0x00, 0x0a, 0x08, 0x00, 0x04,
+    0x29, 0x0c, 0x00, 0x06, 0x18, 0x03, 0x47, 0x00, 0x01, 0x52, 0x00, 0x00, 0xef, 0x0b, 0x0f, 0x58,
+    0x00, 0x07, 0x80, 0x07, 0x51, 0x43, 0x3d, 0x08, 0x6e, 0xcc, 0x6e, 0x88, 0x33, 0x10, 0x07, 0xc5,
+    0x0c, 0x10, 0x1c, 0xa2, 0x0c, 0x40, 0x47, 0x07, 0x75, 0x75, 0xcc, 0x00, 0x40, 0x3d, 0x07, 0x1c,
+    0x75, 0xa8, 0x0c, 0x00, 0xef, 0x00, 0x40, 0x4a, 0x07, 0x16, 0x75, 0xcc, 0x3b, 0x10, 0x3d, 0x1c,
+    0x00, 0x00, 0xc8, 0x17, 0x11, 0xc8, 0xf4, 0x23, 0x10, 0x1c, 0x2a, 0x00, 0x00, 0x01, 0x00, 0x11,
+    0x75, 0xf4, 0x24, 0x21, 0x1a, 0x16, 0xea, 0x24, 0x01, 0xae, 0x1f, 0x00, 0x04, 0x01, 0x02, 0x26,
+    0x01, 0x0f, 0x58, 0x00, 0x07, 0xb0, 0x3d, 0x08, 0x6e, 0x3e, 0x6e, 0xcc, 0x83, 0x55, 0x06, 0x07,
+    0x83, 0x9c, 0x13, 0x00, 0x44, 0x10, 0x01, 0x27, 0x1b, 0x00, 0x56, 0x04, 0x10, 0x6e, 0x4e, 0x02,
+    0x01, 0x6f, 0x14, 0x02, 0x00, 0x1b, 0x22, 0x43, 0xf6, 0x42, 0x13, 0x70, 0x51, 0x17, 0x08, 0x6e,
+    0x89, 0x80, 0x43, 0xe9, 0x34, 0x10, 0x89, 0xdc, 0x2b, 0x01, 0x52, 0x05, 0x80, 0x2a, 0x83, 0x2a,
+    0x89, 0xf6, 0x07, 0x1c, 0x15, 0xf4, 0x39, 0x00, 0x72, 0x12, 0x41, 0x83, 0x80, 0x2a, 0xb2, 0x86,
+    0x28, 0x1f, 0x89, 0x58, 0x00, 0x0a, 0x50, 0x3e, 0x6e, 0xcc, 0x3d, 0x6e, 0x80, 0x12, 0x20, 0x2a,
+    0x83, 0xc8, 0x03, 0x52, 0x80, 0x43, 0x6e, 0x89, 0xf6, 0xdf, 0x36, 0x30, 0x6e, 0x12, 0xf6, 0xe1,
+    0x23, 0x42, 0x83, 0x6e, 0x51, 0x07, 0xdb, 0x21, 0x20, 0x6e, 0x43, 0x62, 0x1a, 0x00, 0x55, 0x0e,
+    0x20, 0xf6, 0x12, 0x55, 0x0e, 0x20, 0x6e, 0x3d, 0x4d, 0x35, 0x01, 0xf8, 0x29, 0x21, 0x6e, 0xf8,
+    0x4f, 0x08, 0x50, 0x51, 0x6e, 0xf2, 0x51, 0xeb, 0x59, 0x05, 0x00, 0x00, 0x1b, 0x01, 0x8e, 0x0a,
+    0x04, 0x97, 0x0a, 0x0f, 0x58, 0x00, 0x06, 0x50, 0x3d, 0x6e, 0x43, 0x1c, 0x12, 0xab, 0x14, 0x00,
+    0x99, 0x14, 0x00, 0x64, 0x21, 0x60, 0x2a, 0x43, 0x2a, 0xf6, 0x65, 0x89, 0x29, 0x24, 0x00, 0x3a,
+    0x05, 0x20, 0x12, 0x08, 0x78, 0x11, 0x00, 0xbd, 0x00, 0x00, 0x6e, 0x03, 0x00, 0xcb, 0x38, 0x20,
+    0x83, 0x43, 0xe9, 0x1b, 0x00, 0x4b, 0x00, 0x10, 0x2a, 0x80, 0x00, 0x00, 0x56, 0x0c, 0x00, 0x7b,
+    0x05, 0x01, 0x09, 0x03, 0x00, 0xef, 0x00, 0x50, 0x08, 0x2a, 0x89, 0xf6, 0x17, 0x15, 0x07, 0x01,
+    0xf2, 0x07, 0x00, 0x8a, 0x29, 0x0f, 0x58, 0x00, 0x0a, 0xb0, 0x1c, 0x12, 0x43, 0x1c, 0x89, 0x6e,
+    0x83, 0x6e, 0x4a, 0x6e, 0x43, 0x36, 0x07, 0x01, 0xb7, 0x29, 0x31, 0x83, 0x3d, 0x15, 0x2b, 0x0c,
+    0x61, 0x2a, 0x07, 0x07, 0x6e, 0x08, 0x51, 0x2b, 0x0c, 0x21, 0x2a, 0x43, 0xe1, 0x03, 0x01, 0x84,
+    0x15, 0x31, 0x83, 0x43, 0x2a, 0x7e, 0x29, 0x20, 0x2a, 0x3d, 0x52, 0x21, 0x21, 0x51, 0x83, 0xf3,
+    0x09, 0x10, 0xb2, 0xfc, 0x17, 0x00, 0x86, 0x0a, 0x60, 0x08, 0x2a, 0x2a, 0x07, 0x12, 0x3d, 0x6f,
+    0x18, 0x12, 0x30, 0xa2, 0x23, 0x1f, 0x6e, 0x58, 0x00, 0x0a, 0x92, 0x1c, 0x89, 0x6e, 0x75, 0x12,
+    0x6e, 0x51, 0x6e, 0x1c, 0x27, 0x2a, 0x03, 0x38, 0x01, 0x00, 0xd5, 0x0b, 0x00, 0xb8, 0x24, 0x00,
+    0xa4, 0x0b, 0x00, 0xe9, 0x03, 0xa0, 0x08, 0x89, 0x2a, 0x43, 0x12, 0x83, 0x6e, 0x6e, 0x3d, 0x2a,
+    0x88, 0x04, 0x30, 0x2a, 0x83, 0x89, 0x3b, 0x18, 0x20, 0x83, 0x3d, 0x0b, 0x00, 0x10, 0x51, 0xec,
+    0x15, 0x01, 0x8d, 0x17, 0x00, 0x69, 0x05, 0x01, 0x1e, 0x28, 0x00, 0xed, 0x06, 0x00, 0xf9, 0x3a,
+    0x00, 0x98, 0x07, 0x02, 0xa5, 0x04, 0x0f, 0x58, 0x00, 0x07, 0x90, 0x75, 0x12, 0x6e, 0x75, 0xf6,
+    0x6e, 0x2a, 0xcc, 0x3d, 0xba, 0x34, 0x00, 0x23, 0x3b, 0x00, 0xa8, 0x18, 0x01, 0x54, 0x24, 0x00,
+    0x1e, 0x08, 0x30, 0x2a, 0x83, 0x08, 0x7c, 0x0c, 0x02, 0xd1, 0x05, 0x00, 0x27, 0x01, 0x20, 0x3d,
+    0x42, 0x43, 0x0c, 0x00, 0x2f, 0x0a, 0x00, 0x13, 0x00, 0x01, 0x12, 0x11, 0x21, 0x43, 0xeb, 0xe2,
+    0x0b, 0x62, 0x07, 0xeb, 0x6e, 0x6e, 0x3d, 0x65, 0x24, 0x0c, 0x12, 0xb2, 0x84, 0x1d, 0x00, 0x07,
+    0x02, 0x12, 0xcc, 0x80, 0x10, 0x0f, 0x58, 0x00, 0x06, 0x47, 0x75, 0xf6, 0x6e, 0x33, 0x01, 0x00,
+    0x58, 0x30, 0x8a, 0x8a, 0x58, 0xe8, 0x11, 0x00, 0x08, 0x01, 0x00, 0x74, 0xf2, 0x33, 0x33, 0xf2,
+    0x8a, 0x58, 0x8a, 0x20, 0x00, 0x60, 0xf2, 0xf2, 0x33, 0xf2, 0x30, 0xf2, 0x16, 0x00, 0x0f, 0x40,
+    0x00, 0x32, 0x10, 0xe8, 0x01, 0x00, 0x30, 0x30, 0x8a, 0x8a, 0x20, 0x00, 0x00, 0x0b, 0x00, 0x01,
+    0x06, 0x00, 0x0d, 0x43, 0x00, 0x04, 0x40, 0x00, 0x00, 0x3d, 0x00, 0x3f, 0x33, 0xf2, 0x30, 0x40,
+    0x00, 0x31, 0x01, 0x39, 0x00, 0x12, 0x33, 0x02, 0x00, 0x10, 0x30, 0x20, 0x00, 0x31, 0x30, 0x33,
+    0xe8, 0x55, 0x00, 0x22, 0xf2, 0x33, 0x41, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x03, 0x00, 0x01, 0x40,
+    0x00, 0x23, 0x33, 0xf2, 0x01, 0x00, 0x00, 0x45, 0x00, 0x2f, 0x33, 0xf2, 0x40, 0x00, 0x2e, 0x03,
+    0x26, 0x00, 0x01, 0xaf, 0x00, 0x01, 0x40, 0x00, 0x02, 0xcb, 0x00, 0x0f, 0x47, 0x01, 0x02, 0x07,
+    0x40, 0x01, 0x00, 0xbf, 0x00, 0x00, 0x3f, 0x00, 0x0f, 0x40, 0x00, 0x01, 0x5f, 0x30, 0xf8, 0x30,
+    0xe8, 0x30, 0x40, 0x00, 0x16, 0x09, 0xc0, 0x01, 0x06, 0xa0, 0x01, 0x00, 0x52, 0x00, 0x0c, 0x3f,
+    0x00, 0x02, 0x40, 0x00, 0x02, 0xb8, 0x00, 0x01, 0x42, 0x01, 0x09, 0x3e, 0x00, 0x04, 0x40, 0x00,
+    0x22, 0x30, 0x30, 0x7d, 0x00, 0x03, 0x07, 0x00, 0x0f, 0x40, 0x00, 0x0d, 0x00, 0x3e, 0x01, 0x03,
+    0x42, 0x01, 0x03, 0xc0, 0x00, 0x02, 0x31, 0x01, 0x03, 0x08, 0x01, 0x04, 0xcb, 0x01, 0x15, 0xe8,
+    0x40, 0x00, 0x03, 0x4c, 0x01, 0x01, 0x3d, 0x01, 0x00, 0x2b, 0x00, 0x0d, 0x40, 0x00, 0x31, 0x30,
+    0x30, 0x30, 0x26, 0x00, 0x1f, 0x30, 0x40, 0x00, 0x14, 0x03, 0x27, 0x00, 0x00, 0x40, 0x02, 0x28,
+    0x58, 0x8a, 0x3c, 0x02, 0x03, 0x3e, 0x00, 0x04, 0x0d, 0x01, 0x22, 0xf2, 0x33, 0x40, 0x00, 0x03,
+    0xdf, 0x01, 0x00, 0xc0, 0x00, 0x17, 0x30, 0xa7, 0x00, 0x03, 0x40, 0x00, 0x01, 0xfa, 0x00, 0x10,
+    0xe8, 0x85, 0x00, 0x0f, 0x40, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x00, 0x89, 0x02, 0x33, 0xf2, 0xf2,
+    0xf2, 0x80, 0x00, 0x06, 0xf9, 0x00, 0x07, 0x06, 0x01, 0x25, 0xe8, 0xe8, 0x40, 0x00, 0x03, 0x4e,
+    0x01, 0x02, 0x35, 0x00, 0x0d, 0x40, 0x00, 0x07, 0xf8, 0x00, 0x0f, 0x40, 0x00, 0x11, 0x08, 0x01,
+    0x00, 0x00, 0x40, 0x00, 0x20, 0x33, 0x30, 0xc1, 0x01, 0x21, 0x30, 0x30, 0x9f, 0x00, 0x03, 0xe1,
+    0x01, 0x09, 0x20, 0x00, 0x0b, 0x34, 0x00, 0x0d, 0x40, 0x00, 0x04, 0x38, 0x01, 0x3f, 0xe8, 0xe8,
+    0x30, 0x40, 0x00, 0x11, 0x01, 0x6d, 0x00, 0x04, 0x01, 0x00, 0x00, 0x20, 0x00, 0x14, 0x8a, 0x97,
+    0x00, 0x02, 0xa6, 0x03, 0x05, 0xe4, 0x00, 0x00, 0x2e, 0x01, 0x39, 0x8a, 0x58, 0x8a, 0x30, 0x00,
+    0x0c, 0x01, 0x00, 0x03, 0x80, 0x00, 0x02, 0x70, 0x03, 0x2f, 0xe8, 0xe8, 0x40, 0x00, 0x11, 0x19,
+    0x8a, 0x01, 0x00, 0x02, 0x20, 0x01, 0x04, 0x1b, 0x03, 0x00, 0xc1, 0x00, 0x01, 0x87, 0x00, 0x10,
+    0xe8, 0x2d, 0x04, 0x02, 0x40, 0x03, 0x0f, 0x01, 0x00, 0x0b, 0x00, 0xc0, 0x01, 0x04, 0x78, 0x01,
+    0x11, 0x04, 0x01, 0x01, 0x0f, 0x40, 0x00, 0x0d, 0x1a, 0x58, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0x84, 0x01, 0x01, 0x86, 0x01, 0x00, 0x82, 0x00, 0x01, 0x08, 0x00, 0x00, 0x40, 0x00, 0x10, 0x30,
+    0x60, 0x02, 0x0f, 0x01, 0x00, 0x0d, 0x23, 0x8a, 0x3e, 0xf2, 0x01, 0x8f, 0x04, 0x04, 0x04, 0x04,
+    0x30, 0x33, 0x30, 0xe8, 0x40, 0x00, 0x0d, 0x09, 0x8d, 0x00, 0x10, 0xe7, 0x00, 0x02, 0x00, 0x3d,
+    0x04, 0x0e, 0xfd, 0x01, 0x31, 0xe8, 0x30, 0xe8, 0x60, 0x01, 0x0f, 0x01, 0x00, 0x0a, 0x40, 0xe7,
+    0x58, 0x8a, 0x6c, 0xa1, 0x45, 0x71, 0xe8, 0xe8, 0x05, 0x05, 0x04, 0xe8, 0x04, 0x85, 0x02, 0x0f,
+    0x40, 0x00, 0x0c, 0x0c, 0xc0, 0x01, 0x01, 0xb8, 0x01, 0x0f, 0xfd, 0x01, 0x00, 0x00, 0x56, 0x03,
+    0x00, 0x20, 0x00, 0x0a, 0x31, 0x02, 0x0e, 0x00, 0x02, 0x10, 0x47, 0x80, 0x00, 0x01, 0x05, 0x00,
+    0x10, 0x04, 0x04, 0x01, 0x22, 0xe8, 0x04, 0xed, 0x03, 0x0f, 0x40, 0x00, 0x06, 0x05, 0x9c, 0x04,
+    0x00, 0x01, 0x00, 0x07, 0x20, 0x04, 0x0c, 0x01, 0x00, 0x04, 0xc0, 0x05, 0x03, 0x9e, 0x00, 0x11,
+    0x30, 0x52, 0x01, 0x00, 0x29, 0x01, 0x0b, 0x40, 0x00, 0x33, 0x47, 0x6c, 0x6c, 0x03, 0x00, 0x00,
+    0x77, 0x46, 0x00, 0x7a, 0x46, 0x02, 0x8b, 0x03, 0x0f, 0x40, 0x00, 0x0e, 0x04, 0x40, 0x05, 0x22,
+    0x30, 0x30, 0x37, 0x02, 0x09, 0x39, 0x05, 0x11, 0xf2, 0xd2, 0x05, 0x04, 0x40, 0x06, 0x03, 0xbf,
+    0x04, 0x08, 0x7f, 0x07, 0x05, 0x40, 0x00, 0xa2, 0x47, 0x0b, 0x6c, 0x47, 0x3e, 0x47, 0x47, 0x47,
+    0x3e, 0x3e, 0x2a, 0x47, 0x3f, 0x04, 0x04, 0x04, 0x40, 0x00, 0x10, 0x02, 0x0b, 0x05, 0x02, 0x00,
+    0x04, 0x00, 0x82, 0x00, 0x02, 0x18, 0x01, 0x07, 0x8c, 0x04, 0x02, 0x42, 0x04, 0x02, 0x40, 0x00,
+    0x01, 0x4c, 0x05, 0x03, 0x40, 0x00, 0x04, 0x4f, 0x06, 0x05, 0x40, 0x00, 0xa0, 0x47, 0x0b, 0x6c,
+    0x3e, 0x6c, 0x6c, 0x6c, 0x3e, 0x3e, 0x47, 0x81, 0x00, 0x01, 0x82, 0x01, 0x00, 0x01, 0x00, 0x0f,
+    0x40, 0x00, 0x06, 0x02, 0xec, 0x00, 0x02, 0x6d, 0x03, 0x01, 0x00, 0x01, 0x02, 0x52, 0x07, 0x0f,
+    0x01, 0x00, 0x02, 0x01, 0x40, 0x00, 0x20, 0x30, 0x30, 0x04, 0x00, 0x03, 0xa0, 0x02, 0x04, 0xa8,
+    0x02, 0x06, 0x40, 0x00, 0x90, 0x47, 0x0b, 0x47, 0x47, 0x47, 0x05, 0x05, 0x3e, 0x3e, 0x01, 0x01,
+    0x10, 0x04, 0x86, 0x03, 0x00, 0x7c, 0x00, 0x07, 0x80, 0x00, 0x0b, 0x40, 0x00, 0x15, 0x30, 0x6b,
+    0x01, 0x03, 0x40, 0x04, 0x03, 0x17, 0x02, 0x30, 0x30, 0x8a, 0x8a, 0x84, 0x03, 0x02, 0x1a, 0x00,
+    0x03, 0x15, 0x00, 0x00, 0xe0, 0x03, 0x03, 0x1e, 0x05, 0x00, 0xa5, 0x01, 0x02, 0xc6, 0x01, 0x0b,
+    0x40, 0x00, 0x11, 0x6c, 0xfd, 0x01, 0x90, 0x05, 0x05, 0x05, 0x3e, 0x05, 0x05, 0x33, 0x04, 0x04,
+    0x03, 0x00, 0x0f, 0x40, 0x00, 0x0a, 0x05, 0x3f, 0x00, 0x06, 0x20, 0x05, 0x04, 0x72, 0x00, 0x00,
+    0x7f, 0x00, 0x11, 0x30, 0x58, 0x00, 0x11, 0x30, 0x2f, 0x01, 0x07, 0x40, 0x00, 0x02, 0x59, 0x04,
+    0x02, 0xc7, 0x00, 0x0a, 0x40, 0x00, 0x50, 0x47, 0x47, 0x47, 0x47, 0x6c, 0x00, 0x02, 0x03, 0xfd,
+    0x01, 0x09, 0x01, 0x00, 0x0f, 0x40, 0x00, 0x08, 0x06, 0xa0, 0x05, 0x00, 0xca, 0x01, 0x01, 0x9a,
+    0x06, 0x0c, 0x03, 0x05, 0x03, 0x20, 0x00, 0x02, 0xcc, 0x00, 0x02, 0x40, 0x00, 0x06, 0xaa, 0x02,
+    0x04, 0x40, 0x00, 0x71, 0x6c, 0x47, 0x05, 0x33, 0x05, 0x05, 0x04, 0xfc, 0x01, 0x0f, 0x40, 0x00,
+    0x11, 0x00, 0x6a, 0x01, 0x01, 0x6f, 0x02, 0x04, 0xc0, 0x05, 0x03, 0xa0, 0x01, 0x0f, 0x03, 0x05,
+    0x00, 0x05, 0x40, 0x06, 0x01, 0x0c, 0x00, 0x02, 0x38, 0x00, 0x0d, 0x40, 0x00, 0x01, 0xfb, 0x03,
+    0x06, 0x01, 0x00, 0x04, 0x7b, 0x02, 0x02, 0x01, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x70, 0x01, 0x01, 0xb8, 0x08, 0x0f, 0x00, 0x07, 0x13, 0x01, 0xcc, 0x00, 0x03, 0x38, 0x00,
+    0x0d, 0x40, 0x00, 0x0e, 0x76, 0x01, 0x01, 0xf2, 0x03, 0x0f, 0x40, 0x00, 0x07, 0x04, 0x06, 0x02,
+    0x10, 0x30, 0xe1, 0x01, 0x0f, 0x00, 0x07, 0x0f, 0x01, 0xbb, 0x00, 0x03, 0xbf, 0x01, 0x08, 0x08,
+    0x00, 0x04, 0x40, 0x00, 0x20, 0x04, 0x8a, 0xc1, 0x01, 0x01, 0x02, 0x06, 0x27, 0x33, 0x04, 0x40,
+    0x00, 0x04, 0xa0, 0x09, 0x0c, 0x40, 0x00, 0x0f, 0x00, 0x0a, 0x01, 0x00, 0xce, 0x00, 0x09, 0x18,
+    0x00, 0x03, 0xce, 0x09, 0x01, 0x40, 0x04, 0x0b, 0xd4, 0x09, 0x0d, 0x40, 0x00, 0x02, 0x0e, 0x01,
+    0x01, 0x01, 0x08, 0x0f, 0x40, 0x00, 0x18, 0x03, 0xc0, 0x0b, 0x03, 0x00, 0x06, 0x02, 0x3f, 0x00,
+    0x01, 0x8b, 0x00, 0x01, 0xce, 0x09, 0x02, 0x33, 0x02, 0x01, 0x20, 0x00, 0x01, 0xdf, 0x09, 0x07,
+    0xb8, 0x05, 0x0e, 0x40, 0x00, 0x04, 0x00, 0x08, 0x2f, 0x30, 0x04, 0x40, 0x00, 0x11, 0x01, 0x6f,
+    0x04, 0x01, 0x62, 0x02, 0x04, 0x00, 0x09, 0x00, 0x2b, 0x05, 0x00, 0xc0, 0x09, 0x11, 0x05, 0x53,
+    0x00, 0x04, 0x40, 0x00, 0x04, 0xc0, 0x06, 0x05, 0x0d, 0x02, 0x02, 0x38, 0x00, 0x0f, 0x40, 0x00,
+    0x0a, 0x08, 0x7b, 0x02, 0x25, 0xe8, 0x05, 0x00, 0x05, 0x09, 0x40, 0x00, 0x07, 0xc0, 0x0b, 0x05,
+    0x00, 0x01, 0x01, 0x41, 0x00, 0x03, 0x01, 0x00, 0x02, 0xba, 0x00, 0x09, 0xa0, 0x04, 0x02, 0xbf,
+    0x01, 0x02, 0x38, 0x00, 0x0f, 0x40, 0x00, 0x0b, 0x02, 0x81, 0x06, 0x01, 0x07, 0x03, 0x01, 0x98,
+    0x02, 0x0f, 0x40, 0x00, 0x01, 0x0f, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x07, 0x0a, 0x01, 0xcf, 0x01,
+    0x0d, 0xdc, 0x0b, 0x0d, 0x40, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x77, 0x00, 0x10, 0x05, 0x90, 0x04,
+    0x03, 0x01, 0x00, 0x03, 0x80, 0x0a, 0x09, 0x40, 0x00, 0x03, 0x86, 0x0a, 0x01, 0x8b, 0x01, 0x0f,
+    0x00, 0x07, 0x12, 0x03, 0x60, 0x00, 0x04, 0xbe, 0x0a, 0x0d, 0x40, 0x00, 0x09, 0xff, 0x03, 0x00,
+    0x07, 0x06, 0x20, 0x3e, 0x3e, 0x10, 0x07, 0x00, 0x01, 0x00, 0x01, 0x80, 0x01, 0x0b, 0x40, 0x00,
+    0x13, 0x33, 0x9e, 0x03, 0x23, 0xe8, 0xf2, 0xe0, 0x01, 0x0f, 0x00, 0x07, 0x0c, 0x04, 0xc0, 0x0b,
+    0x03, 0x38, 0x00, 0x04, 0x08, 0x00, 0x0b, 0x40, 0x00, 0x02, 0x3e, 0x00, 0x01, 0x05, 0x01, 0x02,
+    0x01, 0x00, 0x01, 0x96, 0x05, 0x00, 0x80, 0x01, 0x0c, 0x40, 0x00, 0x07, 0x5f, 0x00, 0x0f, 0x00,
+    0x07, 0x12, 0x0a, 0x9c, 0x01, 0x09, 0x1f, 0x00, 0x0f, 0x40, 0x00, 0x05, 0x00, 0x11, 0x09, 0x00,
+    0x7f, 0x01, 0x10, 0x47, 0x00, 0x05, 0x0c, 0x40, 0x00, 0x03, 0x2f, 0x00, 0x00, 0xc1, 0x00, 0x03,
+    0xc0, 0x00, 0x04, 0xd4, 0x07, 0x04, 0x23, 0x00, 0x06, 0x10, 0x00, 0x04, 0x20, 0x00, 0x02, 0xef,
+    0x00, 0x5e, 0xf2, 0x30, 0x30, 0xe8, 0x05, 0x40, 0x00, 0x0a, 0x7b, 0x01, 0x01, 0x8f, 0x06, 0x12,
+    0xe9, 0x01, 0x00, 0x11, 0x6c, 0x80, 0x05, 0x0b, 0x40, 0x00, 0x06, 0xed, 0x0c, 0x06, 0x80, 0x00,
+    0x06, 0x1e, 0x0c, 0x31, 0xe8, 0x30, 0x30, 0x5b, 0x00, 0x08, 0xa0, 0x0c, 0x02, 0x21, 0x00, 0x01,
+    0x11, 0x03, 0x07, 0xec, 0x00, 0x05, 0x40, 0x00, 0x01, 0x79, 0x02, 0x00, 0x7e, 0x00, 0x01, 0x7b,
+    0x00, 0x01, 0x01, 0x00, 0x22, 0x47, 0xe9, 0x83, 0x00, 0x0f, 0x40, 0x00, 0x01, 0x06, 0x89, 0x04,
+    0x04, 0x60, 0x05, 0x05, 0xd3, 0x08, 0x20, 0xf2, 0xf2, 0xb8, 0x0b, 0x23, 0xe8, 0x33, 0x34, 0x10,
+    0x12, 0x33, 0x20, 0x00, 0x15, 0x8a, 0x40, 0x00, 0x09, 0x40, 0x03, 0x0a, 0x40, 0x00, 0x40, 0x04,
+    0x33, 0x33, 0x04, 0x06, 0x07, 0x01, 0xf7, 0x01, 0x01, 0x84, 0x00, 0x00, 0x0d, 0x01, 0x01, 0x80,
+    0x03, 0x0b, 0x40, 0x00, 0x06, 0xeb, 0x00, 0x13, 0xf2, 0xa0, 0x04, 0x00, 0x1b, 0x04, 0x05, 0x13,
+    0x00, 0x04, 0x0d, 0x00, 0x01, 0x06, 0x00, 0x0e, 0x20, 0x01, 0x07, 0xc3, 0x0d, 0x09, 0x40, 0x00,
+    0x41, 0x04, 0x04, 0x04, 0xf2, 0x86, 0x01, 0x02, 0x03, 0x01, 0x03, 0x81, 0x01, 0x07, 0x80, 0x01,
+    0x0c, 0x40, 0x00, 0x00, 0x09, 0x02, 0x04, 0x60, 0x06, 0x0f, 0x80, 0x02, 0x06, 0x03, 0x20, 0x07,
+    0x0b, 0xb9, 0x00, 0x0f, 0x40, 0x00, 0x01, 0x01, 0x84, 0x01, 0x00, 0x8b, 0x07, 0x21, 0x3e, 0x47,
+    0x7e, 0x00, 0x62, 0x0b, 0xe9, 0x6c, 0x6c, 0x3e, 0x05, 0x80, 0x04, 0x0a, 0x40, 0x00, 0x08, 0x60,
+    0x04, 0x05, 0xc0, 0x0d, 0x0b, 0xa4, 0x02, 0x04, 0xab, 0x02, 0x0f, 0x20, 0x00, 0x03, 0x0f, 0x40,
+    0x00, 0x01, 0x01, 0x7b, 0x04, 0x40, 0x47, 0x47, 0x05, 0x3e, 0x80, 0x00, 0x50, 0x0b, 0xe9, 0xe9,
+    0x0b, 0x0b, 0x07, 0x01, 0x0f, 0x40, 0x00, 0x09, 0x05, 0xe0, 0x02, 0x03, 0x9d, 0x00, 0x0d, 0xdd,
+    0x10, 0x31, 0x33, 0x33, 0x33, 0x80, 0x09, 0x0f, 0x40, 0x00, 0x12, 0x00, 0x00, 0x01, 0x01, 0x81,
+    0x0b, 0x30, 0x3e, 0x47, 0x47, 0x80, 0x00, 0x61, 0xe9, 0x0b, 0x0b, 0xe9, 0xe9, 0x6c, 0x00, 0x01,
+    0x0d, 0xde, 0x00, 0x06, 0xee, 0x0f, 0x02, 0x40, 0x00, 0x02, 0xf1, 0x02, 0x05, 0x59, 0x04, 0x0c,
+    0x60, 0x0f, 0x0f, 0x1d, 0x04, 0x06, 0x0a, 0x40, 0x00, 0x00, 0xf6, 0x05, 0xc0, 0x05, 0x05, 0x05,
+    0x6c, 0xe9, 0x6c, 0x6c, 0xe9, 0x0b, 0x0b, 0x0b, 0x0e, 0x00, 0x02, 0x01, 0x80, 0x00, 0x0f, 0x38,
+    0x00, 0x00, 0x04, 0xdf, 0x00, 0x04, 0x00, 0x0a, 0x0f, 0x5d, 0x04, 0x01, 0x05, 0x00, 0x02, 0x0a,
+    0x38, 0x00, 0x08, 0x2d, 0x04, 0x02, 0x40, 0x00, 0x03, 0x1f, 0x00, 0x00, 0x84, 0x03, 0x00, 0x7c,
+    0x02, 0x94, 0x0b, 0x6c, 0xe9, 0x0b, 0x56, 0x0b, 0x0b, 0x0b, 0xe9, 0x00, 0x02, 0x0b, 0x40, 0x00,
+    0x07, 0x66, 0x01, 0x05, 0x80, 0x0a, 0x0f, 0x00, 0x02, 0x02, 0x03, 0x60, 0x11, 0x04, 0x40, 0x00,
+    0x07, 0x45, 0x13, 0x0f, 0x40, 0x00, 0x03, 0x11, 0x04, 0x7c, 0x01, 0x90, 0x3e, 0xe9, 0x47, 0xe9,
+    0x0b, 0x0e, 0x0b, 0x0e, 0x0e, 0x02, 0x02, 0x1f, 0x05, 0x40, 0x00, 0x00, 0x2c, 0x8a, 0x05, 0x40,
+    0x00, 0x01, 0x9f, 0x04, 0x0b, 0x01, 0x00, 0x02, 0xe3, 0x02, 0x07, 0x40, 0x02, 0x13, 0xe8, 0x38,
+    0x00, 0x04, 0x08, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x40, 0x04, 0x3e, 0x3e, 0x05, 0x8b, 0x0d, 0xa1,
+    0x6c, 0x0b, 0x0b, 0x0e, 0x0e, 0x0e, 0x0e, 0x0b, 0x6c, 0x47, 0x80, 0x00, 0x0b, 0x40, 0x00, 0x05,
+    0x8e, 0x03, 0x00, 0xeb, 0x07, 0x05, 0xc0, 0x03, 0x0c, 0x04, 0x01, 0x00, 0x60, 0x03, 0x07, 0x80,
+    0x02, 0x00, 0xee, 0x04, 0x03, 0x40, 0x06, 0x0f, 0x40, 0x00, 0x03, 0x02, 0x7c, 0x06, 0x80, 0x05,
+    0x05, 0x04, 0x3e, 0x3e, 0x6c, 0xe9, 0xe9, 0x80, 0x00, 0x22, 0x0b, 0xe9, 0x00, 0x06, 0x0c, 0x40,
+    0x00, 0x08, 0x04, 0x02, 0x0f, 0x00, 0x0b, 0x12, 0x08, 0x1d, 0x02, 0x07, 0x08, 0x00, 0x0c, 0x40,
+    0x00, 0x00, 0x7f, 0x0a, 0x30, 0x05, 0x04, 0x04, 0x00, 0x01, 0x00, 0x81, 0x01, 0x00, 0x7f, 0x01,
+    0x06, 0x80, 0x00, 0x07, 0x38, 0x00, 0x00, 0xb8, 0x00, 0x04, 0x12, 0x02, 0x0f, 0x00, 0x0b, 0x12,
+    0x04, 0x8c, 0x08, 0x20, 0xe8, 0xe8, 0xa2, 0x09, 0x01, 0xf8, 0x00, 0x0f, 0x40, 0x00, 0x02, 0x00,
+    0x18, 0x00, 0x00, 0x05, 0x04, 0x11, 0x05, 0x00, 0x03, 0x00, 0x81, 0x04, 0x01, 0x80, 0x07, 0x0c,
+    0x40, 0x00, 0x09, 0x41, 0x06, 0x02, 0x40, 0x07, 0x0a, 0x76, 0x05, 0x0d, 0xc0, 0x0a, 0x02, 0x90,
+    0x00, 0x04, 0x19, 0x02, 0x0f, 0x40, 0x00, 0x04, 0x31, 0x04, 0x04, 0xf2, 0xfe, 0x09, 0x00, 0x80,
+    0x05, 0x01, 0xfd, 0x03, 0x33, 0xe9, 0x6c, 0x47, 0x00, 0x01, 0x0f, 0x40, 0x00, 0x01, 0x02, 0x93,
+    0x00, 0x0b, 0x00, 0x14, 0x03, 0x75, 0x03, 0x0c, 0xc0, 0x0a, 0x05, 0x3e, 0x0a, 0x01, 0xd4, 0x13,
+    0x0c, 0x40, 0x00, 0x00, 0x70, 0x0f, 0x02, 0x80, 0x0d, 0x23, 0x47, 0xe8, 0x02, 0x07, 0x00, 0x03,
+    0x02, 0x00, 0xff, 0x00, 0x03, 0x80, 0x03, 0x0c, 0x40, 0x00, 0x07, 0x6c, 0x0a, 0x09, 0xa0, 0x01,
+    0x04, 0x75, 0x03, 0x0a, 0x00, 0x0b, 0x06, 0xb2, 0x07, 0x05, 0xf9, 0x00, 0x09, 0x40, 0x00, 0x01,
+    0x37, 0x00, 0x02, 0xf4, 0x08, 0x11, 0x33, 0xfd, 0x09, 0x01, 0x84, 0x00, 0x06, 0x80, 0x00, 0x0e,
+    0x40, 0x00, 0x05, 0xa5, 0x08, 0x3c, 0x05, 0x30, 0x30, 0xa0, 0x08, 0x02, 0xf7, 0x0a, 0x08, 0x00,
+    0x0b, 0x06, 0x51, 0x15, 0x0f, 0x40, 0x00, 0x03, 0x03, 0xf8, 0x04, 0x02, 0x82, 0x00, 0x00, 0x83,
+    0x06, 0x04, 0x07, 0x08, 0x00, 0x90, 0x11, 0x0f, 0x40, 0x00, 0x08, 0x00, 0x42, 0x00, 0x01, 0x80,
+    0x00, 0x0c, 0x75, 0x05, 0x07, 0x60, 0x06, 0x00, 0x00, 0x02, 0x01, 0xd6, 0x05, 0x04, 0x01, 0x00,
+    0x0f, 0x40, 0x00, 0x00, 0x06, 0xef, 0x0d, 0x00, 0x64, 0x00, 0x31, 0x05, 0x33, 0x3e, 0x80, 0x0b,
+    0x01, 0x0e, 0x11, 0x01, 0x80, 0x0b, 0x0f, 0x40, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x02, 0x80, 0x00,
+    0x0f, 0x00, 0x0b, 0x0c, 0x1b, 0x3e, 0x76, 0x00, 0x0f, 0x40, 0x00, 0x08, 0x01, 0x87, 0x16, 0x33,
+    0x33, 0x33, 0xe8, 0x8b, 0x06, 0x2f, 0x05, 0x04, 0x40, 0x00, 0x08, 0x06, 0x00, 0x02, 0x0f, 0x00,
+    0x0b, 0x0c, 0x05, 0xc0, 0x00, 0x01, 0x73, 0x01, 0x0f, 0x40, 0x00, 0x01, 0x04, 0x60, 0x0d, 0x10,
+    0x74, 0x7f, 0x00, 0x02, 0xf9, 0x0c, 0x02, 0x0d, 0x0a, 0x1f, 0x05, 0x40, 0x00, 0x11, 0x0f, 0x00,
+    0x0b, 0x0d, 0x19, 0x3e, 0x72, 0x02, 0x0f, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x09, 0x8a, 0x0f,
+    0x0f, 0x40, 0x00, 0x11, 0x0f, 0x00, 0x0b, 0x0d, 0x03, 0x3c, 0x18, 0x0f, 0x40, 0x00, 0x07, 0x0b,
+    0xbc, 0x01, 0x0f, 0x40, 0x00, 0x0d, 0x08, 0x6b, 0x07, 0x0f, 0x00, 0x0b, 0x12, 0x0a, 0x5d, 0x00,
+    0x09, 0xab, 0x07, 0x03, 0x40, 0x00, 0x08, 0x97, 0x09, 0x0f, 0x40, 0x00, 0x14, 0x06, 0xa0, 0x00,
+    0x0f, 0x60, 0x17, 0x0a, 0x2f, 0x30, 0x8a, 0x00, 0x09, 0x0e, 0x0f, 0x40, 0x00, 0x24, 0x05, 0xc0,
+    0x00, 0x0f, 0x60, 0x17, 0x0d, 0x0f, 0x40, 0x00, 0x3d, 0x0b, 0xc0, 0x01, 0x0f, 0x60, 0x17, 0x0e,
+    0x0f, 0x80, 0x09, 0x06, 0x0f, 0x40, 0x00, 0x24, 0x08, 0x88, 0x00, 0x0f, 0xc0, 0x00, 0x11, 0x05,
+    0xc0, 0x1b, 0x0b, 0x29, 0x05, 0x0f, 0x40, 0x00, 0x2d, 0x0f, 0xc0, 0x01, 0x12, 0x05, 0xc0, 0x0e,
+    0x07, 0xf7, 0x0c, 0x0f, 0x40, 0x00, 0x2c, 0x05, 0xc0, 0x04, 0x05, 0x40, 0x1b, 0x0f, 0x21, 0x01,
+    0x02, 0x00, 0x21, 0x00, 0x0f, 0x20, 0x07, 0x03, 0x0f, 0x40, 0x00, 0x33, 0x08, 0x00, 0x1c, 0x05,
+    0x01, 0x1c, 0x03, 0x0c, 0x00, 0x09, 0x60, 0x02, 0x0f, 0x40, 0x00, 0x3d, 0x0b, 0xc0, 0x03, 0x04,
+    0xcc, 0x08, 0x04, 0x1b, 0x00, 0x04, 0x5b, 0x00, 0x06, 0x40, 0x00, 0x0f, 0xff, 0x02, 0x07, 0x0f,
+    0x40, 0x00, 0x28, 0x04, 0xc0, 0x01, 0x0f, 0x00, 0x20, 0xff, 0x73, 0x0f, 0xc0, 0x1f, 0x1b, 0x0f,
+    0x40, 0x20, 0x2d, 0x0b, 0xc0, 0x03, 0x0f, 0xc0, 0x1f, 0x1e, 0x0d, 0x40, 0x00, 0x06, 0x94, 0x02,
+    0x0f, 0x40, 0x00, 0x12, 0x0f, 0xc0, 0x1f, 0x2f, 0x0f, 0x40, 0x20, 0x2d, 0x0a, 0xc0, 0x03, 0x0f,
+    0xc0, 0x1f, 0x1d, 0x0e, 0x00, 0x04, 0x0f, 0x40, 0x20, 0x1b, 0x0f, 0xc0, 0x1f, 0x2c, 0x0d, 0x40,
+    0x00, 0x0b, 0x5b, 0x04, 0x0f, 0x40, 0x00, 0x0d, 0x0d, 0x60, 0x10, 0x0f, 0xc0, 0x1f, 0x1c, 0x0d,
+    0x40, 0x00, 0x0f, 0x40, 0x20, 0x1c, 0x0f, 0xc0, 0x1f, 0x2d, 0x0d, 0x40, 0x00, 0x0f, 0x40, 0x20,
+    0x1c, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20,
+    0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0e, 0x60, 0x08,
+    0x0f, 0x40, 0x20, 0x1b, 0x05, 0x9c, 0x04, 0x00, 0x01, 0x00, 0x0f, 0xc0, 0x1f, 0x29, 0x03, 0x40,
+    0x00, 0x0f, 0x40, 0x20, 0x26, 0x0f, 0xc0, 0x1f, 0x2a, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f,
+    0x27, 0x0c, 0x40, 0x00, 0x0f, 0x40, 0x20, 0x1d, 0x02, 0xac, 0x00, 0x0f, 0xc0, 0x1f, 0x27, 0x0c,
+    0x40, 0x00, 0x0f, 0x40, 0x20, 0x1d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0,
+    0x1f, 0x35, 0x0f, 0x40, 0x20, 0x2d, 0x04, 0xa0, 0x05, 0x0f, 0xc0, 0x1f, 0x1d, 0x0f, 0x40, 0x20,
+    0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x2e, 0x0f, 0x40, 0x20,
+    0x2d, 0x0f, 0xc0, 0x1f, 0x2c, 0x0f, 0x40, 0x20, 0x2d, 0x0d, 0xc0, 0x09, 0x0f, 0xc0, 0x1f, 0x23,
+    0x09, 0x00, 0x0a, 0x0f, 0x40, 0x20, 0x20, 0x0a, 0xa0, 0x0c, 0x0f, 0xc0, 0x1f, 0x18, 0x0e, 0x40,
+    0x00, 0x0f, 0x40, 0x20, 0x1b, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f,
+    0x2e, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x01, 0x00, 0x0f, 0xc0, 0x1f, 0x19, 0x0f, 0x40, 0x00,
+    0x05, 0x0f, 0x00, 0x07, 0x06, 0x0f, 0x00, 0x20, 0x0d, 0x0f, 0xc0, 0x1f, 0x1c, 0x0f, 0x40, 0x20,
+    0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x07, 0x1f, 0x00, 0x0f, 0xc0, 0x1f, 0x22,
+    0x0f, 0x40, 0x00, 0x10, 0x0c, 0x80, 0x00, 0x09, 0x40, 0x00, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40,
+    0x20, 0x2d, 0x06, 0xad, 0x0c, 0x0f, 0xc0, 0x1f, 0x23, 0x0d, 0x40, 0x00, 0x0f, 0x40, 0x20, 0x1c,
+    0x06, 0x89, 0x04, 0x0f, 0xc0, 0x1f, 0x23, 0x0f, 0x40, 0x00, 0x03, 0x0f, 0x40, 0x20, 0x17, 0x06,
+    0xab, 0x00, 0x0f, 0xc0, 0x1f, 0x2a, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x26, 0x0f, 0x40,
+    0x00, 0x03, 0x0f, 0x01, 0x00, 0x03, 0x0f, 0x40, 0x20, 0x01, 0x08, 0x20, 0x04, 0x0f, 0xc0, 0x1f,
+    0x29, 0x0f, 0x40, 0x20, 0x2d, 0x05, 0xa0, 0x02, 0x01, 0x9d, 0x00, 0x0f, 0xc0, 0x1f, 0x17, 0x0f,
+    0x40, 0x00, 0x03, 0x0f, 0x40, 0x20, 0x17, 0x08, 0xae, 0x0f, 0x0f, 0xc0, 0x1f, 0x22, 0x0f, 0x40,
+    0x00, 0x04, 0x0f, 0x40, 0x20, 0x16, 0x07, 0x9f, 0x00, 0x0f, 0xc0, 0x1f, 0x21, 0x0f, 0x40, 0x20,
+    0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20,
+    0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x08, 0x04, 0x02, 0x0f, 0xc0, 0x1f, 0x21,
+    0x0f, 0x40, 0x00, 0x05, 0x0f, 0x40, 0x20, 0x15, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d,
+    0x09, 0x41, 0x06, 0x0f, 0xc0, 0x1f, 0x26, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x29, 0x0a,
+    0x40, 0x00, 0x0e, 0x75, 0x03, 0x0f, 0x40, 0x20, 0x0d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20,
+    0x2d, 0x02, 0x01, 0x00, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x2c,
+    0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x2d, 0x0f, 0x40, 0x20, 0x2d, 0x06, 0xc0, 0x01, 0x05,
+    0x18, 0x13, 0x0f, 0xc0, 0x1f, 0x23, 0x0f, 0x40, 0x20, 0x2d, 0x0b, 0x33, 0x00, 0x0f, 0xc0, 0x1f,
+    0x1e, 0x0f, 0x40, 0x20, 0x2d, 0x0f, 0xc0, 0x1f, 0x1d, 0x0e, 0x00, 0x01, 0x0f, 0x40, 0x20, 0x1b,
+    0x08, 0x2b, 0x07, 0x0f, 0xc0, 0x1f, 0x27, 0x0a, 0x80, 0x00, 0x0f, 0x40, 0x00, 0x1f, 0x06, 0xa0,
+    0x00, 0x0f, 0xc0, 0x1f, 0x24, 0x0f, 0x40, 0x00, 0x2d, 0x05, 0xc0, 0x00, 0x0f, 0x00, 0x20, 0xff,
+    0xff, 0xff, 0x60, 0x00, 0x00, 0x84, 0x0f, 0x01, 0x00, 0xff, 0x05, 0x11, 0x87, 0x01, 0x00, 0x4f,
+    0x2c, 0x2c, 0xf5, 0x6a, 0x7c, 0x00, 0x5f, 0xff, 0x03, 0xa5, 0xa5, 0x3a, 0x3a, 0x3a, 0x3a, 0xa5,
+    0xa5, 0xa5, 0x3f, 0x3f, 0x3f, 0x87, 0x87, 0x2c, 0xf5, 0x6a, 0x37, 0x7d, 0x00, 0x59, 0x30, 0x2f,
+    0x2f, 0xb7, 0x01, 0x00, 0x30, 0x2f, 0x2f, 0x2f, 0x84, 0x00, 0x04, 0x82, 0x00, 0x1f, 0xe1, 0x7e,
+    0x00, 0x53, 0x43, 0x3a, 0xb7, 0xb7, 0x23, 0x01, 0x00, 0x00, 0x84, 0x00, 0x01, 0x82, 0x00, 0x01,
+    0x87, 0x01, 0x3f, 0xe6, 0x8f, 0x2b, 0x7e, 0x00, 0x51, 0x33, 0x23, 0x23, 0xa4, 0x01, 0x00, 0x01,
+    0x82, 0x00, 0x28, 0x2f, 0x2f, 0x03, 0x01, 0x1f, 0xa2, 0x7f, 0x00, 0x4c, 0x53, 0xb7, 0x23, 0xa4,
+    0xa4, 0x31, 0x01, 0x00, 0x05, 0x82, 0x00, 0x20, 0x3a, 0x3a, 0x81, 0x00, 0x00, 0x89, 0x02, 0x3f,
+    0x37, 0xe1, 0x28, 0xfd, 0x00, 0x4a, 0x61, 0x23, 0xa4, 0x31, 0x31, 0xf3, 0x4f, 0x01, 0x00, 0x20,
+    0xf3, 0xf3, 0x82, 0x00, 0x03, 0x81, 0x00, 0x01, 0x02, 0x01, 0x00, 0x83, 0x01, 0x4f, 0x37, 0xe1,
+    0x28, 0xe5, 0x7f, 0x00, 0x46, 0xd1, 0x2f, 0x23, 0xa4, 0x31, 0xf3, 0x4f, 0xa0, 0xa0, 0x36, 0x36,
+    0x36, 0xa0, 0xa0, 0x82, 0x00, 0x01, 0x03, 0x01, 0x03, 0x83, 0x01, 0x01, 0x82, 0x01, 0x2f, 0xe6,
+    0x8f, 0x81, 0x00, 0x47, 0x10, 0xb7, 0x7e, 0x00, 0xb2, 0x36, 0x1e, 0x18, 0xb5, 0xb5, 0xb5, 0x18,
+    0x18, 0x1e, 0x36, 0xa0, 0x81, 0x00, 0x04, 0x04, 0x02, 0x04, 0x03, 0x02, 0x3f, 0xa9, 0x2b, 0xa2,
+    0x81, 0x00, 0x43, 0xf9, 0x01, 0xb7, 0xa4, 0x31, 0x4f, 0xa0, 0x1e, 0xb5, 0x26, 0x19, 0x7b, 0x7b,
+    0x19, 0x19, 0x27, 0xb5, 0x18, 0x81, 0x00, 0x06, 0x05, 0x03, 0x5f, 0x37, 0xe1, 0x7f, 0x0f, 0xd0,
+    0x7f, 0x00, 0x44, 0xd1, 0x36, 0xb5, 0x19, 0x29, 0x0d, 0x0d, 0xe3, 0x0d, 0x0d, 0x29, 0x7b, 0x19,
+    0x27, 0x81, 0x00, 0x23, 0x31, 0x31, 0x80, 0x00, 0x08, 0x01, 0x01, 0x3f, 0x28, 0xdb, 0x6b, 0x7f,
+    0x00, 0x3e, 0xf3, 0x08, 0x2f, 0xa4, 0x31, 0x4f, 0x1e, 0x27, 0x7b, 0x0d, 0x46, 0xa6, 0x0c, 0x0c,
+    0xa6, 0x46, 0xe3, 0x0d, 0x7b, 0x19, 0xb5, 0x1e, 0x36, 0x4f, 0x4f, 0x01, 0x01, 0x07, 0x81, 0x01,
+    0x6f, 0xe6, 0x8f, 0xe1, 0x7f, 0x86, 0xe5, 0x81, 0x00, 0x3e, 0xf2, 0x04, 0x23, 0x31, 0x4f, 0x1e,
+    0x26, 0x29, 0xe3, 0xa6, 0x9e, 0x32, 0x32, 0x32, 0x32, 0x9e, 0xa6, 0xe3, 0x0d, 0x7b, 0x26, 0x01,
+    0x01, 0x0e, 0x81, 0x01, 0x0f, 0x01, 0x01, 0x41, 0xe0, 0x23, 0xa4, 0x4f, 0x36, 0x27, 0x29, 0x46,
+    0x0c, 0x32, 0xe2, 0x1b, 0x1b, 0x1b, 0xe2, 0x81, 0x00, 0x4d, 0x29, 0x19, 0xb5, 0x1e, 0x81, 0x01,
+    0x00, 0x04, 0x04, 0x5f, 0xe6, 0xa9, 0xe1, 0x7f, 0x0f, 0x01, 0x01, 0x3c, 0xf1, 0x09, 0x2f, 0xa4,
+    0xf3, 0xa0, 0xb5, 0x7b, 0xe3, 0x0c, 0x64, 0x1b, 0x62, 0xe4, 0xe4, 0x62, 0xf1, 0xe2, 0x32, 0x0c,
+    0x46, 0x0d, 0x7b, 0x27, 0x1e, 0x36, 0x80, 0x00, 0x1a, 0xa4, 0x01, 0x02, 0x00, 0x81, 0x01, 0x3f,
+    0xa1, 0xdb, 0x6b, 0x81, 0x00, 0x3a, 0x00, 0x7e, 0x01, 0xe0, 0x19, 0x0d, 0x0c, 0xf4, 0xf1, 0xe4,
+    0xb6, 0xb6, 0xb6, 0x2d, 0x62, 0x1b, 0xf4, 0x9e, 0x80, 0x00, 0x14, 0x18, 0x80, 0x00, 0x0a, 0x01,
+    0x02, 0x6f, 0x37, 0x63, 0x2b, 0xa2, 0x0f, 0xd0, 0x80, 0x00, 0x39, 0x10, 0xb7, 0xff, 0x00, 0xf3,
+    0x00, 0x29, 0x46, 0x32, 0x1b, 0xe4, 0xb6, 0x40, 0x40, 0x40, 0xb6, 0xe4, 0xf1, 0x64, 0x9e, 0xa6,
+    0x80, 0x00, 0x0f, 0x81, 0x02, 0x00, 0x6f, 0x37, 0x63, 0x2b, 0x28, 0x0f, 0xe5, 0x01, 0x01, 0x39,
+    0x01, 0x7d, 0x02, 0x82, 0x0d, 0x0c, 0x64, 0x62, 0x2d, 0x40, 0x9f, 0x9f, 0x80, 0x00, 0x0f, 0x00,
+    0x01, 0x06, 0x00, 0x81, 0x02, 0x1f, 0xe1, 0x80, 0x00, 0x3b, 0xb2, 0x2f, 0xa4, 0x31, 0xa0, 0x18,
+    0x7b, 0xe3, 0x9e, 0xe2, 0x62, 0xb6, 0x80, 0x00, 0x22, 0x1b, 0xf4, 0x00, 0x02, 0x02, 0x80, 0x02,
+    0x0a, 0x00, 0x02, 0x01, 0x80, 0x00, 0x4f, 0x7f, 0x86, 0xdb, 0x6b, 0x81, 0x00, 0x37, 0x03, 0x7f,
+    0x01, 0x01, 0x80, 0x00, 0x8f, 0x40, 0x40, 0xb6, 0x2d, 0x62, 0xe2, 0x32, 0x0c, 0x00, 0x03, 0x03,
+    0x07, 0x80, 0x00, 0x1f, 0xd0, 0x80, 0x00, 0x37, 0x30, 0x23, 0xa4, 0xf3, 0x7d, 0x03, 0x44, 0x9e,
+    0xe2, 0x62, 0x2d, 0x7f, 0x02, 0x1d, 0xa6, 0x00, 0x04, 0x07, 0x00, 0x02, 0x10, 0xa9, 0x01, 0x03,
+    0x0f, 0x80, 0x00, 0x37, 0x31, 0x2f, 0x23, 0x31, 0xfd, 0x03, 0xb0, 0x9e, 0x64, 0xf1, 0x62, 0xe4,
+    0x2d, 0xe4, 0x62, 0x1b, 0x64, 0x9e, 0xff, 0x00, 0x01, 0x7f, 0x03, 0x09, 0x80, 0x04, 0x0c, 0x80,
+    0x00, 0x0f, 0x81, 0x00, 0x34, 0x02, 0x80, 0x00, 0x20, 0x7b, 0xe3, 0x7d, 0x04, 0x51, 0xf1, 0xf1,
+    0xf1, 0x1b, 0x64, 0xfe, 0x03, 0x03, 0xff, 0x00, 0x06, 0x7f, 0x02, 0x03, 0x00, 0x05, 0x0f, 0x80,
+    0x00, 0x3f, 0x02, 0x7a, 0x06, 0xe0, 0x7b, 0x0d, 0xa6, 0x0c, 0x32, 0x64, 0xe2, 0xe2, 0x64, 0x32,
+    0x9e, 0x0c, 0x46, 0x0d, 0xfe, 0x01, 0x06, 0xff, 0x05, 0x06, 0x7f, 0x01, 0x03, 0x80, 0x03, 0x02,
+    0x00, 0x02, 0x0f, 0x80, 0x00, 0x38, 0xd0, 0xa0, 0x18, 0x19, 0x29, 0xe3, 0xa6, 0x0c, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x0c, 0xa6, 0x7f, 0x00, 0x05, 0xff, 0x06, 0x0e, 0x80, 0x00, 0x4f, 0x8f, 0x63, 0x2b,
+    0x28, 0x80, 0x00, 0x38, 0x10, 0xa5, 0x78, 0x08, 0xa2, 0xa0, 0x1e, 0x27, 0x7b, 0x29, 0xe3, 0x46,
+    0xa6, 0xa6, 0xa6, 0xfd, 0x06, 0x02, 0x7f, 0x00, 0x08, 0x80, 0x08, 0x0a, 0x80, 0x00, 0x11, 0x0f,
+    0x80, 0x00, 0x0f, 0x81, 0x00, 0x32, 0x30, 0xa5, 0xb7, 0x23, 0xf8, 0x08, 0x30, 0x18, 0x26, 0x7b,
+    0xfc, 0x07, 0x07, 0xfd, 0x07, 0x0f, 0xff, 0x00, 0x04, 0x3f, 0x37, 0xa9, 0xe1, 0x80, 0x00, 0x3d,
+    0x05, 0xfa, 0x08, 0x71, 0x29, 0x29, 0x29, 0x7b, 0x7b, 0x19, 0x26, 0xfd, 0x08, 0x07, 0x7f, 0x00,
+    0x09, 0xff, 0x00, 0x00, 0x7f, 0x02, 0x10, 0xa2, 0x00, 0x05, 0x0f, 0x80, 0x00, 0x39, 0x70, 0xf3,
+    0x4f, 0xa0, 0x1e, 0x18, 0xb5, 0x26, 0x01, 0x00, 0x21, 0x27, 0xb5, 0xfd, 0x09, 0x04, 0x7f, 0x00,
+    0x07, 0xff, 0x00, 0x04, 0x7f, 0x01, 0x3f, 0xe1, 0x7f, 0xa3, 0x80, 0x00, 0x39, 0x02, 0xf7, 0x0a,
+    0x51, 0x4f, 0xa0, 0x36, 0x1e, 0x18, 0x01, 0x00, 0x12, 0x1e, 0xfe, 0x0a, 0x03, 0x01, 0x0c, 0x0d,
+    0xff, 0x00, 0x06, 0x7f, 0x02, 0x0f, 0x80, 0x00, 0x35, 0x02, 0x01, 0x01, 0x02, 0x79, 0x0b, 0x06,
+    0x7c, 0x0b, 0x07, 0x7f, 0x00, 0x08, 0xff, 0x00, 0x08, 0xff, 0x01, 0x0f, 0x80, 0x00, 0x32, 0x10,
+    0x3f, 0x80, 0x00, 0x31, 0xa4, 0x31, 0xf3, 0x82, 0x00, 0x10, 0xa0, 0x7d, 0x00, 0x01, 0x7e, 0x00,
+    0x04, 0x7f, 0x00, 0x03, 0x02, 0x0e, 0x02, 0xff, 0x00, 0x02, 0xfe, 0x02, 0x05, 0xff, 0x01, 0x0f,
+    0x80, 0x00, 0x33, 0x02, 0xf3, 0x0d, 0x11, 0x31, 0x82, 0x00, 0x01, 0x7d, 0x00, 0x05, 0xfd, 0x00,
+    0x01, 0x7f, 0x00, 0x04, 0x7e, 0x01, 0x07, 0xff, 0x00, 0x2f, 0x86, 0xdb, 0x80, 0x00, 0x38, 0x10,
+    0x87, 0x81, 0x01, 0x02, 0xf7, 0x0d, 0x00, 0x7b, 0x00, 0x01, 0xfc, 0x00, 0x0d, 0x7f, 0x00, 0x03,
+    0xfe, 0x01, 0x02, 0x7e, 0x02, 0x14, 0xa2, 0x7f, 0x01, 0x0f, 0x80, 0x00, 0x34, 0x01, 0x72, 0x0f,
+    0x19, 0xa4, 0x79, 0x0e, 0x07, 0x7f, 0x00, 0x05, 0x7e, 0x01, 0x05, 0xff, 0x00, 0x14, 0xa1, 0x7f,
+    0x01, 0x0f, 0x01, 0x05, 0x33, 0x33, 0x3f, 0x3a, 0x2f, 0x81, 0x00, 0x06, 0x01, 0x00, 0x04, 0xfe,
+    0x0f, 0x05, 0x7f, 0x00, 0x05, 0xfd, 0x02, 0x25, 0xe1, 0x7f, 0x7e, 0x02, 0x0f, 0x00, 0x06, 0x34,
+    0x22, 0x87, 0xa5, 0x81, 0x00, 0x05, 0x83, 0x00, 0x05, 0x7c, 0x10, 0x0a, 0x7f, 0x00, 0x07, 0xff,
+    0x00, 0x0f, 0x80, 0x00, 0x3b, 0x15, 0x3f, 0x81, 0x00, 0x05, 0x01, 0x00, 0x02, 0x7f, 0x11, 0x03,
+    0x02, 0x12, 0x06, 0x7f, 0x00, 0x02, 0xfd, 0x02, 0x04, 0xff, 0x00, 0x0f, 0x80, 0x00, 0x34, 0x13,
+    0x2c, 0x81, 0x00, 0x05, 0x83, 0x00, 0x08, 0xfd, 0x11, 0x04, 0x7f, 0x00, 0x04, 0x7e, 0x01, 0x35,
+    0x2b, 0x28, 0x86, 0xff, 0x00, 0x0f, 0x01, 0x09, 0x35, 0x63, 0x87, 0x3f, 0xa5, 0xa5, 0x3a, 0x2f,
+    0x75, 0x12, 0x04, 0x7d, 0x00, 0x11, 0x2f, 0x00, 0x13, 0x01, 0xfa, 0x02, 0x03, 0x7f, 0x00, 0x01,
+    0x7e, 0x01, 0x0f, 0xff, 0x00, 0x3f, 0x02, 0x01, 0x01, 0x20, 0xa5, 0x3a, 0x82, 0x00, 0x06, 0x01,
+    0x00, 0x07, 0x7e, 0x13, 0x02, 0x7f, 0x00, 0x00, 0xfd, 0x01, 0x20, 0x63, 0x2b, 0x7d, 0x02, 0x04,
+    0xfd, 0x02, 0x0f, 0x80, 0x00, 0x36, 0x41, 0x6a, 0x2c, 0x87, 0x3f, 0x82, 0x00, 0x03, 0x83, 0x00,
+    0x00, 0xfb, 0x13, 0x06, 0x7e, 0x00, 0x05, 0x7f, 0x00, 0x01, 0xfc, 0x02, 0x07, 0x7e, 0x01, 0x0f,
+    0x01, 0x0c, 0x37, 0x21, 0xf5, 0x87, 0x81, 0x00, 0x01, 0x74, 0x14, 0x03, 0x7c, 0x00, 0x01, 0x7e,
+    0x00, 0x03, 0x7f, 0x00, 0x14, 0xf5, 0x7f, 0x00, 0x36, 0x2b, 0x28, 0xa3, 0x7e, 0x01, 0x0f, 0x00,
+    0x0d, 0x38, 0x20, 0xe6, 0x2c, 0x81, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x00, 0x00, 0x0e, 0x00,
+    0x05, 0xfd, 0x00, 0x05, 0x7f, 0x00, 0x00, 0xfd, 0x01, 0x05, 0x7e, 0x01, 0x0f, 0x01, 0x0e, 0x39,
+    0x23, 0x6a, 0x2c, 0x82, 0x00, 0x07, 0x01, 0x00, 0x03, 0x7e, 0x00, 0x01, 0x79, 0x03, 0x07, 0x7f,
+    0x00, 0x0f, 0xff, 0x00, 0x40, 0x31, 0x00, 0x00, 0xa9, 0x81, 0x00, 0x06, 0x83, 0x00, 0x04, 0x7b,
+    0x16, 0x03, 0xfd, 0x00, 0x00, 0x7b, 0x02, 0x0c, 0x7f, 0x00, 0x0f, 0x01, 0x10, 0x3b, 0x32, 0x37,
+    0x6a, 0xf5, 0x82, 0x00, 0x06, 0x01, 0x00, 0x02, 0x7e, 0x00, 0x02, 0x7c, 0x01, 0x00, 0x7f, 0x00,
+    0x1f, 0x28, 0x7f, 0x00, 0x48, 0x01, 0x81, 0x00, 0x10, 0xf5, 0x72, 0x00, 0x06, 0x7c, 0x00, 0x04,
+    0x7e, 0x00, 0x00, 0x7f, 0x00, 0x2f, 0xe1, 0x2b, 0x7f, 0x00, 0x4c, 0x43, 0x00, 0x7f, 0x8f, 0xe6,
+    0x82, 0x00, 0x03, 0x01, 0x00, 0x16, 0xf5, 0x7e, 0x00, 0x00, 0x7c, 0x01, 0x29, 0x28, 0xa1, 0x7f,
+    0x00, 0x0f, 0x01, 0x13, 0x3f, 0x60, 0x7f, 0xa9, 0x37, 0xe6, 0x6a, 0x6a, 0x76, 0x00, 0x02, 0x01,
+    0x00, 0x10, 0x6a, 0x7d, 0x00, 0x21, 0xe6, 0x37, 0xfa, 0x01, 0x10, 0x2b, 0xf8, 0x03, 0x0f, 0x7f,
+    0x00, 0x4b, 0x94, 0x00, 0x00, 0x7f, 0xe1, 0x8f, 0x37, 0xe6, 0xe6, 0x6a, 0x01, 0x00, 0x01, 0x7d,
+    0x00, 0x00, 0xfc, 0x00, 0x00, 0xfd, 0x00, 0x28, 0xa3, 0x0f, 0x79, 0x03, 0x0f, 0x7f, 0x00, 0x42,
+    0xa1, 0x00, 0x00, 0xa2, 0x2b, 0x63, 0xa9, 0x37, 0x37, 0x37, 0xe6, 0x01, 0x00, 0x44, 0x37, 0x37,
+    0x37, 0x8f, 0x7e, 0x00, 0x1b, 0xa2, 0xfd, 0x00, 0x0f, 0x7f, 0x00, 0x43, 0xa0, 0x00, 0x00, 0x0f,
+    0x7f, 0x2b, 0xe1, 0x63, 0xa9, 0xa9, 0x8f, 0x01, 0x00, 0x30, 0xa9, 0xa9, 0x63, 0x7d, 0x00, 0x03,
+    0x7e, 0x00, 0x0f, 0x7f, 0x00, 0x52, 0x83, 0x00, 0x00, 0xe5, 0x86, 0x28, 0x2b, 0x2b, 0xe1, 0x01,
+    0x00, 0x10, 0x2b, 0x7d, 0x00, 0x0f, 0x7e, 0x00, 0x00, 0x0f, 0x7f, 0x00, 0x47, 0x82, 0x00, 0x00,
+    0x00, 0xdb, 0x0f, 0xa2, 0x28, 0x7f, 0x01, 0x00, 0x50, 0x28, 0x28, 0x28, 0xa3, 0x86, 0xf8, 0x01,
+    0x0f, 0x7e, 0x00, 0x57, 0x90, 0x00, 0x00, 0x00, 0x6b, 0xe5, 0xdb, 0x0f, 0x0f, 0x86, 0x01, 0x00,
+    0x31, 0x0f, 0x0f, 0x0f, 0xfb, 0x00, 0x09, 0x7e, 0x00, 0x0f, 0x7f, 0x00, 0x4d, 0x00, 0x82, 0x00,
+    0x9c, 0xd0, 0xe5, 0xe5, 0xe5, 0xdb, 0xdb, 0xdb, 0xe5, 0xe5, 0x7c, 0x00, 0x0f, 0x7e, 0x00, 0x51,
+    0x01, 0x82, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x0f, 0x7e, 0x00, 0x53, 0x0f, 0x83, 0x00, 0x04, 0x0f,
+    0x7d, 0x00, 0x58, 0x0d, 0x84, 0x00, 0x0f, 0x7c, 0x00, 0x5f, 0x0f, 0x01, 0x00, 0xd6, 0xfa, 0x21,
+    0x42, 0x3c, 0x42, 0x3c, 0x43, 0x30, 0x30, 0x30, 0x6e, 0x6e, 0x42, 0x42, 0x33, 0xf2, 0x30, 0x02,
+    0x02, 0x02, 0x02, 0x55, 0x42, 0x42, 0x42, 0x6e, 0x33, 0x33, 0xf2, 0x02, 0x33, 0x55, 0x02, 0x02,
+    0x33, 0xf2, 0x02, 0x30, 0x02, 0x55, 0xcc, 0x6e, 0x81, 0x02, 0xf2, 0xcc, 0x81, 0xf2, 0x81, 0xf2,
+    0x2c, 0x00, 0xf1, 0x03, 0x42, 0x80, 0x3d, 0x80, 0x3d, 0x81, 0x80, 0xf8, 0x8a, 0xf8, 0xfa, 0x80,
+    0x80, 0xf8, 0x80, 0x30, 0x30, 0x8a, 0x1d, 0x88, 0x30, 0x83, 0x80, 0x8a, 0x15, 0x70, 0x00, 0x2e,
+    0x9e, 0xd0, 0x80, 0x3c, 0x35, 0x69, 0x83, 0xf8, 0x3c, 0x80, 0x9b, 0x89, 0x81, 0x83, 0xf2, 0x24,
+    0x00, 0x09, 0x2c, 0x00, 0x40, 0x6e, 0x81, 0xbc, 0x80, 0x7d, 0x7f, 0x20, 0x83, 0x35, 0x23, 0x70,
+    0x30, 0x35, 0x30, 0x35, 0x89, 0x6a, 0xf0, 0x03, 0xf2, 0x80, 0x83, 0x80, 0xf8, 0x83, 0x43, 0x69,
+    0x35, 0x43, 0x43, 0x80, 0x35, 0x43, 0x83, 0x03, 0x80, 0x43, 0x63, 0x70, 0x30, 0x8a, 0x35, 0x69,
+    0x80, 0xa0, 0x0a, 0x2c, 0x00, 0xf0, 0x15, 0x03, 0x43, 0xf7, 0x80, 0xb2, 0x81, 0x30, 0x43, 0x9b,
+    0x6e, 0x43, 0x80, 0x69, 0x81, 0x81, 0x43, 0x42, 0x6e, 0x6e, 0x81, 0x2a, 0x35, 0x43, 0x43, 0x43,
+    0x81, 0x6e, 0x6e, 0xb2, 0x08, 0xcc, 0x6e, 0x42, 0x81, 0xcc, 0x30, 0xa1, 0x88, 0xaa, 0xcc, 0x69,
+    0x69, 0x35, 0x83, 0xf8, 0x43, 0xf7, 0x6e, 0x43, 0x2c, 0x00, 0x60, 0x6e, 0x43, 0xb2, 0x80, 0xb2,
+    0x2a, 0x25, 0x7f, 0x01, 0x28, 0x6a, 0xf1, 0x08, 0x35, 0x43, 0x35, 0x81, 0x83, 0x43, 0x69, 0xcc,
+    0x6e, 0x81, 0x43, 0x43, 0x81, 0x69, 0xcc, 0x35, 0xf8, 0x83, 0x2a, 0x6e, 0x81, 0x43, 0x30, 0xf4,
+    0x7d, 0x7a, 0x81, 0x6e, 0x35, 0x80, 0xf8, 0x81, 0xf7, 0x2c, 0x00, 0xf0, 0x06, 0x42, 0x43, 0xb2,
+    0x80, 0x3e, 0x43, 0x2a, 0x83, 0x83, 0x35, 0x35, 0x43, 0x80, 0x83, 0x80, 0x35, 0x81, 0x69, 0x69,
+    0x81, 0x69, 0x79, 0x7e, 0x60, 0x43, 0x43, 0x6e, 0x33, 0x69, 0x35, 0xd6, 0x61, 0x01, 0x3e, 0x64,
+    0x40, 0x35, 0x80, 0x30, 0x9b, 0x8d, 0x90, 0x10, 0x80, 0x8f, 0x9b, 0x07, 0x2c, 0x00, 0xf0, 0x01,
+    0x42, 0x43, 0x03, 0x3c, 0x42, 0x80, 0x80, 0x35, 0xf2, 0x81, 0x83, 0x81, 0x43, 0x83, 0xcc, 0x43,
+    0xe4, 0x00, 0xf0, 0x08, 0xcc, 0x81, 0x6e, 0x43, 0x81, 0x81, 0x69, 0x81, 0x81, 0xcc, 0x81, 0xcc,
+    0x69, 0xcc, 0x43, 0xcc, 0x6e, 0x81, 0x83, 0x43, 0x81, 0x35, 0x30, 0x3e, 0x6f, 0x2b, 0x42, 0x35,
+    0x2c, 0x00, 0xd1, 0x42, 0xf8, 0x30, 0x3b, 0x33, 0x58, 0x3c, 0x30, 0x43, 0x83, 0x80, 0x30, 0x83,
+    0xf8, 0x00, 0xfa, 0x11, 0x69, 0x43, 0x81, 0x43, 0x35, 0x43, 0x69, 0x69, 0x6e, 0x6e, 0x9b, 0x81,
+    0xcc, 0x81, 0x6e, 0x81, 0x43, 0x81, 0x69, 0x83, 0x81, 0x35, 0x83, 0x43, 0x81, 0x81, 0xcc, 0x69,
+    0x80, 0x80, 0xcc, 0x35, 0x2c, 0x00, 0x71, 0x6e, 0x3b, 0xcc, 0x80, 0x42, 0x80, 0x69, 0xa8, 0x7e,
+    0xf0, 0x0a, 0x2a, 0x6e, 0xcc, 0x81, 0xcc, 0x42, 0x42, 0x6e, 0x42, 0xf7, 0xb2, 0xb2, 0x08, 0x42,
+    0xf7, 0xb2, 0xf7, 0xb3, 0x42, 0x89, 0x89, 0x42, 0xf7, 0xb3, 0x42, 0x71, 0x67, 0x40, 0x81, 0x6e,
+    0x69, 0x81, 0xe3, 0x9a, 0x0c, 0x2c, 0x00, 0x91, 0x80, 0xf7, 0x3c, 0x42, 0x3c, 0x81, 0x35, 0x43,
+    0xcc, 0x14, 0x00, 0xf0, 0x0f, 0x9b, 0x6e, 0x6e, 0xf7, 0x89, 0x89, 0x6e, 0x9b, 0x9b, 0x9b, 0x89,
+    0x08, 0xf7, 0xcc, 0xcc, 0x81, 0x89, 0xb3, 0xf7, 0xf7, 0xb3, 0xb2, 0xb2, 0xf7, 0xf7, 0x42, 0x6e,
+    0xf7, 0xf7, 0x6e, 0xdc, 0x01, 0x1a, 0x35, 0x2c, 0x00, 0xb0, 0xb2, 0x83, 0x42, 0x3c, 0x04, 0x8a,
+    0x43, 0xcc, 0x9b, 0x6e, 0xf7, 0xb0, 0x62, 0x00, 0x24, 0x67, 0x00, 0x62, 0x67, 0xfa, 0x0c, 0x08,
+    0x89, 0x08, 0x9b, 0xb2, 0xf7, 0xf7, 0xf7, 0xf7, 0x89, 0x6e, 0xb2, 0x6e, 0xf7, 0x51, 0xf7, 0xf7,
+    0x81, 0x81, 0x6e, 0x08, 0x89, 0xf7, 0xb2, 0x6e, 0x83, 0x69, 0x2c, 0x00, 0xd0, 0x05, 0x83, 0x6e,
+    0xf8, 0x42, 0x35, 0xcc, 0x33, 0x81, 0x51, 0x42, 0x89, 0xf7, 0x5a, 0x6b, 0x20, 0xf7, 0x89, 0x6b,
+    0x00, 0x31, 0xf7, 0xf7, 0x6e, 0x06, 0x00, 0x00, 0xc6, 0x00, 0x30, 0xb2, 0xb2, 0xf7, 0x9c, 0x71,
+    0x40, 0xb2, 0xeb, 0xb2, 0x89, 0x54, 0x00, 0x0a, 0x2c, 0x00, 0x50, 0xb2, 0xf8, 0x4a, 0x80, 0x3d,
+    0x1c, 0x01, 0xd0, 0x6e, 0x81, 0xcc, 0x81, 0x81, 0xcc, 0x43, 0xcc, 0x81, 0xcc, 0xcc, 0x6e, 0x6e,
+    0x37, 0x98, 0x30, 0xcc, 0x81, 0x43, 0x81, 0x01, 0x10, 0xcc, 0xe9, 0x00, 0x20, 0xcc, 0x81, 0x0d,
+    0x00, 0x10, 0x6e, 0x08, 0x00, 0x1a, 0x81, 0x2c, 0x00, 0xf1, 0x01, 0x4a, 0x43, 0xf2, 0x3c, 0x6e,
+    0x58, 0x43, 0x43, 0x9b, 0x6e, 0x9b, 0x6e, 0x2a, 0xcc, 0x6e, 0x42, 0x0a, 0x64, 0x11, 0x42, 0xf0,
+    0x86, 0xfa, 0x08, 0x42, 0xff, 0xf7, 0xcc, 0x08, 0x08, 0xb2, 0x08, 0xff, 0x07, 0xf6, 0xb4, 0x07,
+    0x3d, 0xf7, 0xb2, 0xeb, 0xff, 0xb2, 0xf7, 0xf7, 0x6e, 0x69, 0x2c, 0x00, 0xf0, 0x01, 0x42, 0x3c,
+    0xcc, 0x3c, 0x6e, 0x8a, 0x43, 0x43, 0xcc, 0xcc, 0x81, 0x69, 0x2a, 0x81, 0x81, 0x81, 0x49, 0x65,
+    0x10, 0x08, 0x6e, 0x88, 0xf1, 0x04, 0x89, 0x08, 0x81, 0x6e, 0x9b, 0xf7, 0x89, 0x89, 0xf7, 0xb2,
+    0x3d, 0xb3, 0xff, 0xeb, 0x89, 0xb3, 0x89, 0x89, 0xf7, 0xff, 0x78, 0x00, 0xd3, 0x77, 0x07, 0x2c,
+    0x00, 0x91, 0xf7, 0x3c, 0x6e, 0x3c, 0x42, 0x83, 0x81, 0x35, 0x9b, 0x56, 0x6c, 0x00, 0xed, 0x6e,
+    0x81, 0x51, 0x08, 0xf7, 0x6e, 0xff, 0x08, 0x6e, 0x9b, 0x86, 0x68, 0x20, 0x81, 0x9b, 0x17, 0x00,
+    0xda, 0x81, 0x89, 0x42, 0x08, 0x42, 0xf7, 0xb3, 0x08, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0x2c, 0x00,
+    0x90, 0x3d, 0x80, 0x42, 0x80, 0x42, 0x83, 0x89, 0xeb, 0x08, 0xd1, 0x8c, 0xe0, 0x9b, 0x6e, 0x89,
+    0xb2, 0xb3, 0x08, 0x51, 0x42, 0x2a, 0x51, 0x89, 0xf7, 0x89, 0x51, 0x68, 0x69, 0x20, 0x81, 0x9b,
+    0x74, 0x71, 0x10, 0x08, 0x55, 0x00, 0x8a, 0xb2, 0xf7, 0x42, 0x08, 0xb2, 0x89, 0xcc, 0x43, 0x2c,
+    0x00, 0xf0, 0x04, 0xb2, 0x43, 0xcc, 0x3c, 0x42, 0x83, 0xcc, 0x2a, 0xff, 0x14, 0x07, 0xeb, 0xf6,
+    0xeb, 0x07, 0xf7, 0xf6, 0xff, 0x12, 0x67, 0x64, 0x51, 0x81, 0xf7, 0xff, 0x51, 0x08, 0x62, 0x6f,
+    0x00, 0x6d, 0x00, 0x30, 0x08, 0x9b, 0xcc, 0xb0, 0x00, 0x6a, 0xcc, 0x81, 0x2a, 0x2a, 0x6e, 0x81,
+    0x2c, 0x00, 0x80, 0x89, 0x80, 0x3d, 0x3c, 0xb2, 0x35, 0x81, 0x51, 0x53, 0x00, 0xf0, 0x00, 0x08,
+    0x12, 0xf7, 0xf0, 0xb4, 0x1c, 0x88, 0xf0, 0xb2, 0x89, 0x89, 0x42, 0x51, 0xb2, 0xb2, 0x3b, 0x00,
+    0xd0, 0x81, 0x81, 0x6e, 0xcc, 0xcc, 0x89, 0x6e, 0x42, 0x6e, 0x9b, 0x9b, 0xcc, 0xf7, 0x54, 0x69,
+    0x2a, 0xcc, 0xcc, 0x2c, 0x00, 0xfa, 0x23, 0xb3, 0x43, 0x6e, 0x80, 0xb2, 0x83, 0x6e, 0x08, 0xeb,
+    0x07, 0xff, 0xb3, 0xf7, 0xf7, 0xf7, 0xff, 0xf0, 0x1c, 0x14, 0x1c, 0x14, 0x1c, 0xeb, 0xf7, 0x89,
+    0xf7, 0xf7, 0x3d, 0xcc, 0x6e, 0x2a, 0x81, 0x6e, 0x89, 0xcc, 0x2a, 0x2a, 0x81, 0x6e, 0x81, 0x81,
+    0x33, 0x43, 0x9b, 0x51, 0x51, 0x51, 0x51, 0x89, 0xcc, 0x2c, 0x00, 0xf0, 0x00, 0xeb, 0x83, 0x07,
+    0x83, 0xb2, 0x69, 0x81, 0xcc, 0xf7, 0xb3, 0xb2, 0xcc, 0x2a, 0x6e, 0x9b, 0x53, 0x01, 0xc0, 0xb3,
+    0x89, 0x51, 0xf7, 0xf6, 0x07, 0xf0, 0x1c, 0x07, 0xf7, 0xf7, 0xb3, 0x42, 0x66, 0x11, 0xff, 0xda,
+    0x70, 0x9a, 0x08, 0xf7, 0x89, 0xb2, 0x42, 0x69, 0x42, 0xf7, 0x42, 0x2c, 0x00, 0xfa, 0x23, 0x3d,
+    0x81, 0xf7, 0x80, 0xb2, 0x2a, 0xf7, 0x42, 0x42, 0x6e, 0x9b, 0x51, 0x9b, 0x9b, 0x51, 0x9b, 0x08,
+    0xb2, 0x08, 0x6e, 0x9b, 0xcc, 0x89, 0x42, 0x08, 0xff, 0xff, 0xb3, 0xeb, 0xff, 0x12, 0xb3, 0xb3,
+    0xeb, 0xb3, 0xff, 0x08, 0xf7, 0x12, 0xf7, 0x89, 0x12, 0xff, 0x12, 0xf7, 0x81, 0x9b, 0x51, 0x6e,
+    0x6e, 0x2c, 0x00, 0xe0, 0xf7, 0x43, 0x3d, 0x80, 0xb2, 0x69, 0x51, 0x9b, 0x9b, 0x89, 0xf7, 0x9b,
+    0x51, 0x9b, 0x38, 0x6a, 0x40, 0x08, 0x6e, 0x51, 0x51, 0xa3, 0x99, 0xfa, 0x09, 0xff, 0xf7, 0x6e,
+    0x08, 0x08, 0xff, 0x07, 0x75, 0x0a, 0x0a, 0xf0, 0x07, 0x39, 0x75, 0x88, 0x14, 0x14, 0xf6, 0xb3,
+    0xb3, 0x3d, 0x6e, 0x81, 0x51, 0x2c, 0x00, 0xb0, 0xb2, 0x9b, 0xb2, 0x80, 0xb2, 0x83, 0xeb, 0x3d,
+    0xeb, 0xb3, 0x3d, 0xe8, 0x02, 0x10, 0xb3, 0xe6, 0x74, 0x90, 0xff, 0x07, 0x1c, 0xeb, 0x3d, 0x07,
+    0x3d, 0xff, 0xb2, 0xef, 0x01, 0x60, 0xb3, 0xeb, 0xb3, 0xb3, 0xb3, 0xb3, 0x1c, 0x9a, 0x7a, 0xf6,
+    0x3d, 0xf0, 0xeb, 0xb2, 0xb3, 0xb2, 0x2c, 0x00, 0x60, 0x3d, 0x43, 0x05, 0x80, 0xb2, 0x2a, 0xd4,
+    0x02, 0x30, 0xcc, 0x6e, 0x6e, 0xa3, 0x01, 0x32, 0x81, 0x6e, 0xcc, 0xc5, 0x9b, 0x00, 0x05, 0x00,
+    0x20, 0xcc, 0x81, 0x3e, 0x71, 0x00, 0x10, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x9a, 0x04, 0x02, 0x00,
+    0x03, 0x06, 0x2c, 0x00, 0xf0, 0x05, 0xb2, 0x69, 0x42, 0x80, 0xb2, 0x69, 0xcc, 0x69, 0x81, 0x6e,
+    0x89, 0x81, 0x69, 0x6e, 0x08, 0xf7, 0x07, 0x3d, 0xf7, 0xb3, 0x94, 0x91, 0x20, 0xf7, 0xff, 0x97,
+    0x80, 0xe0, 0xff, 0xf7, 0x51, 0x89, 0x89, 0xeb, 0x3d, 0xf7, 0xf7, 0xcc, 0x81, 0x51, 0xb2, 0xf7,
+    0x49, 0x00, 0x2a, 0x9b, 0x2a, 0x2c, 0x00, 0x50, 0xb2, 0x35, 0x42, 0x80, 0xb2, 0xae, 0x04, 0x20,
+    0x9b, 0xcc, 0x2d, 0x67, 0x00, 0xd5, 0x02, 0xf0, 0x09, 0xf7, 0x89, 0x08, 0x08, 0xf7, 0xf6, 0x3d,
+    0xeb, 0x07, 0xb3, 0xb2, 0xf7, 0x3d, 0x3d, 0xb2, 0xeb, 0x08, 0xf7, 0xf7, 0xf7, 0xb2, 0xb3, 0x89,
+    0x42, 0x62, 0x68, 0x3a, 0xcc, 0x08, 0x81, 0x2c, 0x00, 0xf0, 0x02, 0x3d, 0x43, 0x14, 0x35, 0x3d,
+    0x9b, 0xcc, 0xcc, 0xcc, 0x51, 0xcc, 0x69, 0x6e, 0x42, 0x6e, 0x81, 0x51, 0xb9, 0x02, 0x00, 0x1a,
+    0x04, 0x70, 0xff, 0x89, 0x08, 0x6e, 0x9b, 0x08, 0x6e, 0xa7, 0x01, 0x40, 0x9b, 0x51, 0x6e, 0x89,
+    0xb2, 0x00, 0x6a, 0x6e, 0x6e, 0x43, 0xcc, 0x9b, 0x81, 0x2c, 0x00, 0xf0, 0x06, 0x3d, 0x51, 0xb2,
+    0x80, 0x07, 0xf7, 0x81, 0x69, 0x51, 0x51, 0x9b, 0x51, 0x6e, 0xf7, 0xb2, 0x42, 0xf7, 0x2a, 0x81,
+    0xcc, 0x9b, 0xe0, 0x6b, 0x40, 0x51, 0x08, 0x89, 0xf7, 0x63, 0x8d, 0x30, 0x81, 0xcc, 0xcc, 0x6f,
+    0x6f, 0xaa, 0x08, 0x6e, 0xcc, 0x69, 0x6e, 0x69, 0xcc, 0x43, 0x9b, 0x69, 0x2c, 0x00, 0x60, 0xb2,
+    0x43, 0xb2, 0x80, 0x3d, 0x81, 0x1e, 0x01, 0x50, 0x81, 0x43, 0x83, 0x43, 0xcc, 0xbe, 0x00, 0x41,
+    0xb2, 0x42, 0x42, 0xf7, 0x7b, 0x68, 0xfa, 0x07, 0xf7, 0x42, 0x81, 0x6e, 0x81, 0x69, 0x51, 0x89,
+    0x9b, 0x08, 0xb2, 0xff, 0x89, 0x6e, 0xb2, 0xf7, 0x6e, 0x81, 0x2a, 0x81, 0x43, 0x69, 0x2c, 0x00,
+    0xb0, 0xb2, 0x81, 0xb3, 0x80, 0xb2, 0x69, 0x42, 0x81, 0x2a, 0xcc, 0x81, 0x74, 0x01, 0x00, 0xa5,
+    0x6c, 0x00, 0x49, 0x9d, 0x10, 0x6e, 0x87, 0x02, 0x00, 0x5f, 0x6e, 0xfa, 0x03, 0x6e, 0x9b, 0x69,
+    0xcc, 0xf7, 0x9b, 0x6e, 0xf7, 0x81, 0x2a, 0x6e, 0x42, 0xcc, 0x81, 0x81, 0x9b, 0x81, 0x81, 0x2c,
+    0x00, 0x00, 0x80, 0x00, 0x70, 0xb2, 0x43, 0x30, 0xcc, 0x81, 0x69, 0x69, 0x6c, 0x7b, 0x70, 0xff,
+    0xf7, 0xb2, 0xb2, 0x89, 0x89, 0x69, 0xfb, 0x68, 0x80, 0x9b, 0xf7, 0xf7, 0xb3, 0xf7, 0xb2, 0x6e,
+    0xf7, 0x36, 0x01, 0x60, 0x2a, 0x43, 0x9b, 0x81, 0x89, 0x6e, 0x9a, 0x06, 0x2a, 0x81, 0x83, 0x2c,
+    0x00, 0x20, 0xb3, 0x43, 0xc0, 0x07, 0x80, 0x03, 0x02, 0x43, 0x9b, 0x9b, 0x51, 0x6e, 0x9b, 0x34,
+    0x01, 0x70, 0x9b, 0x9b, 0x81, 0xcc, 0x9b, 0x81, 0x9b, 0xf1, 0x7a, 0x10, 0xb2, 0xbf, 0x7a, 0x01,
+    0x0d, 0x01, 0x20, 0xf7, 0x69, 0x4a, 0x06, 0x00, 0x17, 0x07, 0x1a, 0x35, 0x2c, 0x00, 0x50, 0xb2,
+    0x69, 0x3d, 0x80, 0xb2, 0xdb, 0xa1, 0x10, 0x69, 0x0f, 0x06, 0x10, 0x89, 0x93, 0x01, 0xf0, 0x05,
+    0xf7, 0x89, 0xcc, 0x9b, 0x42, 0x42, 0x51, 0x51, 0x9b, 0x42, 0x6e, 0xb2, 0x89, 0x9b, 0x9b, 0x89,
+    0x6e, 0x42, 0xe8, 0x89, 0x80, 0x01, 0x10, 0xf7, 0x4c, 0x01, 0x1b, 0x43, 0x2c, 0x00, 0x90, 0x3d,
+    0x69, 0xb3, 0x80, 0x3d, 0x81, 0x35, 0x02, 0xf2, 0x90, 0x06, 0x10, 0x69, 0x76, 0x05, 0x00, 0x2f,
+    0x07, 0x50, 0x80, 0x69, 0x81, 0x9b, 0xcc, 0xba, 0x00, 0x40, 0x81, 0x9b, 0x43, 0x43, 0x92, 0x00,
+    0x31, 0x9b, 0x42, 0x89, 0xba, 0x01, 0x3a, 0x81, 0xf2, 0x35, 0x2c, 0x00, 0x50, 0x42, 0x69, 0x07,
+    0x80, 0xb2, 0x61, 0x71, 0x41, 0x33, 0x6e, 0x6e, 0x42, 0x02, 0x00, 0x30, 0x55, 0x42, 0x6e, 0x31,
+    0x04, 0x00, 0x04, 0x6b, 0x31, 0xb2, 0x3d, 0x42, 0x14, 0x8e, 0x70, 0x14, 0xb3, 0xb2, 0xf7, 0xf7,
+    0x3d, 0xb3, 0x0b, 0x06, 0x10, 0xbc, 0x1a, 0x00, 0x07, 0x2c, 0x00, 0x20, 0xb2, 0x9b, 0x00, 0x06,
+    0x11, 0x42, 0xe7, 0x02, 0x60, 0xcc, 0xcc, 0x81, 0x6e, 0x42, 0x6e, 0xe7, 0x05, 0x30, 0x42, 0x89,
+    0x42, 0xa7, 0x03, 0x20, 0x6e, 0xf7, 0xe9, 0x08, 0x00, 0x52, 0x06, 0x00, 0x17, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x07, 0x00, 0x09, 0x2c, 0x00, 0x02, 0x00, 0x06, 0x30, 0xf6, 0xb4, 0x3d, 0x50, 0x02,
+    0x10, 0x6e, 0x19, 0x02, 0xfa, 0x11, 0xb3, 0xff, 0x89, 0x6e, 0x51, 0xff, 0xb2, 0xff, 0xeb, 0xff,
+    0x42, 0xff, 0x08, 0xf6, 0x08, 0xb3, 0x07, 0x3d, 0xff, 0xff, 0xeb, 0x89, 0x08, 0x9b, 0xff, 0x17,
+    0xb3, 0xf6, 0x08, 0x69, 0x08, 0x17, 0x2c, 0x00, 0x02, 0x00, 0x06, 0x10, 0xff, 0xb9, 0x71, 0xfa,
+    0x18, 0x43, 0x81, 0xb2, 0xf7, 0xf7, 0x51, 0xf6, 0xf6, 0x81, 0x81, 0x51, 0xb3, 0x08, 0x08, 0x07,
+    0xf6, 0x89, 0x9b, 0x08, 0x51, 0x89, 0xff, 0x9b, 0x42, 0xf7, 0x6e, 0x6e, 0x08, 0xf7, 0x6e, 0x69,
+    0x51, 0xf6, 0x07, 0x12, 0x08, 0xb2, 0x51, 0x81, 0x2c, 0x00, 0x11, 0x6e, 0x00, 0x06, 0xf0, 0x03,
+    0x2a, 0x6e, 0xcc, 0x6e, 0x51, 0x43, 0x51, 0x6e, 0x08, 0xf7, 0x14, 0x9b, 0x08, 0xf7, 0x51, 0x3d,
+    0xf7, 0xf7, 0x97, 0x92, 0xf0, 0x06, 0x07, 0x6e, 0x89, 0x12, 0x44, 0xff, 0xb3, 0xb2, 0xf7, 0x08,
+    0xb3, 0xb2, 0xf7, 0x2a, 0x6e, 0x6e, 0xf6, 0x17, 0x51, 0x51, 0x9b, 0xbd, 0x7b, 0x07, 0x2c, 0x00,
+    0x11, 0x42, 0x00, 0x06, 0xb0, 0x08, 0x08, 0x51, 0x81, 0x43, 0x81, 0x89, 0xcc, 0xff, 0x51, 0xf7,
+    0xa2, 0x7e, 0xf0, 0x04, 0xff, 0xb2, 0x89, 0x89, 0x9b, 0xff, 0x08, 0x42, 0x1c, 0xb3, 0x08, 0x9b,
+    0x51, 0x08, 0xf7, 0x08, 0xf6, 0xff, 0x51, 0xc2, 0x05, 0x40, 0x2a, 0x81, 0x42, 0xb2, 0xd2, 0x81,
+    0x08, 0x2c, 0x00, 0x02, 0x00, 0x06, 0x40, 0x08, 0x08, 0xcc, 0x81, 0x97, 0x02, 0x80, 0x9b, 0x08,
+    0x89, 0x69, 0x43, 0x08, 0xf7, 0x08, 0x21, 0x02, 0x80, 0x6e, 0xff, 0x42, 0x07, 0xeb, 0x6e, 0xcc,
+    0x51, 0x87, 0x07, 0xcb, 0x08, 0x9b, 0x2a, 0xcc, 0xcc, 0x6e, 0xf7, 0x89, 0x08, 0x42, 0xcc, 0x81,
+    0x2c, 0x00, 0x51, 0x80, 0x3d, 0x80, 0x6e, 0x35, 0x6d, 0x09, 0x60, 0x6e, 0xcc, 0x43, 0x69, 0x6e,
+    0xb2, 0x22, 0x03, 0xa0, 0x51, 0x2a, 0x51, 0x51, 0x9b, 0xf6, 0xff, 0x9b, 0x89, 0xeb, 0x24, 0x08,
+    0xfa, 0x00, 0xff, 0x08, 0xf7, 0xeb, 0xf7, 0x08, 0x89, 0x14, 0x17, 0x17, 0xeb, 0x17, 0x89, 0xcc,
+    0x6e, 0x2c, 0x00, 0xf0, 0x05, 0xb2, 0x81, 0x6e, 0x69, 0x42, 0x83, 0x51, 0x6e, 0xcc, 0x9b, 0x89,
+    0xb2, 0x6e, 0x81, 0x9b, 0x2a, 0x81, 0x9b, 0x9b, 0x08, 0x5f, 0x77, 0xb0, 0x6e, 0x89, 0xff, 0x08,
+    0xf7, 0xf0, 0xb3, 0xcc, 0x6e, 0x9b, 0xcc, 0x4c, 0x00, 0xbb, 0x14, 0xf6, 0xb3, 0xf6, 0x17, 0x17,
+    0x08, 0x6e, 0x51, 0x81, 0x69, 0x2c, 0x00, 0xf0, 0x11, 0x69, 0x07, 0x81, 0x42, 0x69, 0x51, 0x69,
+    0x81, 0x2a, 0x51, 0x43, 0x69, 0x43, 0x81, 0x51, 0xcc, 0xf7, 0xf6, 0xb4, 0xf7, 0xcc, 0x42, 0x43,
+    0x51, 0x12, 0x89, 0xb3, 0xb2, 0x42, 0xb2, 0x51, 0xcc, 0x84, 0x01, 0xda, 0xff, 0xb3, 0xb2, 0x07,
+    0x3d, 0x12, 0xff, 0xff, 0x08, 0x2a, 0x43, 0x69, 0x51, 0x2c, 0x00, 0xf1, 0x05, 0x07, 0x89, 0xf7,
+    0x69, 0xf7, 0x2a, 0x43, 0xcc, 0x81, 0x43, 0x83, 0x81, 0x08, 0x9b, 0x89, 0xb2, 0xf7, 0x89, 0x9b,
+    0x9b, 0xc3, 0x04, 0x02, 0x18, 0x8a, 0x51, 0xcc, 0x81, 0xf7, 0x07, 0x12, 0x0b, 0x07, 0x8b, 0x9b,
+    0x9b, 0x2a, 0x9b, 0x35, 0x80, 0x69, 0x81, 0x2c, 0x00, 0xf0, 0x03, 0xf7, 0xcc, 0x3d, 0x69, 0xf7,
+    0x69, 0x81, 0x42, 0x69, 0xf7, 0xf7, 0x51, 0x51, 0x08, 0x6e, 0xcc, 0x51, 0x81, 0x26, 0x01, 0xf0,
+    0x07, 0x08, 0x08, 0xcc, 0xcc, 0x6e, 0x81, 0xf7, 0x12, 0x6e, 0xf7, 0xff, 0xb2, 0xf7, 0x6e, 0xcc,
+    0x69, 0x89, 0x9b, 0x43, 0x08, 0x42, 0xff, 0x74, 0x05, 0x2a, 0x6e, 0x6e, 0x2c, 0x00, 0x60, 0x3d,
+    0xf7, 0xb2, 0x02, 0xf7, 0x83, 0xa7, 0x02, 0x80, 0x89, 0xb3, 0x89, 0x6e, 0xf7, 0xb2, 0xb3, 0x07,
+    0xdd, 0x92, 0x22, 0x3d, 0xf7, 0xfb, 0x92, 0x20, 0xb2, 0xf7, 0xfe, 0x08, 0x40, 0xf7, 0xb2, 0x3d,
+    0x14, 0x86, 0x01, 0x10, 0xf7, 0x3c, 0x71, 0x1a, 0x89, 0x2c, 0x00, 0x80, 0xb2, 0xcc, 0x05, 0x69,
+    0xf7, 0x2a, 0xcc, 0x43, 0xf0, 0x0a, 0x00, 0x6c, 0x07, 0x20, 0x81, 0xcc, 0x0d, 0x09, 0x00, 0x61,
+    0x04, 0x00, 0xb4, 0x09, 0x02, 0x3f, 0x05, 0x50, 0x9b, 0x6e, 0x42, 0xb2, 0xf7, 0x17, 0x03, 0x01,
+    0x00, 0x09, 0x0a, 0x2c, 0x00, 0x91, 0x04, 0x6e, 0x42, 0x80, 0x42, 0x69, 0x69, 0xcc, 0x51, 0xfc,
+    0x8f, 0x70, 0x51, 0x43, 0x6e, 0x51, 0x51, 0x42, 0xf7, 0x3d, 0x05, 0x00, 0xdc, 0x00, 0x00, 0x71,
+    0x71, 0x60, 0xff, 0x08, 0xff, 0x6e, 0x51, 0x42, 0xb8, 0x7e, 0x20, 0xff, 0xf7, 0x79, 0x06, 0x1a,
+    0x9b, 0x2c, 0x00, 0x80, 0xb2, 0x02, 0x42, 0x80, 0x42, 0x43, 0x69, 0xcc, 0x74, 0x04, 0x51, 0x69,
+    0x42, 0x42, 0x51, 0x9b, 0xd7, 0x04, 0x00, 0xcd, 0xa3, 0x00, 0xa0, 0x08, 0x90, 0x89, 0x51, 0x89,
+    0x81, 0x9b, 0x2a, 0x42, 0xf7, 0x9b, 0xfe, 0x05, 0x7a, 0xf7, 0xff, 0xff, 0x89, 0x89, 0xf7, 0x51,
+    0x2c, 0x00, 0xf0, 0x01, 0x05, 0x02, 0x14, 0x81, 0xb2, 0x9b, 0x51, 0x89, 0xb3, 0x08, 0x42, 0x6e,
+    0x9b, 0x6e, 0x42, 0xff, 0x78, 0x07, 0x00, 0x59, 0x87, 0x00, 0x82, 0x0a, 0x00, 0xb9, 0x03, 0x22,
+    0x6e, 0xcc, 0x73, 0x8d, 0x70, 0x6e, 0x81, 0x81, 0xf7, 0xf7, 0x89, 0x81, 0x76, 0x03, 0x09, 0x2c,
+    0x00, 0x62, 0x07, 0xf7, 0xb2, 0x43, 0x3d, 0xf7, 0xb5, 0x8b, 0x10, 0x9b, 0x2a, 0x09, 0x00, 0xf8,
+    0x05, 0x02, 0x83, 0x01, 0x60, 0x81, 0x81, 0x51, 0x42, 0x9b, 0x42, 0x46, 0x09, 0x00, 0x6f, 0x0a,
+    0x21, 0x9b, 0x51, 0x80, 0x81, 0x00, 0x25, 0x00, 0x08, 0x2c, 0x00, 0x10, 0xb3, 0x02, 0x06, 0x2f,
+    0x81, 0x69, 0x00, 0x0a, 0x16, 0x2a, 0x42, 0x6e, 0x2c, 0x00, 0x50, 0xb2, 0x9b, 0xb3, 0x69, 0x42,
+    0xf4, 0x0b, 0x0f, 0x00, 0x0a, 0x13, 0x3a, 0x69, 0x81, 0x43, 0x2c, 0x00, 0x9f, 0xeb, 0x9b, 0xb2,
+    0x02, 0x42, 0x43, 0xcc, 0x35, 0xcc, 0x00, 0x0a, 0x14, 0x2a, 0xf7, 0xf7, 0x2c, 0x00, 0x8f, 0x3d,
+    0x81, 0x3d, 0x35, 0xf7, 0x81, 0xf7, 0xb3, 0x00, 0x0a, 0x16, 0x1a, 0x69, 0x2c, 0x00, 0x9f, 0x3d,
+    0x55, 0x3d, 0x69, 0xf7, 0x43, 0x42, 0x9b, 0xb3, 0x00, 0x0a, 0x16, 0x0a, 0x2c, 0x00, 0x61, 0xb3,
+    0x51, 0xb3, 0x02, 0xb2, 0x81, 0x17, 0x98, 0x03, 0xd4, 0x09, 0x10, 0x1c, 0x9e, 0x78, 0x5f, 0x42,
+    0x51, 0xf7, 0x42, 0xcc, 0x00, 0x0a, 0x01, 0x01, 0xc4, 0x09, 0x07, 0x2c, 0x00, 0xa2, 0xb3, 0x6e,
+    0x07, 0x35, 0xf7, 0x43, 0xb2, 0x07, 0x1c, 0x88, 0x10, 0x8b, 0x71, 0x16, 0x16, 0x0a, 0xea, 0x75,
+    0xea, 0xf0, 0x2a, 0xa2, 0x61, 0xb2, 0x3d, 0xf7, 0xb2, 0x3d, 0x3d, 0x04, 0x03, 0x40, 0xb2, 0xb2,
+    0xb2, 0x42, 0x08, 0x09, 0x00, 0x0f, 0xa3, 0x09, 0x2c, 0x00, 0x70, 0xf0, 0x08, 0xf7, 0x69, 0xb2,
+    0x69, 0x81, 0xde, 0x08, 0x30, 0x33, 0x6e, 0x81, 0xe3, 0x06, 0x80, 0x43, 0x81, 0x6e, 0x43, 0x42,
+    0x81, 0x43, 0x43, 0x0e, 0x00, 0x02, 0xf4, 0x06, 0x10, 0x81, 0xf6, 0x05, 0x10, 0x42, 0x03, 0x0c,
+    0x00, 0xf4, 0x08, 0x0a, 0x2c, 0x00, 0xf0, 0x08, 0xb2, 0x9b, 0xb2, 0x43, 0x4a, 0xcc, 0x6e, 0x81,
+    0x42, 0x42, 0x2a, 0x81, 0x69, 0x9b, 0x89, 0x51, 0x81, 0x6e, 0xf7, 0x69, 0x81, 0xcc, 0x69, 0x6c,
+    0x82, 0xc0, 0xff, 0xcc, 0x83, 0xb2, 0x81, 0x2a, 0x69, 0xf7, 0x81, 0x43, 0x9b, 0x89, 0x3e, 0x01,
+    0x00, 0xbf, 0x07, 0x3a, 0xcc, 0x6e, 0x51, 0x2c, 0x00, 0xf0, 0x13, 0x42, 0xcc, 0x3d, 0x43, 0xf7,
+    0xcc, 0x51, 0x6e, 0xcc, 0x69, 0x9b, 0xeb, 0x2a, 0x43, 0x81, 0xb3, 0x08, 0x9b, 0x6e, 0xf7, 0x69,
+    0x9b, 0xcc, 0x08, 0x2a, 0x81, 0x69, 0x08, 0x2a, 0x69, 0x89, 0x81, 0x2a, 0x81, 0x6a, 0x01, 0x10,
+    0x89, 0x04, 0x0d, 0x40, 0xff, 0x6e, 0x42, 0x81, 0xc7, 0x7a, 0x09, 0x2c, 0x00, 0x50, 0xb2, 0x51,
+    0x14, 0xcc, 0xb2, 0xae, 0x00, 0x40, 0x6e, 0x6e, 0x9b, 0x9b, 0x2b, 0x00, 0xf0, 0x0f, 0xff, 0x89,
+    0x81, 0x9b, 0x81, 0xcc, 0x6e, 0xf7, 0x81, 0x81, 0x81, 0xf7, 0x69, 0xcc, 0x51, 0x69, 0x2a, 0x51,
+    0xcc, 0x42, 0xb3, 0x42, 0xf7, 0x89, 0x51, 0x69, 0x89, 0xcc, 0xcc, 0x9b, 0x8e, 0x7a, 0x09, 0x2c,
+    0x00, 0x20, 0xb3, 0x89, 0x04, 0x30, 0x80, 0x03, 0x03, 0xf8, 0x3b, 0x03, 0x33, 0x03, 0x33, 0x03,
+    0x00, 0x03, 0xca, 0x31, 0x10, 0x3b, 0x0b, 0x00, 0x04, 0xa0, 0x4c, 0x0f, 0x20, 0x00, 0x09, 0x10,
+    0x03, 0x17, 0x00, 0x50, 0x03, 0xf8, 0x3b, 0x33, 0x03, 0x0a, 0x00, 0x06, 0x20, 0x00, 0x04, 0xe3,
+    0x4c, 0x05, 0x20, 0x00, 0x04, 0xf9, 0x3d, 0x0b, 0x20, 0x00, 0x02, 0x55, 0x00, 0x00, 0x60, 0x00,
+    0x00, 0xae, 0x30, 0x00, 0x45, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x60, 0x00, 0x02, 0x28, 0x32, 0x03,
+    0x20, 0x00, 0x01, 0x52, 0x46, 0x0f, 0x20, 0x00, 0x00, 0x01, 0x11, 0x00, 0x70, 0xf8, 0x3b, 0xe8,
+    0x03, 0x03, 0xe8, 0x03, 0x85, 0x00, 0x00, 0x01, 0x00, 0x04, 0x20, 0x00, 0x00, 0xcc, 0x35, 0x03,
+    0x20, 0x00, 0x11, 0x03, 0x97, 0x46, 0x0e, 0x20, 0x00, 0x02, 0x99, 0x32, 0x20, 0xf8, 0x3b, 0x3f,
+    0x45, 0x04, 0x10, 0x49, 0x4a, 0xf2, 0xf2, 0xf8, 0x3b, 0x28, 0x4a, 0x00, 0xc0, 0x00, 0x00, 0x39,
+    0x00, 0x0e, 0x20, 0x00, 0x13, 0x3b, 0x01, 0x00, 0x24, 0x03, 0x03, 0x65, 0x35, 0x01, 0x7e, 0x47,
+    0x14, 0x58, 0x18, 0x00, 0x04, 0x01, 0x00, 0x40, 0x04, 0x03, 0x03, 0x03, 0x52, 0x47, 0x0c, 0x20,
+    0x00, 0x02, 0x48, 0xb0, 0x44, 0x8a, 0x3b, 0x33, 0x03, 0xcd, 0x3c, 0x00, 0xb7, 0x3a, 0x33, 0xf8,
+    0x3b, 0x30, 0x62, 0xb0, 0x04, 0x20, 0x00, 0x9b, 0x3e, 0x05, 0x05, 0xbc, 0x05, 0x04, 0x04, 0xe8,
+    0x03, 0x20, 0x00, 0x02, 0x06, 0x01, 0x27, 0x30, 0x3b, 0x8a, 0x33, 0x00, 0xec, 0x4a, 0x10, 0x3b,
+    0x4f, 0x00, 0x00, 0xe5, 0x42, 0x04, 0x20, 0x00, 0x00, 0x54, 0x48, 0x50, 0x47, 0x05, 0xbc, 0x04,
+    0x04, 0x08, 0x4e, 0x0a, 0x20, 0x00, 0x30, 0xf2, 0xf2, 0x33, 0xc0, 0x01, 0x00, 0xe2, 0x00, 0x05,
+    0xca, 0x34, 0x10, 0x3b, 0x1e, 0x46, 0x05, 0x0f, 0x01, 0x42, 0x33, 0xf8, 0x3b, 0x09, 0x93, 0x4a,
+    0x03, 0x12, 0x47, 0x06, 0x20, 0x00, 0x01, 0x23, 0x00, 0x33, 0x30, 0xf8, 0x3b, 0xcc, 0x4d, 0x01,
+    0xd6, 0x51, 0x30, 0xf2, 0x30, 0x8a, 0x20, 0x01, 0x00, 0x95, 0x46, 0x05, 0x20, 0x00, 0x00, 0xcc,
+    0x3d, 0x00, 0xf0, 0x37, 0x11, 0x04, 0x27, 0x02, 0x00, 0x40, 0x00, 0x03, 0x20, 0x00, 0x00, 0xf0,
+    0x36, 0x00, 0x40, 0x00, 0x01, 0x97, 0x44, 0x04, 0x9a, 0x48, 0x20, 0xf8, 0x3b, 0xd0, 0x46, 0x02,
+    0x21, 0x48, 0x02, 0x20, 0x00, 0x70, 0x47, 0xbc, 0x05, 0x05, 0x05, 0xbc, 0xe8, 0x00, 0x02, 0x01,
+    0xc0, 0x01, 0x05, 0x20, 0x00, 0x01, 0xc8, 0x00, 0x0e, 0xc0, 0x01, 0x02, 0x80, 0x3c, 0x03, 0x69,
+    0x50, 0x60, 0x30, 0xf8, 0x3b, 0x03, 0x03, 0xe8, 0xb9, 0x00, 0x03, 0xa5, 0x02, 0x06, 0x20, 0x00,
+    0x05, 0xe0, 0x02, 0x00, 0x28, 0x02, 0x12, 0x03, 0x16, 0x00, 0x11, 0x30, 0x50, 0x01, 0x06, 0x08,
+    0x38, 0x02, 0xc0, 0x02, 0x01, 0x79, 0x00, 0x0d, 0x20, 0x00, 0x01, 0x14, 0x00, 0x01, 0x40, 0x01,
+    0x50, 0xf2, 0x03, 0x33, 0x04, 0xe8, 0xa7, 0x02, 0x01, 0xc0, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x1c,
+    0x00, 0x0a, 0x20, 0x00, 0x02, 0x01, 0x00, 0x35, 0xbc, 0x04, 0x30, 0x20, 0x00, 0x02, 0x65, 0x00,
+    0x01, 0x90, 0x00, 0x09, 0xc0, 0x01, 0x04, 0x1f, 0x51, 0x04, 0x20, 0x00, 0x00, 0x0a, 0x39, 0x20,
+    0xbc, 0xbc, 0x19, 0x43, 0x00, 0xc9, 0x01, 0x06, 0x20, 0x00, 0x00, 0xd0, 0x00, 0x1f, 0x03, 0xc0,
+    0x01, 0x00, 0x03, 0x8d, 0x03, 0x01, 0xf0, 0x00, 0x03, 0x20, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x46,
+    0x00, 0x46, 0x3e, 0x47, 0x47, 0xf2, 0x20, 0x00, 0x31, 0xe8, 0xe8, 0x03, 0xc0, 0x01, 0x09, 0x16,
+    0x34, 0x00, 0xc0, 0x00, 0x01, 0x49, 0x01, 0x14, 0x04, 0x20, 0x00, 0x11, 0xe8, 0x7c, 0x00, 0x00,
+    0x0f, 0x3e, 0x10, 0x09, 0x8a, 0x43, 0x05, 0x20, 0x00, 0x04, 0x30, 0x00, 0x00, 0x66, 0x00, 0x05,
+    0xb1, 0x00, 0x00, 0xa0, 0x02, 0x09, 0x1c, 0x54, 0x01, 0x20, 0x00, 0x21, 0xe8, 0x03, 0x54, 0x40,
+    0x59, 0x09, 0x09, 0x6c, 0x6c, 0xf2, 0x20, 0x00, 0x01, 0xa0, 0x00, 0x04, 0xbc, 0x03, 0x00, 0x04,
+    0x04, 0x1a, 0x03, 0x90, 0x00, 0x03, 0x20, 0x00, 0xc5, 0x04, 0x04, 0x3e, 0x05, 0x3e, 0x47, 0xe9,
+    0xe9, 0x0b, 0x6c, 0x47, 0x30, 0x20, 0x00, 0x01, 0xcf, 0x03, 0x01, 0x20, 0x00, 0x0b, 0x70, 0x00,
+    0x03, 0x4f, 0x00, 0x07, 0x20, 0x00, 0x10, 0x03, 0xc3, 0x00, 0x02, 0xce, 0x3d, 0x15, 0xf2, 0x20,
+    0x00, 0x02, 0x72, 0x01, 0x01, 0x20, 0x00, 0x02, 0x4e, 0x00, 0x00, 0x80, 0x00, 0x30, 0xe8, 0xf8,
+    0x3b, 0x4b, 0x01, 0x06, 0x92, 0x01, 0x02, 0x50, 0x00, 0x90, 0x04, 0x05, 0x47, 0x6c, 0x09, 0x0b,
+    0x0e, 0x0b, 0xe9, 0x40, 0x01, 0x09, 0x3b, 0x41, 0x04, 0x20, 0x02, 0x03, 0x53, 0x00, 0x02, 0x30,
+    0x02, 0x09, 0x50, 0x01, 0x01, 0x8c, 0x35, 0x10, 0xbc, 0xc0, 0x00, 0x55, 0x0b, 0x0e, 0x0b, 0x47,
+    0xf2, 0x20, 0x00, 0x02, 0x32, 0x00, 0x0f, 0xc0, 0x02, 0x00, 0x02, 0x9d, 0x01, 0x09, 0x20, 0x00,
+    0x10, 0x03, 0x15, 0x41, 0x21, 0x09, 0x0b, 0x80, 0x00, 0x04, 0x20, 0x00, 0x10, 0xe8, 0xa0, 0x01,
+    0x00, 0xe0, 0x04, 0x01, 0x28, 0x00, 0x01, 0x52, 0x02, 0x03, 0xa0, 0x02, 0x03, 0xf8, 0x52, 0x04,
+    0x20, 0x00, 0x01, 0xfb, 0x01, 0x20, 0x05, 0x3e, 0xcc, 0x3d, 0x36, 0x09, 0x3e, 0xf2, 0x20, 0x00,
+    0x01, 0x15, 0x02, 0x01, 0x90, 0x05, 0x01, 0x4c, 0x02, 0x04, 0xc0, 0x02, 0x01, 0x07, 0x01, 0x00,
+    0x01, 0x00, 0x03, 0x20, 0x00, 0x02, 0xf9, 0x03, 0x01, 0x91, 0x43, 0x46, 0x09, 0x6c, 0x05, 0xf2,
+    0x20, 0x00, 0x00, 0x22, 0x00, 0x11, 0x05, 0x90, 0x03, 0x07, 0x14, 0x45, 0x20, 0x30, 0x3b, 0x6b,
+    0x04, 0x03, 0xbd, 0x4b, 0x01, 0x20, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x0e, 0x03, 0x01, 0x59, 0x43,
+    0x19, 0xbc, 0x20, 0x00, 0x3e, 0xe8, 0xe8, 0xe8, 0xc0, 0x02, 0x03, 0x02, 0x3e, 0x06, 0x20, 0x00,
+    0x00, 0xa0, 0x00, 0x32, 0xf2, 0xe8, 0x03, 0x10, 0x49, 0x06, 0x20, 0x00, 0x02, 0x87, 0x00, 0x0e,
+    0xc0, 0x02, 0x05, 0x5c, 0x01, 0x04, 0x20, 0x00, 0x09, 0x21, 0x00, 0x06, 0x20, 0x00, 0x04, 0xe0,
+    0x03, 0x09, 0x6f, 0x05, 0x1a, 0xf8, 0xc0, 0x01, 0x0f, 0x20, 0x00, 0x09, 0x02, 0x61, 0x00, 0x1d,
+    0xf8, 0xf0, 0x05, 0x07, 0x7f, 0x02, 0x0f, 0x20, 0x00, 0x0d, 0x01, 0x30, 0x02, 0x0a, 0x11, 0x46,
+    0x03, 0xd0, 0x01, 0x0f, 0x20, 0x00, 0x13, 0x50, 0xe8, 0x03, 0xe8, 0xf8, 0x8a, 0x67, 0x01, 0x02,
+    0x00, 0x07, 0x10, 0x33, 0x70, 0x00, 0x0f, 0x20, 0x00, 0x16, 0x0f, 0x00, 0x08, 0x36, 0x0f, 0xe0,
+    0x07, 0x04, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0e, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0c, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x10, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0a, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0e, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0c, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0e, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0c, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x11, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x09, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x12, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x08, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0e, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0f, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0, 0x07, 0x0a, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0xe0,
+    0x07, 0x0d, 0x0f, 0x20, 0x08, 0x0d, 0x0f, 0x00, 0x08, 0xed, 0x0f, 0x4b, 0x20, 0x38, 0x14, 0xa5,
+    0x23, 0x35, 0x0f, 0xac, 0x3e, 0x22, 0x02, 0xff, 0x2b, 0x00, 0xe7, 0x36, 0x4f, 0x87, 0xf5, 0xe6,
+    0x63, 0x3e, 0x00, 0x1d, 0x20, 0xb7, 0xb7, 0xbe, 0x2e, 0x00, 0xab, 0x36, 0x6f, 0x2f, 0x3a, 0x3f,
+    0x87, 0x2c, 0x6a, 0x28, 0x3d, 0x1c, 0x20, 0xb7, 0xa4, 0x78, 0x3c, 0x00, 0x6f, 0x34, 0xaf, 0x23,
+    0xb7, 0x2f, 0xa5, 0x3f, 0x87, 0x2c, 0xe6, 0xe1, 0x0f, 0x3f, 0x00, 0x18, 0x91, 0x23, 0x31, 0xa0,
+    0x18, 0x26, 0x26, 0xb5, 0x1e, 0xa0, 0x41, 0x00, 0x7f, 0x3a, 0xa5, 0x3f, 0x2c, 0xf5, 0x37, 0x2b,
+    0x26, 0x3c, 0x17, 0xc5, 0xb7, 0xf3, 0x1e, 0x7b, 0xe3, 0x46, 0x46, 0x0d, 0x19, 0x18, 0xa0, 0xf3,
+    0x81, 0x00, 0x2f, 0x63, 0xa2, 0xe6, 0x3b, 0x15, 0xf2, 0x01, 0x23, 0x31, 0x1e, 0x29, 0x0c, 0x64,
+    0xe2, 0x32, 0xa6, 0x29, 0x27, 0x36, 0x4f, 0x31, 0xa4, 0x23, 0x02, 0x01, 0x2f, 0x8f, 0x7f, 0xa5,
+    0x3a, 0x15, 0xc0, 0x23, 0xa0, 0x7b, 0x0c, 0xf1, 0xe4, 0xe4, 0xf1, 0x9e, 0xe3, 0x19, 0x1e, 0x40,
+    0x00, 0x30, 0xb7, 0x3a, 0xa5, 0xc5, 0x01, 0x2f, 0xe1, 0x0f, 0x40, 0x00, 0x13, 0xa9, 0xb7, 0x31,
+    0x18, 0xe3, 0xe2, 0xb6, 0x40, 0x40, 0x62, 0x32, 0x40, 0x00, 0x3f, 0xe6, 0xe1, 0xa3, 0xa4, 0x39,
+    0x13, 0xc1, 0x23, 0x4f, 0x26, 0xa6, 0xf1, 0xb6, 0x9f, 0xb6, 0xf1, 0x9e, 0x0d, 0x26, 0xc0, 0x00,
+    0x03, 0x40, 0x00, 0x2f, 0x63, 0x28, 0xe5, 0x3a, 0x12, 0xd1, 0x2f, 0xa4, 0xa0, 0x19, 0x0c, 0x1b,
+    0xe4, 0x2d, 0x62, 0x64, 0xa6, 0x29, 0xb5, 0x81, 0x01, 0x01, 0x00, 0x01, 0x02, 0x40, 0x00, 0x0f,
+    0x41, 0x00, 0x10, 0xe1, 0xb7, 0xa4, 0xa0, 0x26, 0x46, 0x32, 0x1b, 0x1b, 0xf4, 0x0c, 0x0d, 0x26,
+    0x1e, 0x4f, 0x80, 0x01, 0x01, 0x40, 0x00, 0x00, 0xea, 0x3e, 0x0f, 0x40, 0x00, 0x11, 0x50, 0x2f,
+    0xa4, 0x4f, 0xb5, 0x29, 0xb5, 0x3c, 0x01, 0xbf, 0x01, 0x03, 0x00, 0x02, 0x20, 0x87, 0x2c, 0x2c,
+    0x40, 0x0f, 0x40, 0x00, 0x14, 0x50, 0xf3, 0x1e, 0x26, 0x29, 0x0d, 0x71, 0x37, 0x11, 0xa0, 0xfe,
+    0x00, 0x01, 0x03, 0x03, 0x5f, 0x2c, 0x6a, 0x8f, 0x2b, 0xa1, 0x63, 0x38, 0x12, 0x10, 0x3a, 0x3d,
+    0x3a, 0x51, 0xb5, 0x27, 0x27, 0x18, 0x1e, 0x3f, 0x00, 0x03, 0x3f, 0x02, 0x5f, 0xf5, 0xe6, 0xa9,
+    0x2b, 0x0f, 0x40, 0x00, 0x14, 0x00, 0xfc, 0x02, 0x00, 0xf5, 0x33, 0x01, 0x6e, 0x36, 0x04, 0x7f,
+    0x00, 0x3f, 0x37, 0x63, 0x28, 0xe3, 0x39, 0x13, 0x02, 0x3f, 0x35, 0x02, 0x34, 0x33, 0x00, 0x7e,
+    0x00, 0x01, 0x3f, 0x00, 0x00, 0xac, 0x41, 0x10, 0xa3, 0x31, 0x2a, 0x0f, 0x40, 0x00, 0x0f, 0x03,
+    0xff, 0x33, 0x04, 0xeb, 0x3f, 0x00, 0x3f, 0x00, 0x01, 0x7f, 0x00, 0x10, 0x7f, 0xbf, 0x00, 0x0f,
+    0x40, 0x00, 0x10, 0x02, 0x3f, 0x33, 0x03, 0xb8, 0x30, 0x03, 0x3f, 0x00, 0x00, 0xfe, 0x00, 0x10,
+    0xa2, 0xbf, 0x00, 0x0f, 0x40, 0x00, 0x10, 0x34, 0x2c, 0x3f, 0xa5, 0x79, 0x30, 0x01, 0xe9, 0x34,
+    0x01, 0x3f, 0x00, 0x31, 0x37, 0xe1, 0x28, 0x7f, 0x00, 0x0f, 0x81, 0x02, 0x11, 0x10, 0x2c, 0x3e,
+    0x31, 0x02, 0xb7, 0x2f, 0x04, 0xa6, 0x40, 0x20, 0x37, 0x63, 0xa3, 0x3e, 0x0f, 0xb9, 0x26, 0x14,
+    0x10, 0x6a, 0x7e, 0x30, 0x14, 0xa5, 0xf0, 0x2f, 0x01, 0xe6, 0x41, 0x13, 0x63, 0xbe, 0x00, 0x0f,
+    0x81, 0x03, 0x13, 0x01, 0x3f, 0x30, 0x03, 0x36, 0x2e, 0x01, 0x20, 0x3b, 0x00, 0x3f, 0x00, 0x0f,
+    0x9f, 0x37, 0x18, 0x13, 0x37, 0x7d, 0x2e, 0x03, 0x67, 0x31, 0x15, 0x8f, 0x3f, 0x00, 0x0f, 0x78,
+    0x27, 0x15, 0x20, 0xe1, 0xe6, 0x3e, 0x2e, 0x01, 0xaf, 0x2d, 0x07, 0x1d, 0x3a, 0x0f, 0xb7, 0x27,
+    0x18, 0x00, 0xfc, 0x2c, 0x01, 0xf5, 0x2b, 0x00, 0xea, 0x2d, 0x14, 0x28, 0xe2, 0x30, 0x0f, 0x3f,
+    0x00, 0x16, 0x00, 0xba, 0x2b, 0x41, 0xe1, 0x63, 0x63, 0x63, 0xa8, 0x2d, 0x0f, 0x1d, 0x34, 0x23,
+    0x32, 0xdb, 0xdb, 0xa1, 0xf0, 0x2a, 0x0f, 0x5d, 0x32, 0x26, 0x20, 0x6b, 0xd0, 0x01, 0x00, 0x0f,
+    0xb2, 0x28, 0x29, 0x0f, 0xf0, 0x28, 0x62, 0xc0, 0x81, 0xcc, 0x30, 0xf8, 0x35, 0x43, 0x30, 0x30,
+    0x35, 0x35, 0x81, 0x43, 0xdc, 0x27, 0x00, 0xed, 0x26, 0x00, 0xf4, 0x26, 0x03, 0x16, 0x00, 0x70,
+    0x81, 0x81, 0x42, 0x35, 0x69, 0x80, 0x83, 0xf5, 0x1b, 0xe3, 0x35, 0x35, 0x81, 0xcc, 0x81, 0x69,
+    0x43, 0x35, 0x83, 0x35, 0x83, 0x35, 0x81, 0x43, 0x16, 0x00, 0x20, 0x81, 0x81, 0x5c, 0xa5, 0x30,
+    0x35, 0x35, 0x43, 0x9d, 0x27, 0x20, 0x81, 0x81, 0xeb, 0x26, 0x40, 0x43, 0x35, 0x81, 0x81, 0x02,
+    0x8b, 0x01, 0x16, 0x00, 0x31, 0xcc, 0x30, 0x30, 0x09, 0x00, 0x00, 0xb7, 0x1d, 0x00, 0xc2, 0x1f,
+    0x11, 0xcc, 0xc3, 0x1a, 0x10, 0x2a, 0x9b, 0xbf, 0x01, 0x16, 0x00, 0x10, 0xf2, 0x36, 0x00, 0x40,
+    0x43, 0xcc, 0xcc, 0x6e, 0x6a, 0x1b, 0x10, 0xf7, 0x97, 0x1c, 0x73, 0xb2, 0x42, 0x6e, 0x89, 0x69,
+    0x35, 0x80, 0x16, 0x00, 0x41, 0x81, 0x43, 0x02, 0x81, 0xff, 0x1b, 0x10, 0x42, 0xaf, 0x25, 0x70,
+    0xf7, 0xf7, 0x42, 0xb2, 0xf7, 0xf7, 0x9b, 0x64, 0x20, 0x03, 0x16, 0x00, 0x50, 0x33, 0x43, 0x33,
+    0x69, 0x6e, 0xb0, 0x1c, 0x11, 0x51, 0x95, 0x1b, 0x00, 0x56, 0x21, 0x10, 0xf7, 0x2b, 0x22, 0x13,
+    0x81, 0x16, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x20, 0x22, 0x01, 0x99, 0x1b, 0x00, 0x2a, 0x89, 0x11,
+    0xf7, 0x02, 0x00, 0x23, 0x89, 0x89, 0x16, 0x00, 0x00, 0xcc, 0x1e, 0x40, 0xff, 0xf7, 0xf7, 0xf7,
+    0xeb, 0x1e, 0x00, 0xe8, 0x1b, 0x50, 0x51, 0x89, 0xf7, 0x9b, 0x9b, 0x1e, 0x1b, 0x03, 0x16, 0x00,
+    0xf0, 0x01, 0x81, 0x43, 0xcc, 0x51, 0xb2, 0xf7, 0x89, 0xb3, 0xf0, 0xf0, 0xeb, 0xf7, 0x89, 0xb2,
+    0x9b, 0x81, 0x53, 0x1b, 0x44, 0xcc, 0x9b, 0x51, 0x51, 0x16, 0x00, 0x00, 0x0c, 0x23, 0x10, 0xf7,
+    0x50, 0x19, 0xf3, 0x01, 0x89, 0x51, 0xf7, 0xeb, 0x07, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x89, 0x89,
+    0xff, 0x89, 0x9b, 0x42, 0x16, 0x00, 0x20, 0x6e, 0xcc, 0x89, 0x26, 0x00, 0x74, 0x00, 0xf3, 0x00,
+    0xf7, 0x3d, 0xb3, 0xb3, 0x89, 0xf7, 0x07, 0x14, 0xeb, 0x14, 0x07, 0x14, 0x3d, 0xb2, 0x89, 0x16,
+    0x00, 0x00, 0x24, 0x22, 0x22, 0xcc, 0x9b, 0x1d, 0x1f, 0x00, 0x26, 0x1a, 0x40, 0x9b, 0x89, 0xf7,
+    0x6e, 0xa7, 0x19, 0x13, 0x81, 0x16, 0x00, 0x00, 0x6a, 0x8e, 0x20, 0x9b, 0xcc, 0xb4, 0x1e, 0x41,
+    0x89, 0x89, 0xff, 0xb3, 0x36, 0x00, 0x63, 0x89, 0x89, 0x6e, 0x42, 0xcc, 0x9b, 0x16, 0x00, 0x91,
+    0x42, 0xcc, 0xf7, 0xcc, 0x9b, 0xcc, 0x81, 0x42, 0x89, 0x41, 0x01, 0x10, 0x89, 0x21, 0x24, 0x63,
+    0xf7, 0x89, 0x6e, 0xcc, 0x81, 0x69, 0x16, 0x00, 0x10, 0x6e, 0xc1, 0x1a, 0x01, 0x6b, 0x21, 0x00,
+    0x33, 0x24, 0x10, 0xf7, 0xc1, 0x1c, 0x00, 0xc5, 0x00, 0x23, 0x2a, 0x69, 0x16, 0x00, 0x50, 0x6e,
+    0xcc, 0x42, 0x02, 0x69, 0x97, 0x1a, 0x10, 0x42, 0xda, 0x1c, 0x60, 0x42, 0x89, 0x9b, 0x42, 0x42,
+    0x89, 0xe1, 0x26, 0x13, 0x43, 0x16, 0x00, 0x50, 0x89, 0x9b, 0x42, 0x81, 0x02, 0x78, 0x1e, 0x01,
+    0x25, 0x27, 0x40, 0xf7, 0x42, 0x42, 0xf7, 0x87, 0x01, 0x33, 0x42, 0x42, 0x6e, 0x16, 0x00, 0x50,
+    0x6e, 0x43, 0x33, 0xff, 0x42, 0x21, 0x24, 0x11, 0x89, 0x7a, 0x01, 0x22, 0xf7, 0xf7, 0xa0, 0x01,
+    0x23, 0x9b, 0x89, 0x16, 0x00, 0x80, 0x81, 0x43, 0x43, 0x51, 0x9b, 0x81, 0x89, 0xf7, 0xbc, 0x1d,
+    0x10, 0xff, 0xc4, 0x00, 0x83, 0xb2, 0x89, 0xf7, 0x9b, 0x89, 0xf6, 0x89, 0x9b, 0x16, 0x00, 0xf0,
+    0x05, 0x43, 0x43, 0x81, 0x08, 0xcc, 0x2a, 0x9b, 0x08, 0x6e, 0x9b, 0xff, 0x89, 0x51, 0xf7, 0x3d,
+    0xf7, 0x9b, 0xf7, 0xff, 0x89, 0x38, 0x00, 0x13, 0x51, 0x16, 0x00, 0x01, 0x6b, 0x27, 0x10, 0x42,
+    0xf3, 0x1d, 0x40, 0x08, 0x51, 0x51, 0xff, 0x6b, 0x96, 0x64, 0x08, 0xeb, 0xff, 0x17, 0xf6, 0x89,
+    0x16, 0x00, 0x00, 0xc9, 0x23, 0x60, 0x2a, 0x69, 0x81, 0x89, 0x89, 0xff, 0x12, 0x28, 0xb3, 0x42,
+    0x6e, 0x51, 0xf7, 0x08, 0xf7, 0xf7, 0x08, 0x51, 0x43, 0x81, 0x16, 0x00, 0x10, 0xf7, 0xb0, 0x21,
+    0x00, 0x5b, 0x02, 0x01, 0x01, 0x00, 0x80, 0xb3, 0xf7, 0xb2, 0xf7, 0x6e, 0xff, 0x6e, 0xf7, 0x24,
+    0x22, 0x03, 0x16, 0x00, 0x00, 0x63, 0x00, 0x00, 0x71, 0x01, 0x11, 0xcc, 0x21, 0x96, 0x01, 0x5d,
+    0x01, 0x10, 0xb2, 0xc4, 0x28, 0x03, 0x16, 0x00, 0x70, 0x42, 0x42, 0x6e, 0xcc, 0x08, 0x9b, 0xcc,
+    0x2b, 0x00, 0x00, 0x7a, 0x25, 0x00, 0xd1, 0x22, 0x00, 0xea, 0x00, 0x00, 0x8b, 0x24, 0x01, 0x16,
+    0x00, 0x40, 0xb2, 0x6e, 0x89, 0x81, 0xe5, 0x01, 0x30, 0x89, 0x08, 0xf7, 0xf5, 0x1d, 0x00, 0x69,
+    0x28, 0x00, 0xa6, 0x01, 0x23, 0x89, 0x6e, 0x16, 0x00, 0x31, 0x89, 0x6e, 0xcc, 0x86, 0xc0, 0x0c,
+    0x80, 0x02, 0x13, 0x6e, 0x16, 0x00, 0x00, 0x7c, 0x1e, 0x00, 0x8e, 0x26, 0x0e, 0x80, 0x02, 0x02,
+    0x16, 0x00, 0x00, 0x13, 0x03, 0x30, 0x3d, 0xb2, 0xb3, 0xdf, 0x8f, 0x00, 0x49, 0x29, 0x10, 0x89,
+    0x63, 0x01, 0x11, 0x42, 0xce, 0x00, 0x02, 0x16, 0x00, 0x10, 0xb2, 0x91, 0x22, 0x02, 0xa7, 0x28,
+    0x40, 0x9b, 0x43, 0x9b, 0x69, 0x9b, 0x28, 0x20, 0x6e, 0xf7, 0x9a, 0x28, 0x03, 0x16, 0x00, 0x01,
+    0x77, 0x23, 0x30, 0x89, 0xcc, 0x89, 0x83, 0x23, 0x40, 0xcc, 0xcc, 0x81, 0x9b, 0x78, 0xa4, 0x01,
+    0x9b, 0x20, 0x03, 0x16, 0x00, 0x54, 0xf7, 0x03, 0x33, 0x03, 0x8a, 0x35, 0x11, 0x00, 0x5e, 0x0c,
+    0x00, 0x10, 0x00, 0x04, 0x25, 0x0d, 0x02, 0x10, 0x00, 0x23, 0x33, 0x8a, 0x87, 0x0c, 0x00, 0x10,
+    0x00, 0x00, 0x87, 0x0d, 0x00, 0xc4, 0x54, 0x05, 0x10, 0x00, 0x00, 0x9d, 0x12, 0x03, 0x50, 0x60,
+    0x14, 0x8a, 0xad, 0x12, 0x20, 0x03, 0x03, 0xf8, 0x54, 0x02, 0x10, 0x00, 0x00, 0xf6, 0x4d, 0x03,
+    0xf6, 0x0d, 0x04, 0x1c, 0x4e, 0x50, 0x8a, 0x47, 0x3e, 0x05, 0x04, 0x48, 0x00, 0x02, 0x9a, 0x62,
+    0x11, 0xf2, 0x14, 0x61, 0x01, 0x10, 0x00, 0x03, 0x48, 0x00, 0x83, 0x47, 0x47, 0x05, 0x04, 0x04,
+    0x03, 0x03, 0xf8, 0x0b, 0x51, 0x13, 0x8a, 0x49, 0x53, 0x03, 0x08, 0x00, 0x21, 0xf2, 0x8a, 0xf8,
+    0x0d, 0x12, 0x33, 0x10, 0x00, 0x00, 0x78, 0x58, 0x01, 0x99, 0x11, 0x01, 0x28, 0x00, 0x01, 0x6a,
+    0x00, 0x13, 0x8a, 0xfa, 0x0d, 0x16, 0xf8, 0x10, 0x00, 0x01, 0x11, 0x00, 0x01, 0x2c, 0x13, 0x01,
+    0x30, 0x00, 0x01, 0xa6, 0x0e, 0x15, 0x47, 0x10, 0x00, 0x03, 0x1b, 0x10, 0x00, 0x7a, 0x61, 0x02,
+    0x20, 0x00, 0x74, 0x04, 0x05, 0x3e, 0x6c, 0x09, 0x09, 0xf8, 0x10, 0x00, 0x06, 0x28, 0x00, 0x03,
+    0x08, 0x00, 0x67, 0x03, 0x05, 0x05, 0x09, 0x0b, 0x09, 0x40, 0x00, 0x01, 0x70, 0x00, 0x04, 0x48,
+    0x01, 0x92, 0x8a, 0x33, 0x03, 0xbc, 0x3e, 0x09, 0x0e, 0x09, 0x30, 0xfc, 0x14, 0x02, 0x38, 0x00,
+    0x00, 0xa0, 0x00, 0x03, 0x72, 0x0e, 0x00, 0xa4, 0x59, 0x52, 0x05, 0x6c, 0x0b, 0x6c, 0xf8, 0xd2,
+    0x0e, 0x12, 0x04, 0xc4, 0x13, 0x20, 0xf2, 0x33, 0xfc, 0x55, 0x00, 0xf3, 0x52, 0x12, 0xf8, 0x8b,
+    0x10, 0x20, 0x3e, 0xf8, 0x10, 0x00, 0x35, 0x03, 0xe8, 0xe8, 0xc0, 0x00, 0x03, 0x8f, 0x0f, 0x01,
+    0x50, 0x00, 0x00, 0xc5, 0x0d, 0x01, 0xdc, 0x4d, 0x25, 0x03, 0x03, 0xde, 0x4f, 0x01, 0xa2, 0x0f,
+    0x0b, 0x10, 0x00, 0x01, 0x98, 0x00, 0x05, 0xf8, 0x00, 0x03, 0xa8, 0x00, 0x08, 0x10, 0x00, 0x0d,
+    0xf0, 0x01, 0x0c, 0x10, 0x02, 0x0a, 0xf0, 0x01, 0x0c, 0x10, 0x02, 0x0c, 0xf0, 0x01, 0x0c, 0x10,
+    0x02, 0x0c, 0xf0, 0x01, 0x0c, 0x10, 0x02, 0x0d, 0xf0, 0x01, 0x0c, 0x10, 0x02, 0x0b, 0xf0, 0x01,
+    0x0c, 0x10, 0x02, 0x0f, 0xf0, 0x01, 0x01, 0x0c, 0x10, 0x02, 0x0e, 0xf0, 0x01, 0x0b, 0x10, 0x02,
+    0x0d, 0xf0, 0x01, 0x0a, 0x10, 0x02, 0x0e, 0xf0, 0x01, 0x0c, 0x10, 0x02, 0x06, 0xf0, 0x01, 0x0c,
+    0x10, 0x02, 0x0c, 0xf0, 0x01, 0x0c, 0x10, 0x02, 0x0c, 0xf0, 0x01, 0x0c, 0x10, 0x02, 0x0c, 0xf0,
+    0x01, 0x0c, 0x10, 0x02, 0x0f, 0x00, 0x02, 0x2d, 0x01, 0x05, 0x08, 0x00, 0xb8, 0x0a, 0x0f, 0xb6,
+    0x0f, 0x07, 0x00, 0x18, 0x3c, 0x5f, 0xb7, 0x2f, 0x3f, 0x2c, 0x8f, 0x54, 0x0f, 0x03, 0xaf, 0x23,
+    0x31, 0x36, 0x1e, 0xa0, 0x31, 0x23, 0x2f, 0x3f, 0xf5, 0xf3, 0x0e, 0x02, 0xcf, 0x23, 0xf3, 0x29,
+    0x9e, 0xa6, 0x26, 0x4f, 0xa4, 0xb7, 0xa5, 0x87, 0x37, 0x52, 0x0e, 0x01, 0xde, 0xa4, 0x27, 0x1b,
+    0xb6, 0xe2, 0x29, 0xa0, 0x31, 0xb7, 0x3a, 0x87, 0x6a, 0x7f, 0x20, 0x00, 0x80, 0x2f, 0x31, 0x0d,
+    0x62, 0xb6, 0x32, 0x7b, 0xa0, 0x40, 0x00, 0x2e, 0x6a, 0x2b, 0x52, 0x0e, 0xdf, 0x2f, 0xf3, 0x7b,
+    0x9e, 0x32, 0x0d, 0x18, 0xf3, 0xa4, 0x2f, 0xa5, 0x87, 0xe6, 0x20, 0x00, 0x01, 0xde, 0x31, 0x1e,
+    0x19, 0x19, 0x18, 0x4f, 0xa4, 0x23, 0x3a, 0x3f, 0x2c, 0x37, 0x28, 0x20, 0x00, 0x40, 0xa5, 0x23,
+    0xf3, 0x4f, 0xf6, 0x0d, 0x6e, 0x2f, 0xa5, 0x87, 0xf5, 0xa9, 0x0f, 0x7b, 0x09, 0x30, 0x87, 0x2f,
+    0x23, 0x99, 0x0c, 0x6f, 0x2f, 0xa5, 0x87, 0x2c, 0xe6, 0x2b, 0xd1, 0x0d, 0x00, 0x31, 0x2c, 0x3f,
+    0x2f, 0x77, 0x0c, 0x5f, 0x87, 0x2c, 0x6a, 0x63, 0x0f, 0xbb, 0x09, 0x01, 0x31, 0xf5, 0x87, 0x3f,
+    0xba, 0x49, 0x00, 0xd1, 0x0f, 0x0f, 0xda, 0x09, 0x01, 0x20, 0x37, 0xe6, 0x6e, 0x38, 0x20, 0x6a,
+    0x37, 0x2f, 0x0f, 0x0f, 0xfa, 0x09, 0x02, 0x50, 0x7f, 0x2b, 0x37, 0x37, 0x8f, 0xf5, 0x4b, 0x0f,
+    0x19, 0x0a, 0x05, 0x33, 0xdb, 0xdb, 0x0f, 0x33, 0x0b, 0x0f, 0xc2, 0x01, 0x05, 0x0f, 0x56, 0x0a,
+    0x08, 0x11, 0xcc, 0x87, 0x09, 0x01, 0xd0, 0x30, 0x01, 0x92, 0x09, 0x20, 0x02, 0x83, 0x3e, 0x30,
+    0x00, 0x37, 0x09, 0x21, 0x81, 0x43, 0x26, 0x30, 0x04, 0x9c, 0x09, 0x11, 0x42, 0x51, 0x06, 0x51,
+    0x6e, 0x43, 0x81, 0xcc, 0xcc, 0x8c, 0x97, 0x00, 0xe4, 0x06, 0x20, 0xcc, 0xcc, 0xc6, 0x07, 0x00,
+    0x6c, 0x9a, 0x20, 0x9b, 0x51, 0x94, 0x2c, 0x31, 0xf7, 0xeb, 0xf7, 0x70, 0x25, 0x02, 0x78, 0x2c,
+    0x02, 0x4f, 0x07, 0x10, 0xcc, 0x11, 0x27, 0x00, 0xf2, 0x06, 0x10, 0x6e, 0x81, 0x22, 0x00, 0x16,
+    0x08, 0x01, 0x17, 0x00, 0xa0, 0x51, 0x51, 0x6e, 0x2a, 0xcc, 0xcc, 0x89, 0x42, 0x6e, 0x43, 0xa6,
+    0x06, 0x00, 0x0d, 0x25, 0x00, 0x2a, 0x07, 0x02, 0x32, 0x95, 0x01, 0x2f, 0x09, 0x20, 0x89, 0xff,
+    0x6a, 0xb3, 0x30, 0x6e, 0x81, 0x9b, 0xb9, 0x2d, 0x00, 0x3b, 0x08, 0x00, 0x51, 0x09, 0x11, 0x51,
+    0xf5, 0x08, 0x01, 0x42, 0x07, 0x30, 0xf7, 0x89, 0x9b, 0x0b, 0x00, 0x01, 0x60, 0x00, 0x03, 0x66,
+    0xb7, 0x02, 0x60, 0x00, 0x01, 0x31, 0x23, 0x01, 0x2a, 0x09, 0x00, 0x0b, 0x00, 0x51, 0x6e, 0xb2,
+    0xf7, 0x07, 0xb3, 0xef, 0x2f, 0x20, 0x89, 0x89, 0x0b, 0x00, 0x10, 0x42, 0x16, 0x07, 0x01, 0x7b,
+    0x07, 0x01, 0x06, 0x00, 0xd0, 0x6e, 0x03, 0x30, 0x03, 0x03, 0x03, 0x30, 0x33, 0xf2, 0x03, 0x30,
+    0x33, 0x33, 0x08, 0x00, 0x10, 0x30, 0x7e, 0x03, 0x01, 0xf3, 0x19, 0x11, 0xbc, 0xd3, 0x67, 0x01,
+    0xe1, 0x69, 0x01, 0x84, 0x18, 0x32, 0x05, 0x04, 0x03, 0xb3, 0x18, 0x12, 0x03, 0xd1, 0x5b, 0x21,
+    0x03, 0xe8, 0xfd, 0x16, 0x01, 0x0c, 0x00, 0x01, 0x10, 0x00, 0x31, 0x05, 0x09, 0x04, 0x44, 0x00,
+    0x01, 0x10, 0x00, 0x60, 0x03, 0x30, 0x33, 0x05, 0xe9, 0x04, 0xff, 0x57, 0x00, 0x10, 0x00, 0x00,
+    0x56, 0x5a, 0x30, 0x33, 0x03, 0xbc, 0x01, 0x18, 0x01, 0x5c, 0x00, 0x00, 0x74, 0x00, 0x04, 0x08,
+    0x00, 0x02, 0x78, 0x00, 0x04, 0x88, 0x00, 0x04, 0x78, 0x00, 0x04, 0x88, 0x00, 0x04, 0x78, 0x00,
+    0x04, 0x88, 0x00, 0x07, 0x78, 0x00, 0x04, 0x88, 0x00, 0x01, 0x78, 0x00, 0x04, 0x88, 0x00, 0x04,
+    0x78, 0x00, 0x04, 0x88, 0x00, 0x04, 0x78, 0x00, 0x04, 0x88, 0x00, 0x0c, 0x80, 0x00, 0x66, 0x00,
+    0xb7, 0xb7, 0x2f, 0x3f, 0xe6, 0xda, 0x03, 0x75, 0x23, 0x4f, 0x29, 0xa0, 0xb7, 0x87, 0x28, 0x2d,
+    0x02, 0x76, 0x23, 0x0c, 0xf1, 0xb5, 0x23, 0x3f, 0xa9, 0x10, 0x00, 0x65, 0x29, 0x0d, 0x4f, 0xb7,
+    0x87, 0x63, 0x10, 0x00, 0x66, 0x3a, 0x31, 0x31, 0x23, 0xa5, 0xf5, 0x30, 0x00, 0x66, 0x2c, 0xa5,
+    0x3a, 0x3f, 0x2c, 0x63, 0xba, 0x11, 0x3a, 0x37, 0x37, 0x6a, 0x38, 0x03, 0x29, 0xdb, 0xe5, 0x18,
+    0x10, 0x04, 0x7d, 0x02, 0x01, 0x6b, 0x26, 0x01, 0x4e, 0x0b, 0x02, 0xde, 0x01, 0x01, 0xb9, 0x27,
+    0x22, 0xcc, 0xcc, 0xbf, 0x09, 0x00, 0x96, 0x2b, 0x00, 0x95, 0x26, 0x00, 0x4f, 0x26, 0x00, 0x28,
+    0x00, 0x42, 0x89, 0xcc, 0x89, 0x42, 0xd4, 0x01, 0x11, 0xf7, 0x49, 0x6d, 0x01, 0x49, 0x67, 0x10,
+    0xf2, 0xae, 0x18, 0x02, 0x58, 0x72, 0x20, 0x04, 0x3e, 0xa9, 0x16, 0x00, 0x05, 0x06, 0x11, 0x03,
+    0x42, 0x6f, 0x00, 0x66, 0x1a, 0x02, 0x1c, 0x00, 0x10, 0xf2, 0x1c, 0x00, 0x03, 0x18, 0x5e, 0x10,
+    0x03, 0x24, 0x00, 0x31, 0xa4, 0x4f, 0x87, 0xea, 0x13, 0x41, 0x18, 0x0d, 0x3a, 0xa3, 0xd0, 0x00,
+    0x21, 0xb7, 0x2c, 0xc6, 0x04, 0x22, 0xe1, 0x2b, 0x3f, 0x13, 0x01, 0x0e, 0x29, 0x02, 0x3f, 0x9f,
+    0x01, 0x33, 0x0a, 0x03, 0x34, 0x1a, 0x01, 0xc3, 0x69, 0x00, 0xdb, 0x55, 0x80, 0x36, 0x6a, 0x00,
+    0x00, 0x2c, 0xa3, 0x00, 0x00, 0x34, 0x2f, 0x00, 0x56, 0x00, 0x31, 0x2c, 0x00, 0x80, 0x02, 0x00,
+    0xf3, 0x68, 0x82, 0x00, 0x84, 0x00, 0x86, 0x00, 0x88, 0x00, 0x8a, 0x00, 0x8c, 0x00, 0x8e, 0x00,
+    0x90, 0x00, 0x92, 0x00, 0x94, 0x00, 0x96, 0x00, 0x98, 0x00, 0x9a, 0x00, 0x9c, 0x00, 0x9e, 0x00,
+    0xa0, 0x00, 0xa2, 0x00, 0xa4, 0x00, 0xa6, 0x00, 0xa8, 0x00, 0xaa, 0x00, 0xac, 0x00, 0xae, 0x00,
+    0xb0, 0x00, 0xb2, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0xb8, 0x00, 0xba, 0x00, 0xbc, 0x00, 0xbe, 0x00,
+    0xc0, 0x00, 0xc2, 0x00, 0xc4, 0x00, 0xc6, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcc, 0x00, 0xce, 0x00,
+    0xd0, 0x00, 0xd2, 0x00, 0xd4, 0x00, 0xd6, 0x00, 0xd8, 0x00, 0xda, 0x00, 0xdc, 0x00, 0xde, 0x00,
+    0xe0, 0x00, 0xe2, 0x00, 0xe4, 0x00, 0xe6, 0x00, 0xe8, 0x00, 0xea, 0x00, 0xec, 0x00, 0xee, 0x00,
+    0xf0, 0x00, 0xf2, 0x00, 0xf4, 0x00, 0xf6, 0x00, 0xf8, 0x02, 0x00, 0xf1, 0x9c, 0xfa, 0x00, 0xfc,
+    0x00, 0xfe, 0x00, 0x00, 0x01, 0x02, 0x01, 0x04, 0x01, 0x06, 0x01, 0x08, 0x01, 0x0a, 0x01, 0x0c,
+    0x01, 0x0e, 0x01, 0x10, 0x01, 0x12, 0x01, 0x14, 0x01, 0x16, 0x01, 0x18, 0x01, 0x1a, 0x01, 0x1c,
+    0x01, 0x1e, 0x01, 0x20, 0x01, 0x22, 0x01, 0x24, 0x01, 0x26, 0x01, 0x28, 0x01, 0x2a, 0x01, 0x2c,
+    0x01, 0x2e, 0x01, 0x30, 0x01, 0x32, 0x01, 0x34, 0x01, 0x34, 0x01, 0x36, 0x01, 0x38, 0x01, 0x3a,
+    0x01, 0x3c, 0x01, 0x3e, 0x01, 0x40, 0x01, 0x42, 0x01, 0x44, 0x01, 0x46, 0x01, 0x48, 0x01, 0x4a,
+    0x01, 0x4c, 0x01, 0x4e, 0x01, 0x50, 0x01, 0x52, 0x01, 0x54, 0x01, 0x56, 0x01, 0x58, 0x01, 0x5a,
+    0x01, 0x5c, 0x01, 0x5e, 0x01, 0x60, 0x01, 0x62, 0x01, 0x64, 0x01, 0x66, 0x01, 0x68, 0x01, 0x6a,
+    0x01, 0x6c, 0x01, 0x6e, 0x01, 0x70, 0x01, 0x72, 0x01, 0x1b, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x12,
+    0x00, 0x14, 0x00, 0x18, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x10, 0x00, 0x20, 0x00, 0x0f, 0x00, 0x22,
+    0x00, 0x0d, 0x00, 0x26, 0x00, 0x0c, 0x00, 0x28, 0x00, 0x0b, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x2c,
+    0x00, 0x09, 0x00, 0x2e, 0x00, 0x08, 0x00, 0x30, 0x04, 0x00, 0x71, 0x07, 0x00, 0x32, 0x00, 0x06,
+    0x00, 0x34, 0x04, 0x00, 0x31, 0x05, 0x00, 0x36, 0x04, 0x00, 0x35, 0x04, 0x00, 0x38, 0x04, 0x00,
+    0x39, 0x03, 0x00, 0x3a, 0x04, 0x00, 0x3f, 0x02, 0x00, 0x3c, 0x04, 0x00, 0x12, 0x0c, 0x38, 0x00,
+    0x08, 0x54, 0x00, 0x04, 0x68, 0x00, 0x04, 0x78, 0x00, 0x00, 0x84, 0x00, 0x04, 0x90, 0x00, 0x00,
+    0x9c, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xac, 0x00, 0x00, 0xb4, 0x00, 0x00, 0xbc, 0x00, 0x00, 0xc4,
+    0x00, 0x00, 0xcc, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xec, 0x00,
+    0xf1, 0x0c, 0x0b, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x12, 0x00, 0x06, 0x00,
+    0x14, 0x00, 0x05, 0x00, 0x16, 0x00, 0x04, 0x00, 0x18, 0x00, 0x03, 0x00, 0x1a, 0x04, 0x00, 0x31,
+    0x02, 0x00, 0x1c, 0x04, 0x00, 0x3f, 0x01, 0x00, 0x1e, 0x04, 0x00, 0x12, 0x04, 0x30, 0x00, 0x04,
+    0x40, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x54, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x64, 0x00, 0x00, 0x6c,
+    0x00, 0x00, 0x74, 0x00, 0xf1, 0x00, 0x05, 0x00, 0x06, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x02, 0x00,
+    0x0c, 0x00, 0x01, 0x00, 0x0e, 0x04, 0x00, 0x3f, 0x00, 0x00, 0x10, 0x04, 0x00, 0x02, 0x04, 0x20,
+    0x00, 0x00, 0x2c, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3c, 0x00, 0x7f, 0x01, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x08, 0x04, 0x00, 0x02, 0x02, 0x1c, 0x00, 0x1b, 0x04, 0x04, 0x00, 0xa0, 0x02, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -20,16 +20,34 @@
 #include <assert.h>
 #include "stm32f429i_discovery_lcd.h"
 #include "stm32f429i_discovery_gyroscope.h"
+#include "stm32f429i_discovery_sdram.h"
+#include "stm32f429i_discovery_ts.h"
+#include "l3gd20.h"
 #include <math.h>
 
 /* Private includes ----------------------------------------------------------*/
 #include "engine.h"
+#include "asset.h"
+#include "hud.h"
+#include "input.h"
+#include "gyro.h"
+#ifdef SPRITE_BENCHMARK
+#include "bench.h" /* open room with hundreds of sprites */
+#define GAME_LEVEL m_bench
+#else
 #include "e1m1.h"
+#define GAME_LEVEL m_e1m1
+#endif
+#ifdef SECTOR_DEMO
+#include "plaza.h" /* sector world instead of the grid level */
+#endif
+#include "textures.h"
 #include "sdl_scancodes.h"
 
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private define ------------------------------------------------------------*/
+#define GYRO_RATE_HZ 95.0f /* L3GD20_OUTPUT_DATARATE_1 set by BSP_GYRO_Init */
 
 /* Private macro -------------------------------------------------------------*/
 
@@ -38,14 +56,29 @@
 UART_HandleTypeDef huart1;
 // DMA_HandleTypeDef hdma_usart1_tx;
 DMA2D_HandleTypeDef hdma2d;
+SPI_HandleTypeDef hspi5; /* gyroscope samples read by DMA, the BSP sets up the bus */
+DMA_HandleTypeDef hdma_spi5_rx;
+DMA_HandleTypeDef hdma_spi5_tx;
 LTDC_HandleTypeDef hltdc;
 SDRAM_HandleTypeDef hsdram1;
 RNG_HandleTypeDef hrng;
 
-static int LCD_LAYER_FRONT; // active display layer (front buffer)
-static int LCD_LAYER_BACK;
+static int g_back; // framebuffer drawn into, the other one is shown
 static uint32_t* g_fb[2];
+static hud_layer_t g_overlay; // LTDC layer 1, a strip at the top of the screen
+static hud_minimap_t g_minimap;
+static hud_font_t g_font;
+static hud_text_t g_frameText;
+#ifdef PERF_HUD
+static hud_perf_t g_perf; /* frame time graph and render statistics below the frame time */
+#endif
+static uint8_t* g_sdramFree; // SDRAM behind the framebuffers, used for assets
 static bool g_gyroReady;
+static gyro_t g_gyro; // filled and integrated by the SPI DMA interrupt of the L3GD20 samples
+static uint8_t g_gyroTx[7] = { L3GD20_OUT_X_L_ADDR | READWRITE_CMD | MULTIPLEBYTE_CMD }; // then dummy bytes
+static uint8_t g_gyroRx[7]; // a byte during the command, then the sample
+static bool g_touchReady;
+static volatile bool g_touchPending; // set by the STMPE811 interrupt
 
 static gamestate_t g_game;
 
@@ -53,6 +86,14 @@ static gamestate_t g_game;
 void SystemClock_Config(void);
 // static void MX_DMA_Init(void);
 static void MX_USART1_UART_Init(void);
+static void dma2d_blend(uint32_t* dst, int stride, const uint32_t* src, int count);
+static void dma2d_blit_a8(uint32_t* dst, int stride, const uint8_t* src, int width, int height, uint32_t color);
+static void touch_read(void);
+static void gyro_start(void);
+static void gyro_read(void);
+#ifdef PERF_HUD
+static uint32_t cpu_cycles(void);
+#endif
 
 void defaultTask(void);
 void doomTask(void);
@@ -61,53 +102,82 @@ void clearFrameBuffer(void);
 
 /* Private user code ---------------------------------------------------------*/
 
-// Generated by https://lvgl.io/tools/imageconverter
-// CF_RAW
-#include "texture_wood1.h"
-#include "texture_stone2.h"
-bool load_texture_wood(texture_t* texture)
-{
-    texture->bytesperpixel = 3;
-    texture->width = 128;
-    texture->height = 128;
-    texture->rowlength = texture->width * texture->bytesperpixel;
-    texture->pixels = WOOD1_map;
-    return true;
-}
-bool load_texture_stone(texture_t* texture)
+/* Simple bump allocator for asset data in SDRAM, nothing is ever freed */
+static void* sdram_alloc(size_t size)
 {
-    texture->bytesperpixel = 3;
-    texture->width = 128;
-    texture->height = 128;
-    texture->rowlength = texture->width * texture->bytesperpixel;
-    texture->pixels = STONE2_map;
-    return true;
+    uint8_t* p = g_sdramFree;
+    g_sdramFree += (size + 31) & ~31u; // keep allocations cache line aligned
+    if (g_sdramFree > (uint8_t*)(SDRAM_DEVICE_ADDR + SDRAM_DEVICE_SIZE))
+    {
+        Error_Handler();
+    }
+    return p;
 }
 
 static void game_init(void)
 {
-    g_game.player_dir.e = 0.0f;
-    g_game.player_dir.n = 1.0f;
+    if (!lvl_load(&g_game.level, GAME_LEVEL, sizeof(GAME_LEVEL)))
+    {
+        Error_Handler();
+    }
+    const level_header_t* level = g_game.level.header;
+
+    g_game.player_dir.e = level->spawn_dir_e;
+    g_game.player_dir.n = level->spawn_dir_n;
+
+    g_game.player_pos.n = level->spawn_n;
+    g_game.player_pos.e = level->spawn_e;
 
-    g_game.player_pos.n = 2.0f;
+    lvl_stream(&g_game.level, g_game.player_pos.e, g_game.player_pos.n);
+
+#ifdef SECTOR_DEMO
+    if (!sec_check(&m_plaza))
+    {
+        Error_Handler();
+    }
+    g_game.sectors = &m_plaza;
     g_game.player_pos.e = 2.0f;
+    g_game.player_pos.n = 3.0f;
+    g_game.player_dir.e = 1.0f;
+    g_game.player_dir.n = 0.0f;
+    g_game.sector = sec_find(&m_plaza, g_game.player_pos.e, g_game.player_pos.n);
+#endif
 
-    g_game.level = m_e1m1_mapdata;
-    g_game.level_width = 16;
-    g_game.level_height = 8;
+    g_game.sprite_count = r_min(g_game.level.sprite_count, MAX_ENTITIES);
+    for (int i = 0; i < g_game.sprite_count; i++)
+    {
+        const level_sprite_t* s = &g_game.level.sprites[i];
+        g_game.sprites[i].pos.e = s->e;
+        g_game.sprites[i].pos.n = s->n;
+        g_game.sprites[i].texture = (uint16_t)s->texture;
+    }
 
+    asset_pack_t pack;
     texture_t* textures = r_texture_dict();
+    texture_t* sprites = r_sprite_dict();
+    texture_t wood, stone;
 
-    load_texture_wood(&textures[1]);
-    load_texture_wood(&textures[2]);
-    load_texture_stone(&textures[3]);
-    load_texture_stone(&textures[4]);
-    load_texture_wood(&textures[5]);
-    load_texture_stone(&textures[6]);
-    load_texture_stone(&textures[7]);
+    if (!asset_open(&pack, m_textures, sizeof(m_textures)))
+    {
+        Error_Handler();
+    }
+    /* a compressed atlas is inflated into SDRAM */
+    const uint32_t atlas_size = asset_atlas_size(&pack);
+    if (!asset_atlas(&pack, r_atlas(), atlas_size ? sdram_alloc(atlas_size) : NULL) ||
+        !asset_texture(&pack, asset_find(&pack, "wood1"), &wood) ||
+        !asset_texture(&pack, asset_find(&pack, "stone2"), &stone) ||
+        !asset_texture(&pack, asset_find(&pack, "ball"), &sprites[0]))
+    {
+        Error_Handler();
+    }
 
-    // texture_t* sprites = r_sprite_dict();
-    // load_texture(&sprites[0], "sprites/ball.bmp");
+    textures[1] = wood;
+    textures[2] = wood;
+    textures[3] = stone;
+    textures[4] = stone;
+    textures[5] = wood;
+    textures[6] = stone;
+    textures[7] = stone;
 }
 
 int main(void)
@@ -136,33 +206,68 @@ int main(void)
     BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_EXTI);
 
     BSP_LCD_Init();
-    LCD_LAYER_FRONT = 1;
-    LCD_LAYER_BACK = 0;
+    g_back = 1;
     g_fb[0] = (uint32_t*)LCD_FRAME_BUFFER;
     g_fb[1] = (uint32_t*)(LCD_FRAME_BUFFER + WIDTH * HEIGHT * BPP);
+    g_sdramFree = (uint8_t*)(LCD_FRAME_BUFFER + 2 * WIDTH * HEIGHT * BPP);
+    /* HUD font: glyphs expanded to A8 once */
+    hud_fontinit(&g_font, sdram_alloc(hud_fontsize(Font12.Width, Font12.Height)),
+                 Font12.table, Font12.Width, Font12.Height);
+    /* Layer 0 shows the 3D view, double buffered by flipping its address.
+     * Layer 1 is a window with the HUD (text, minimap), blended over it by
+     * the LTDC. */
+#ifdef PERF_HUD
+    const int overlayHeight = r_max(HUD_MAP_SIZE, g_font.height + 2 + hud_perfheight(&g_font)) + 8;
+#else
+    const int overlayHeight = HUD_MAP_SIZE + 8;
+#endif
+    hud_layerinit(&g_overlay, sdram_alloc(WIDTH * overlayHeight * BPP), 0, 0, WIDTH, overlayHeight);
+    hud_mapinit(&g_minimap, &g_overlay, WIDTH - HUD_MAP_SIZE - 4, 4);
     BSP_LCD_LayerDefaultInit(0, (uint32_t)g_fb[0]);
-    BSP_LCD_LayerDefaultInit(1, (uint32_t)g_fb[1]);
-    BSP_LCD_SetLayerVisible(0, DISABLE);
+    BSP_LCD_LayerDefaultInit(1, (uint32_t)g_overlay.pixels);
+    BSP_LCD_SetLayerWindow(1, (uint16_t)g_overlay.x, (uint16_t)g_overlay.y,
+                           (uint16_t)g_overlay.width, (uint16_t)g_overlay.height);
+    BSP_LCD_SetLayerVisible(0, ENABLE);
     BSP_LCD_SetLayerVisible(1, ENABLE);
-    BSP_LCD_SelectLayer(LCD_LAYER_BACK);
+    BSP_LCD_SelectLayer(0);
+
+    /* Touchscreen: the STMPE811 raises an interrupt when the screen is
+     * touched, while a finger moves and when it is lifted */
+    if (BSP_TS_Init(WIDTH, HEIGHT) == TS_OK && BSP_TS_ITConfig() == TS_OK)
+    {
+        g_touchReady = true;
+    }
 
     /* ChromART (DMA2D) setup */
     hdma2d.Init.Mode         = DMA2D_M2M; // convert 8bit palette colors to 32bit ARGB888
     hdma2d.Init.ColorMode    = DMA2D_ARGB8888; // destination color format
     hdma2d.Init.OutputOffset = 0;
     hdma2d.Instance = DMA2D;
-    hdma2d.LayerCfg[LCD_LAYER_FRONT].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-    hdma2d.LayerCfg[LCD_LAYER_FRONT].InputAlpha = 0xFF; // N/A only for A8 or A4
-    hdma2d.LayerCfg[LCD_LAYER_FRONT].InputColorMode = DMA2D_INPUT_ARGB8888; // source format
-    hdma2d.LayerCfg[LCD_LAYER_FRONT].InputOffset = 0;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha = 0xFF; // N/A only for A8 or A4
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode = DMA2D_INPUT_ARGB8888; // source format
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = 0;
     HAL_DMA2D_Init(&hdma2d);
-    HAL_DMA2D_ConfigLayer(&hdma2d, LCD_LAYER_FRONT);
+    HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_FOREGROUND_LAYER);
+    r_setblend(dma2d_blend); // see-through walls
+
+    /* HUD text: glyphs blended by the DMA2D */
+    hud_textinit(&g_frameText, &g_overlay, &g_font, 4, 4, 0xffffff, 0x80000000);
+    hud_setblit(dma2d_blit_a8);
 
     /* Enable CPU cycle counter */
     CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
     DWT->CYCCNT = 0;
     DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
     // access the cycle counter at: DWT->CYCCNT
+#ifdef PERF_HUD
+    r_setclock(cpu_cycles);
+#endif
+
+    if (g_gyroReady)
+    {
+        gyro_start(); // after the display setup, which uses the same SPI bus
+    }
 
     /* Run Main task */
     game_init();
@@ -171,17 +276,205 @@ int main(void)
     while (1) {} /* should never end up here */
 }
 
+/* Show the back buffer: layer 0 reads from it from the next vertical
+ * blanking on, layer 1 (minimap) is not touched. Returns once the LTDC
+ * has switched, so the old front buffer can be drawn into. */
 void screen_flip_buffers(void)
 {
-  // wait for VSYNC
-    while (!(LTDC->CDSR & LTDC_CDSR_VSYNCS));
-    BSP_LCD_SetLayerVisible(LCD_LAYER_FRONT, DISABLE);
-    LCD_LAYER_BACK = LCD_LAYER_FRONT;
-    LCD_LAYER_FRONT ^= 1;
-    BSP_LCD_SetLayerVisible(LCD_LAYER_FRONT, ENABLE);
-    BSP_LCD_SelectLayer(LCD_LAYER_BACK);
+    BSP_LCD_SetLayerAddress_NoReload(0, (uint32_t)g_fb[g_back]);
+    LTDC->SRCR = LTDC_SRCR_VBR;
+    while (LTDC->SRCR & LTDC_SRCR_VBR) {} // cleared by the reload
+    g_back ^= 1;
+}
+/* Blend a column of see-through wall texels over the framebuffer with the
+ * DMA2D (r_blend_t). The transfer runs while the engine draws the next
+ * column, the next call waits for it. Registers are written directly, the
+ * HAL setup costs more than blending a short column. */
+static void dma2d_blend(uint32_t* dst, int stride, const uint32_t* src, int count)
+{
+    while (DMA2D->CR & DMA2D_CR_START) {} // previous blend
+    if (count == 0)
+    {
+        return;
+    }
+    DMA2D->CR = DMA2D_M2M_BLEND;
+    DMA2D->FGPFCCR = DMA2D_INPUT_ARGB8888; // per pixel alpha of the texels
+    DMA2D->BGPFCCR = DMA2D_INPUT_ARGB8888;
+    DMA2D->OPFCCR = DMA2D_OUTPUT_ARGB8888;
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->FGOR = 0;
+    DMA2D->BGMAR = (uint32_t)dst;
+    DMA2D->BGOR = (uint32_t)(stride - 1);
+    DMA2D->OMAR = (uint32_t)dst;
+    DMA2D->OOR = (uint32_t)(stride - 1);
+    DMA2D->NLR = (1u << DMA2D_NLR_PL_Pos) | (uint32_t)count; // one pixel wide, count lines
+    DMA2D->CR |= DMA2D_CR_START;
+}
+
+/* Blend an A8 glyph in color over the HUD layer with the DMA2D
+ * (hud_blit_t). Like dma2d_blend the transfer runs in the background, the
+ * next call waits for it. */
+static void dma2d_blit_a8(uint32_t* dst, int stride, const uint8_t* src, int width, int height, uint32_t color)
+{
+    while (DMA2D->CR & DMA2D_CR_START) {} // previous blit
+    if (height == 0)
+    {
+        return;
+    }
+    DMA2D->CR = DMA2D_M2M_BLEND;
+    DMA2D->FGPFCCR = DMA2D_INPUT_A8; // alpha from the glyph, color from FGCOLR
+    DMA2D->FGCOLR = color & 0xffffff;
+    DMA2D->BGPFCCR = DMA2D_INPUT_ARGB8888;
+    DMA2D->OPFCCR = DMA2D_OUTPUT_ARGB8888;
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->FGOR = 0;
+    DMA2D->BGMAR = (uint32_t)dst;
+    DMA2D->BGOR = (uint32_t)(stride - width);
+    DMA2D->OMAR = (uint32_t)dst;
+    DMA2D->OOR = (uint32_t)(stride - width);
+    DMA2D->NLR = ((uint32_t)width << DMA2D_NLR_PL_Pos) | (uint32_t)height;
+    DMA2D->CR |= DMA2D_CR_START;
+}
+
+#ifdef PERF_HUD
+/* CPU cycle counter as clock of the render statistics (r_clock_t) */
+static uint32_t cpu_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
+/* EXTI callback of the HAL: the STMPE811 has a touch event */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    if (GPIO_Pin == STMPE811_INT_PIN)
+    {
+        g_touchPending = true;
+    }
+    else if (GPIO_Pin == GYRO_INT2_PIN)
+    {
+        gyro_read();
+    }
+}
+
+/* Let the L3GD20 raise its data ready interrupt (INT2) for every sample,
+ * which is then read by SPI DMA (SPI5_RX on DMA2 stream 3, SPI5_TX on
+ * stream 4, channel 2).
+ * The high-pass filter of BSP_GYRO_Init is turned off: it would also take
+ * away slow turns, gyro_update removes the bias itself. */
+static void gyro_start(void)
+{
+    GPIO_InitTypeDef gpio = { 0 };
+    uint8_t raw[6];
+
+    gyro_init(&g_gyro, GYRO_RATE_HZ, L3GD20_SENSITIVITY_500DPS / 1000.0f);
+    L3GD20_FilterCmd(L3GD20_HIGHPASSFILTER_DISABLE);
+    BSP_GYRO_EnableIT(L3GD20_INT2);
+
+    /* same settings as the BSP, which keeps its handle to itself */
+    hspi5.Instance = SPI5;
+    hspi5.Init.Mode = SPI_MODE_MASTER;
+    hspi5.Init.Direction = SPI_DIRECTION_2LINES;
+    hspi5.Init.DataSize = SPI_DATASIZE_8BIT;
+    hspi5.Init.CLKPolarity = SPI_POLARITY_LOW;
+    hspi5.Init.CLKPhase = SPI_PHASE_1EDGE;
+    hspi5.Init.NSS = SPI_NSS_SOFT;
+    hspi5.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_16;
+    hspi5.Init.FirstBit = SPI_FIRSTBIT_MSB;
+    hspi5.Init.TIMode = SPI_TIMODE_DISABLE;
+    hspi5.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+    hspi5.Init.CRCPolynomial = 7;
+    HAL_SPI_Init(&hspi5);
+
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    hdma_spi5_rx.Instance = DMA2_Stream3;
+    hdma_spi5_rx.Init.Channel = DMA_CHANNEL_2;
+    hdma_spi5_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_spi5_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_spi5_rx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_spi5_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_spi5_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_spi5_rx.Init.Mode = DMA_NORMAL;
+    hdma_spi5_rx.Init.Priority = DMA_PRIORITY_HIGH;
+    hdma_spi5_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&hdma_spi5_rx);
+    __HAL_LINKDMA(&hspi5, hdmarx, hdma_spi5_rx);
+    hdma_spi5_tx.Instance = DMA2_Stream4;
+    hdma_spi5_tx.Init = hdma_spi5_rx.Init;
+    hdma_spi5_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    HAL_DMA_Init(&hdma_spi5_tx);
+    __HAL_LINKDMA(&hspi5, hdmatx, hdma_spi5_tx);
+    HAL_NVIC_SetPriority(DMA2_Stream3_IRQn, 0x0F, 0x00);
+    HAL_NVIC_EnableIRQ(DMA2_Stream3_IRQn);
+    HAL_NVIC_SetPriority(DMA2_Stream4_IRQn, 0x0F, 0x00);
+    HAL_NVIC_EnableIRQ(DMA2_Stream4_IRQn);
+
+    gpio.Pin = GYRO_INT2_PIN;
+    gpio.Mode = GPIO_MODE_IT_RISING;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FAST;
+    HAL_GPIO_Init(GYRO_INT_GPIO_PORT, &gpio);
+    GYRO_IO_Read(raw, L3GD20_OUT_X_L_ADDR, sizeof(raw)); // data ready goes low, the next sample raises it
+    HAL_NVIC_SetPriority(GYRO_INT2_EXTI_IRQn, 0x0F, 0x00);
+    HAL_NVIC_EnableIRQ(GYRO_INT2_EXTI_IRQn);
+}
+
+/* Data ready interrupt of the L3GD20: start the SPI DMA read of the sample
+ * (7 bytes), the interrupted code does not wait for the transfer */
+static void gyro_read(void)
+{
+    if (HAL_SPI_GetState(&hspi5) != HAL_SPI_STATE_READY)
+        return; // still reading the last sample, the next one is read after it
+    GYRO_CS_LOW();
+    if (HAL_SPI_TransmitReceive_DMA(&hspi5, g_gyroTx, g_gyroRx, sizeof(g_gyroRx)) != HAL_OK)
+    {
+        GYRO_CS_HIGH();
+    }
+}
+
+/* SPI DMA of a gyroscope sample is complete: push it into the ring of
+ * g_gyro and integrate it, the game loop only reads the yaw */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* hspi)
+{
+    if (hspi != &hspi5)
+        return;
+    GYRO_CS_HIGH();
+    const uint8_t* raw = &g_gyroRx[1]; // little endian, see BSP_GYRO_Init
+    const gyro_sample_t sample = {
+        .x = (int16_t)(raw[0] | raw[1] << 8),
+        .y = (int16_t)(raw[2] | raw[3] << 8),
+        .z = (int16_t)(raw[4] | raw[5] << 8),
+    };
+    gyro_push(&g_gyro, &sample);
+    gyro_update(&g_gyro);
+    if (HAL_GPIO_ReadPin(GYRO_INT_GPIO_PORT, GYRO_INT2_PIN) == GPIO_PIN_SET)
+    {
+        gyro_read(); // the next sample came during the transfer, there is no new edge for it
+    }
+}
+
+/* SPI DMA of a gyroscope sample failed: the sample is lost */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi)
+{
+    if (hspi == &hspi5)
+    {
+        GYRO_CS_HIGH();
+    }
+}
 
+/* Read the touchscreen after an interrupt of the STMPE811 and report it to
+ * the input layer. The I2C transfers only happen while the screen is
+ * touched, not every frame. The interrupt is cleared before reading, so a
+ * touch event during the read raises a new one. */
+static void touch_read(void)
+{
+    TS_StateTypeDef state = { 0 };
+    g_touchPending = false;
+    BSP_TS_ITClear();
+    BSP_TS_GetState(&state);
+    in_touch(state.TouchDetected != 0, state.X, state.Y);
 }
+
 /* Using the Systick 1000 Hz millisecond timer to sleep */
 static void sleep(uint32_t delayMs)
 {
@@ -198,39 +491,59 @@ void doomTask(void)
     float dt_sec = 0.0f;
     int frameTimeMs = 0; // current frametime in ms
     uint8_t uartAsciiOutput[128]; // debug ASCII output buffer for UART sending
+    char frameText[HUD_TEXT_LENGTH + 1]; // frametime shown on the HUD
     const int setpointframeTimeMs = 33;
-    float rates[3] = {0,0,0};
     bool gyroMode = false;
+    float gyroYaw = 0.0f; // gyro_yaw of the last frame
+#ifdef PERF_HUD
+    hud_perfinit(&g_perf, &g_overlay, &g_font, 4, 4 + g_font.height + 2, SystemCoreClock / 1000, setpointframeTimeMs);
+#endif
 
     r_render(g_fb[0], &g_game);
+    r_invalidate();
     r_render(g_fb[1], &g_game);
 
     for(uint32_t epoch=0;;epoch++)
     {
         uint32_t tickStart = HAL_GetTick();
 
+        const bool button = (BSP_PB_GetState(BUTTON_KEY) != RESET);
+        float yaw = 0.0f; // turn of the board since the last frame
         if (g_gyroReady)
         {
-            BSP_GYRO_GetXYZ(rates);
-            for (int i=0;i<3;i++)
-            {
-                rates[i]*=(1/(1024.0f));
-            }
+            const float now = gyro_yaw(&g_gyro); // integrated by the SPI DMA interrupt
+            yaw = remainderf(now - gyroYaw, 2.0f * M_PI_F);
+            gyroYaw = now;
+        }
+        if (g_gyroReady && button)
+        {
+            gyroMode = true; // from now on the board steers and the user button walks
         }
 
-        kb[SDL_SCANCODE_A] = 1;
-        // if (BSP_PB_GetState(BUTTON_KEY) != RESET) { gyroMode = true; }
+        memset(kb, 0, sizeof(kb));
+        kb[SDL_SCANCODE_A] = !gyroMode; // turn around until the screen is touched
+        if (g_touchReady && g_touchPending)
+        {
+            touch_read();
+        }
+        in_keys(kb);
         if (gyroMode)
         {
-            kb[SDL_SCANCODE_W] = (BSP_PB_GetState(BUTTON_KEY) != RESET);
-            kb[SDL_SCANCODE_A] = rates[1] >  2.5f;
-            kb[SDL_SCANCODE_D] = rates[1] < -2.5f;
+            kb[SDL_SCANCODE_W] |= button;
+            g_turn(&g_game, yaw);
         }
 
         g_update(dt_sec, kb, &g_game);
-        r_render(g_fb[LCD_LAYER_BACK], &g_game);
-
-        screen_flip_buffers();
+        if (r_render(g_fb[g_back], &g_game))
+        {
+            screen_flip_buffers(); // otherwise keep presenting the last frame
+        }
+        hud_map(&g_minimap, &g_game); // shown by the LTDC without a flip
+        snprintf(frameText, sizeof(frameText), "%i ms", frameTimeMs); // of the last frame
+        hud_text(&g_frameText, frameText); // only drawn if it changed
+#ifdef PERF_HUD
+        hud_perf(&g_perf, (float)frameTimeMs, r_stats());
+#endif
 
         frameTimeMs = (int)(HAL_GetTick() - tickStart);
         const int timeleftMs = setpointframeTimeMs - frameTimeMs;
@@ -61,6 +61,8 @@ extern HCD_HandleTypeDef hhcd_USB_OTG_HS;
 extern TIM_HandleTypeDef htim6;
 extern DMA_HandleTypeDef hdma_usart1_tx;
 extern UART_HandleTypeDef huart1;
+extern DMA_HandleTypeDef hdma_spi5_rx;
+extern DMA_HandleTypeDef hdma_spi5_tx;
 
 /* USER CODE BEGIN EV */
 
@@ -230,6 +232,50 @@ void EXTI0_IRQHandler(void)
     HAL_GPIO_EXTI_IRQHandler(KEY_BUTTON_PIN);
 }
 
+/**
+  * @brief  This function handles External line 2 interrupt request
+  *         (L3GD20 gyroscope data ready).
+  * @param  None
+  * @retval None
+  */
+void EXTI2_IRQHandler(void)
+{
+    HAL_GPIO_EXTI_IRQHandler(GYRO_INT2_PIN);
+}
+
+/**
+  * @brief  This function handles DMA2 stream 3 global interrupt
+  *         (SPI5 RX, L3GD20 gyroscope samples).
+  * @param  None
+  * @retval None
+  */
+void DMA2_Stream3_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hdma_spi5_rx);
+}
+
+/**
+  * @brief  This function handles DMA2 stream 4 global interrupt
+  *         (SPI5 TX, L3GD20 gyroscope samples).
+  * @param  None
+  * @retval None
+  */
+void DMA2_Stream4_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hdma_spi5_tx);
+}
+
+/**
+  * @brief  This function handles External lines 10 to 15 interrupt request
+  *         (STMPE811 touchscreen controller).
+  * @param  None
+  * @retval None
+  */
+void EXTI15_10_IRQHandler(void)
+{
+    HAL_GPIO_EXTI_IRQHandler(STMPE811_INT_PIN);
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
@@ -1,3794 +0,0 @@
-static uint8_t STONE2_map[] = {
-    0x42, 0x4d, 0x8a, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00,
-    0x00, 0x7c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x42, 0x47, 0x52, 0x73, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x23, 0x23,
-    0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x23, 0x23, 0x23, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x63, 0x63,
-    0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63,
-    0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x6b, 0x6b, 0x6b, 0x4f, 0x4f, 0x4f, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x4f, 0x4f, 0x4f, 0x63, 0x63,
-    0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57,
-    0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57,
-    0x57, 0x57, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47,
-    0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x63,
-    0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x57, 0x57,
-    0x57, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6f, 0x6f, 0x6f,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f,
-    0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47,
-    0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63,
-    0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b,
-    0x47, 0x47, 0x47, 0x5b, 0x5b, 0x5b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b,
-    0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x57, 0x57, 0x57, 0x4f, 0x4f,
-    0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x47, 0x47,
-    0x47, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x57, 0x57,
-    0x57, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x6b, 0x6b, 0x6b, 0x5b, 0x5b, 0x5b,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x7f, 0x7f, 0x7f, 0x77, 0x77, 0x77, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x4f, 0x4f,
-    0x4f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47,
-    0x47, 0x47, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x5b, 0x5b, 0x5b, 0x57,
-    0x57, 0x57, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63, 0x63,
-    0x63, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63,
-    0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x43,
-    0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b,
-    0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37,
-    0x37, 0x37, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f,
-    0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63,
-    0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b,
-    0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x57, 0x57,
-    0x57, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57,
-    0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57,
-    0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f,
-    0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x47, 0x47,
-    0x47, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x57, 0x57,
-    0x57, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f,
-    0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x57,
-    0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0f, 0x33, 0x17, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x47,
-    0x47, 0x47, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x4f,
-    0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63,
-    0x63, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f,
-    0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f,
-    0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57,
-    0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47,
-    0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47,
-    0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x4f, 0x4f, 0x4f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x63,
-    0x63, 0x63, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x4f,
-    0x4f, 0x4f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x63, 0x63, 0x63, 0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b,
-    0x3b, 0x4f, 0x4f, 0x4f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x3b,
-    0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x4f, 0x4f, 0x4f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x47,
-    0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b,
-    0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47,
-    0x47, 0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x3b,
-    0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x4f, 0x4f, 0x4f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f,
-    0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b,
-    0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x13, 0x13, 0x13, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x13, 0x13, 0x13, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23,
-    0x23, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47,
-    0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47,
-    0x47, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x6b, 0x6b, 0x6b, 0x4f,
-    0x4f, 0x4f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x4f, 0x4f,
-    0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x63, 0x63, 0x63, 0x5b, 0x5b,
-    0x5b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x57, 0x57, 0x57, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x4f, 0x4f, 0x4f, 0x47,
-    0x47, 0x47, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63,
-    0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57, 0x6b, 0x6b, 0x6b,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63,
-    0x63, 0x63, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47,
-    0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x57, 0x57, 0x57, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x77,
-    0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x57, 0x57, 0x57,
-    0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63,
-    0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77,
-    0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57,
-    0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x63, 0x63, 0x63,
-    0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x5b, 0x5b, 0x5b, 0x6b, 0x6b, 0x6b, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x57, 0x57,
-    0x57, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47,
-    0x4f, 0x4f, 0x4f, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b, 0x6b, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x4f, 0x4f,
-    0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x47, 0x47, 0x47,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x63, 0x63,
-    0x63, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x6b, 0x6b, 0x6b,
-    0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x7f, 0x7f, 0x7f, 0x77, 0x77,
-    0x77, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-    0x6f, 0x6f, 0x6f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x47, 0x47,
-    0x47, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b,
-    0x6b, 0x6b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x57, 0x57, 0x57,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x47, 0x47,
-    0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x5b,
-    0x5b, 0x5b, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x5b, 0x5b,
-    0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x6b,
-    0x6b, 0x6b, 0x63, 0x63, 0x63, 0x6b, 0x6b, 0x6b, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x47,
-    0x47, 0x47, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b,
-    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63,
-    0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x5b,
-    0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x6b, 0x6b, 0x6b, 0x6f, 0x6f, 0x6f,
-    0x6b, 0x6b, 0x6b, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f,
-    0x4f, 0x57, 0x57, 0x57, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f,
-    0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x57, 0x57, 0x57, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43,
-    0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63,
-    0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37,
-    0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f,
-    0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b,
-    0x3b, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x5b, 0x5b,
-    0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x5b, 0x5b, 0x5b, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0f, 0x33, 0x17,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57,
-    0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47,
-    0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x47, 0x47,
-    0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47,
-    0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x63, 0x63, 0x63, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47,
-    0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x57, 0x57, 0x57, 0x3b, 0x3b, 0x3b, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b,
-    0x5b, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x57, 0x57, 0x57, 0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x4f,
-    0x4f, 0x4f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b,
-    0x5b, 0x5b, 0x63, 0x63, 0x63, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x5b, 0x5b,
-    0x5b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x4f, 0x4f, 0x4f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x57, 0x57, 0x57, 0x63, 0x63, 0x63, 0x5b,
-    0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x57, 0x57, 0x57, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f,
-    0x4f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-    0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x47,
-    0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x63, 0x63,
-    0x63, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x63, 0x63, 0x63,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x57, 0x57, 0x57, 0x63,
-    0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
-    0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63,
-    0x5b, 0x5b, 0x5b, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x13, 0x13, 0x13,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x13, 0x13, 0x13, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x4f,
-    0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x4f, 0x4f, 0x4f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23,
-    0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b,
-    0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f,
-    0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23,
-    0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b,
-    0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23,
-    0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x2f, 0x2f, 0x2f, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f,
-    0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f,
-    0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x4f, 0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b,
-    0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4f,
-    0x4f, 0x4f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x2f, 0x2f, 0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23,
-    0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37,
-    0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b,
-    0x3b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x37,
-    0x37, 0x37, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f, 0x2f,
-    0x2f, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x2f, 0x2f, 0x2f,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37, 0x2f,
-    0x2f, 0x2f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x2f, 0x2f, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x37, 0x37, 0x37,
-    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0x2f, 0x2f, 0x3b, 0x3b, 0x3b, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x23, 0x23, 0x23, 0x37, 0x37, 0x37, 0x43,
-    0x43, 0x43, 0x37, 0x37, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
-    0x3b, 0x3b, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x3b, 0x3b, 0x3b
-};
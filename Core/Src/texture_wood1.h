@@ -1,3789 +0,0 @@
-
-static uint8_t WOOD1_map[] = {
-    0x42, 0x4d, 0x38, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc0, 0x00, 0x00, 0x12,
-    0x0b, 0x00, 0x00, 0x12, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b,
-    0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0f,
-    0x23, 0x2b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x13, 0x13, 0x13, 0x1b, 0x1b,
-    0x1b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0b, 0x17, 0x1f, 0x13, 0x2b, 0x33,
-    0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x13, 0x2b, 0x33, 0x0f,
-    0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x1b, 0x1b, 0x0b, 0x17, 0x1f, 0x0f, 0x23,
-    0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b,
-    0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x1b, 0x1b, 0x1b, 0x0f,
-    0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b,
-    0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33,
-    0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b,
-    0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b,
-    0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b,
-    0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33,
-    0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x1b, 0x1b, 0x0b, 0x17, 0x1f, 0x0f,
-    0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x0f, 0x23,
-    0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x2f, 0x2f, 0x2f,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x3f, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x3f, 0x27, 0x3f, 0x37, 0x23, 0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x2f, 0x2f, 0x2f,
-    0x27, 0x3f, 0x37, 0x2f, 0x2f, 0x2f, 0x27, 0x3f, 0x37, 0x23, 0x3b, 0x4f, 0x23,
-    0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x27, 0x3f, 0x37, 0x2b, 0x47, 0x3f, 0x1b, 0x33,
-    0x43, 0x23, 0x3b, 0x4f, 0x2b, 0x47, 0x3f, 0x27, 0x3f, 0x37, 0x27, 0x3f, 0x37,
-    0x27, 0x3f, 0x37, 0x27, 0x3f, 0x37, 0x23, 0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x27,
-    0x3f, 0x37, 0x2b, 0x47, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x27, 0x3f, 0x37, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x27, 0x27, 0x27, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x0f,
-    0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x37, 0x37, 0x37, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x2b, 0x4f, 0x77, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f,
-    0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x37, 0x37, 0x37, 0x0f, 0x23,
-    0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27,
-    0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b,
-    0x2b, 0x4f, 0x77, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x4f, 0x63, 0x7b, 0x3f,
-    0x53, 0x67, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x37, 0x4b, 0x5f, 0x3f, 0x53,
-    0x67, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x3f, 0x53, 0x67,
-    0x3f, 0x53, 0x67, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3b, 0x3b, 0x3b, 0x47,
-    0x47, 0x47, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x57, 0x57,
-    0x57, 0x4f, 0x4f, 0x4f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x57, 0x73, 0x6f,
-    0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3f,
-    0x53, 0x67, 0x3f, 0x53, 0x67, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x37, 0x4b,
-    0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x3f, 0x53, 0x67,
-    0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x4f, 0x63, 0x7b, 0x4b,
-    0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x57, 0x57, 0x57, 0x4b, 0x5f, 0x77, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x3f, 0x53, 0x67, 0x57,
-    0x6b, 0x83, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x57, 0x57, 0x57, 0x3f, 0x53,
-    0x67, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77,
-    0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x43,
-    0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x57, 0x73,
-    0x6f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x4f, 0x4f, 0x4f, 0x5b, 0x5b, 0x5b, 0x37,
-    0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x3f, 0x53,
-    0x67, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x4f, 0x63, 0x7b,
-    0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x57, 0x57, 0x57, 0x4b, 0x5f, 0x77, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x3f, 0x53, 0x67,
-    0x57, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x57, 0x57, 0x57, 0x3f,
-    0x53, 0x67, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x3f, 0x53, 0x67, 0x4b, 0x5f,
-    0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77,
-    0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x43,
-    0x57, 0x6f, 0x3f, 0x53, 0x67, 0x57, 0x57, 0x57, 0x3f, 0x53, 0x67, 0x4b, 0x5f,
-    0x77, 0x4b, 0x5f, 0x77, 0x4f, 0x63, 0x7b, 0x4f, 0x63, 0x7b, 0x13, 0x2b, 0x33,
-    0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x47, 0x47, 0x47, 0x1b, 0x33,
-    0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x3f, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x0b, 0x17,
-    0x1f, 0x37, 0x5f, 0x8f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b,
-    0x33, 0x43, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0b,
-    0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53,
-    0x33, 0x57, 0x87, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b,
-    0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x0f, 0x23,
-    0x2b, 0x33, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x53, 0x7f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x4b, 0x5f,
-    0x77, 0x4f, 0x63, 0x7b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x27, 0x47,
-    0x6b, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x3b, 0x57, 0x53, 0x0f,
-    0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x17, 0x2f, 0x3f, 0x37,
-    0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x33, 0x57,
-    0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f,
-    0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x53, 0x7f, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x4f, 0x63, 0x7b, 0x57, 0x6b, 0x83,
-    0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x1b,
-    0x1b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x0f,
-    0x23, 0x2b, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x0f, 0x23,
-    0x2b, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b,
-    0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x53, 0x77, 0x8f, 0x4f, 0x63, 0x7b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x2b, 0x47,
-    0x5b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f,
-    0x2f, 0x3f, 0x53, 0x4f, 0x4f, 0x4f, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2b,
-    0x47, 0x5b, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b,
-    0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x33, 0x57, 0x87, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x33, 0x57, 0x87, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x43, 0x57,
-    0x6f, 0x4f, 0x63, 0x7b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x3b, 0x57, 0x53, 0x17, 0x2f,
-    0x3f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33,
-    0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x4b, 0x6b, 0x83, 0x4f,
-    0x63, 0x7b, 0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x17, 0x2f,
-    0x3f, 0x3f, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27,
-    0x47, 0x6b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x3b, 0x57, 0x53,
-    0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x37, 0x5f, 0x8f, 0x2b,
-    0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1b, 0x37,
-    0x4b, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x27,
-    0x47, 0x6b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x3f, 0x5f, 0x77, 0x57, 0x6b,
-    0x83, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x0b,
-    0x17, 0x1f, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x53,
-    0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77,
-    0x1f, 0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x3f, 0x5f, 0x77, 0x33, 0x57, 0x87, 0x4b,
-    0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47,
-    0x6b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x37, 0x4b, 0x5f,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x37, 0x4b, 0x5f,
-    0x4f, 0x4f, 0x4f, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x3b, 0x57, 0x53, 0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b,
-    0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x2b, 0x4f, 0x77, 0x1f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x3f, 0x53,
-    0x67, 0x0b, 0x17, 0x1f, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x3f,
-    0x5f, 0x77, 0x33, 0x57, 0x87, 0x5b, 0x73, 0x8b, 0x0b, 0x17, 0x1f, 0x3f, 0x53,
-    0x67, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x4f, 0x4f, 0x4f, 0x0b,
-    0x17, 0x1f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x27, 0x27,
-    0x27, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x43, 0x57,
-    0x6f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x4f, 0x63, 0x7b, 0x4b, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f,
-    0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x3b, 0x57,
-    0x53, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x37, 0x5f, 0x8f, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57,
-    0x6f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x4b, 0x6b, 0x83, 0x57,
-    0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x0b, 0x17, 0x1f, 0x3b, 0x57, 0x53, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x37, 0x37, 0x37, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x27, 0x27,
-    0x27, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x23, 0x43,
-    0x5f, 0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x57, 0x6b, 0x83,
-    0x3f, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x43, 0x57,
-    0x6f, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x4b, 0x5f,
-    0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x4f, 0x77, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x4b,
-    0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f,
-    0x4f, 0x63, 0x7b, 0x57, 0x6b, 0x83, 0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b, 0x4f,
-    0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1f, 0x3f,
-    0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x0b, 0x17, 0x1f, 0x47, 0x47, 0x47,
-    0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x4b, 0x4b,
-    0x4b, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x33, 0x57,
-    0x87, 0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b,
-    0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x2b, 0x47,
-    0x5b, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x3f,
-    0x53, 0x67, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x4b, 0x6b, 0x83, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x4b,
-    0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x33,
-    0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1f, 0x3f,
-    0x53, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x3f, 0x53,
-    0x67, 0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83,
-    0x5b, 0x73, 0x8b, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23, 0x43,
-    0x5f, 0x1b, 0x1b, 0x1b, 0x47, 0x47, 0x47, 0x27, 0x27, 0x27, 0x37, 0x37, 0x37,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x4f, 0x63, 0x7b, 0x17,
-    0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x43, 0x57,
-    0x6f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83, 0x33, 0x57, 0x87, 0x4f, 0x63,
-    0x7b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x33, 0x57,
-    0x87, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x2b,
-    0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2b, 0x47,
-    0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x2f, 0x2f,
-    0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4f,
-    0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x3f, 0x5f, 0x77, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2b, 0x47,
-    0x5b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47,
-    0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x4b, 0x6b,
-    0x83, 0x33, 0x57, 0x87, 0x4f, 0x63, 0x7b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f,
-    0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x0b, 0x17, 0x1f, 0x4f, 0x4f,
-    0x4f, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53,
-    0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x27, 0x27, 0x27, 0x17,
-    0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x37,
-    0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43,
-    0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x37,
-    0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b,
-    0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x57, 0x57, 0x57, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x17, 0x2f,
-    0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x2b, 0x47,
-    0x5b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x23, 0x23, 0x23, 0x3b, 0x57, 0x53, 0x37, 0x37, 0x37, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x13, 0x2b,
-    0x33, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83, 0x2b,
-    0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x2f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b,
-    0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27,
-    0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x3f, 0x5f, 0x77, 0x1b, 0x37, 0x4b,
-    0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27,
-    0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x33,
-    0x57, 0x87, 0x4b, 0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x57, 0x6b, 0x83, 0x0b, 0x17,
-    0x1f, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x4f,
-    0x4f, 0x4f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x37,
-    0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x2f, 0x2f, 0x2f, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b,
-    0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x17, 0x2f,
-    0x3f, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b,
-    0x4f, 0x77, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0f, 0x23,
-    0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2f, 0x3f,
-    0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x13, 0x2b, 0x33, 0x4f, 0x4f, 0x4f, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f,
-    0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b,
-    0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b,
-    0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x0b, 0x17,
-    0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x23,
-    0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x23, 0x43,
-    0x5f, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67,
-    0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b, 0x0b,
-    0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x3f, 0x53, 0x67, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0b, 0x17, 0x1f, 0x0f,
-    0x23, 0x2b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b,
-    0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x27, 0x47,
-    0x6b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23,
-    0x2b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x2b, 0x4f, 0x77, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f,
-    0x33, 0x53, 0x67, 0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x27,
-    0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1f, 0x3f,
-    0x53, 0x33, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f,
-    0x27, 0x27, 0x27, 0x0b, 0x17, 0x1f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23,
-    0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x4f, 0x4f, 0x4f, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x37,
-    0x37, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x2b, 0x47,
-    0x5b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77,
-    0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x13, 0x2b,
-    0x33, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b,
-    0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x37, 0x37, 0x37, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f, 0x3f,
-    0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x17, 0x2f,
-    0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67,
-    0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43,
-    0x5f, 0x23, 0x43, 0x5f, 0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x4b, 0x5f, 0x77, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x0b, 0x17, 0x1f, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f,
-    0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37, 0x5f, 0x8f, 0x1b,
-    0x37, 0x4b, 0x13, 0x2b, 0x33, 0x23, 0x43, 0x5f, 0x17, 0x2f, 0x3f, 0x37, 0x4b,
-    0x5f, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67,
-    0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x23,
-    0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x57, 0x6b,
-    0x83, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x0f,
-    0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x0b, 0x17, 0x1f, 0x0b, 0x17,
-    0x1f, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77,
-    0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x33,
-    0x57, 0x87, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67,
-    0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x33, 0x43, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x3f, 0x5f,
-    0x77, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x5b, 0x73, 0x8b, 0x0b, 0x17, 0x1f, 0x5b, 0x5b,
-    0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x17,
-    0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0b, 0x17,
-    0x1f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x1b, 0x37, 0x4b, 0x27, 0x27, 0x27, 0x37,
-    0x37, 0x37, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x3f, 0x5f, 0x77,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17,
-    0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x3b, 0x57,
-    0x53, 0x0b, 0x17, 0x1f, 0x57, 0x6b, 0x83, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x27, 0x3f, 0x37, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37, 0x4b,
-    0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x57,
-    0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x33, 0x57, 0x87, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x0b, 0x17, 0x1f, 0x27,
-    0x27, 0x27, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33,
-    0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x33, 0x57,
-    0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x4f, 0x4f, 0x4f, 0x0b, 0x17, 0x1f, 0x4f, 0x63,
-    0x7b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x13, 0x2b, 0x33,
-    0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x4b,
-    0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x37, 0x37, 0x37, 0x1b, 0x33,
-    0x43, 0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x5b, 0x73, 0x8b, 0x0b, 0x17, 0x1f, 0x43,
-    0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2b, 0x4f, 0x77, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x4f, 0x4f, 0x4f,
-    0x0b, 0x17, 0x1f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x27,
-    0x27, 0x27, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x33, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x1b, 0x37,
-    0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x33, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x4f,
-    0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x33, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37,
-    0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x43, 0x57,
-    0x6f, 0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2b,
-    0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x0b, 0x17, 0x1f, 0x47, 0x47, 0x47, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x17,
-    0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33,
-    0x53, 0x67, 0x53, 0x77, 0x8f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x53, 0x77, 0x8f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x07, 0x0f, 0x17, 0x47, 0x47,
-    0x47, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x1b,
-    0x33, 0x43, 0x27, 0x27, 0x27, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f,
-    0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x2b,
-    0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x3f, 0x5f, 0x77, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27,
-    0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x27, 0x47, 0x6b, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f,
-    0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x33,
-    0x53, 0x67, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x17,
-    0x2f, 0x3f, 0x07, 0x0f, 0x17, 0x47, 0x47, 0x47, 0x27, 0x27, 0x27, 0x0b, 0x17,
-    0x1f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x2f, 0x2f, 0x2f, 0x2f,
-    0x3f, 0x53, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x4b, 0x4b, 0x4b, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77,
-    0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x17, 0x2f, 0x3f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b,
-    0x4b, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x33, 0x43, 0x57, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x53, 0x7f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x57, 0x6b, 0x83, 0x0b, 0x17,
-    0x1f, 0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x1b, 0x1b, 0x1b, 0x4f,
-    0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0f, 0x23,
-    0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x0b, 0x17, 0x1f, 0x1b, 0x33, 0x43,
-    0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x2f,
-    0x3f, 0x53, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x0f, 0x23,
-    0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x0f, 0x23, 0x2b,
-    0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x33,
-    0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b,
-    0x33, 0x43, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x37, 0x37, 0x37, 0x17, 0x2f,
-    0x3f, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x3f, 0x5f, 0x77,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x0f, 0x23,
-    0x2b, 0x37, 0x4b, 0x5f, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77,
-    0x3f, 0x53, 0x67, 0x33, 0x43, 0x57, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x57, 0x6b, 0x83, 0x07, 0x0f, 0x17, 0x4f, 0x63, 0x7b, 0x43, 0x57,
-    0x6f, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x1b, 0x1b, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x13, 0x2b,
-    0x33, 0x0b, 0x17, 0x1f, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f,
-    0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x23, 0x43, 0x5f, 0x13, 0x2b, 0x33, 0x1f, 0x3f, 0x53, 0x3f, 0x5f,
-    0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x37, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x37,
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x0f, 0x23,
-    0x2b, 0x3f, 0x5f, 0x77, 0x33, 0x57, 0x87, 0x2b, 0x4f, 0x77, 0x27, 0x47, 0x6b,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x1b,
-    0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x1b, 0x33,
-    0x43, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x13, 0x2b,
-    0x33, 0x1f, 0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x4f, 0x63, 0x7b, 0x0b,
-    0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x07, 0x0f, 0x17,
-    0x3b, 0x57, 0x53, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x13, 0x2b,
-    0x33, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x27, 0x27,
-    0x27, 0x4b, 0x4b, 0x4b, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f,
-    0x23, 0x2b, 0x33, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x4b, 0x5f, 0x77, 0x0f, 0x23,
-    0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x3f, 0x27, 0x27, 0x27, 0x2f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x3f, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x3b, 0x57, 0x53, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x33, 0x57,
-    0x87, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23,
-    0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x33, 0x43, 0x57, 0x43, 0x57,
-    0x6f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x17, 0x2f, 0x3f, 0x07, 0x0f, 0x17, 0x3b, 0x57, 0x53, 0x1b, 0x33, 0x43,
-    0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b,
-    0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x0f, 0x23,
-    0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x23, 0x3b, 0x4f, 0x33, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b,
-    0x4f, 0x77, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x37, 0x37, 0x37, 0x27, 0x27,
-    0x27, 0x43, 0x43, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x4f, 0x4f, 0x4f, 0x0f,
-    0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b,
-    0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f,
-    0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f, 0x1b,
-    0x33, 0x43, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77,
-    0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x07, 0x0f,
-    0x17, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x13, 0x2b, 0x33, 0x1f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x0f, 0x23,
-    0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f, 0x17,
-    0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x37,
-    0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33,
-    0x1b, 0x33, 0x43, 0x47, 0x47, 0x47, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83, 0x2b,
-    0x4f, 0x77, 0x2f, 0x53, 0x7f, 0x37, 0x5f, 0x8f, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x23, 0x3b, 0x4f, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f,
-    0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x27, 0x27, 0x27, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x23, 0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f,
-    0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x0f,
-    0x23, 0x2b, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x1b, 0x33,
-    0x43, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x23, 0x3b, 0x4f, 0x23, 0x43, 0x5f, 0x3f, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x23, 0x3b, 0x4f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x3b, 0x4f,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1f, 0x3f,
-    0x53, 0x27, 0x3f, 0x37, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x4f, 0x4f, 0x4f,
-    0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x33, 0x57, 0x87, 0x37, 0x5f, 0x8f, 0x27,
-    0x47, 0x6b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43,
-    0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x23, 0x3b, 0x4f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x1b, 0x1b, 0x43, 0x57, 0x6f,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f,
-    0x33, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x4f, 0x63,
-    0x7b, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x1b, 0x1b, 0x4f, 0x4f, 0x4f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x37, 0x37,
-    0x37, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x47, 0x63, 0x5b, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x27, 0x27, 0x27, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f,
-    0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x23,
-    0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x1b, 0x37, 0x4b, 0x33, 0x53,
-    0x67, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x37, 0x37, 0x37, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x4b, 0x5f, 0x77,
-    0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77,
-    0x2f, 0x53, 0x7f, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53,
-    0x67, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x23, 0x3b,
-    0x4f, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x37, 0x37, 0x37, 0x57, 0x73, 0x6f, 0x07, 0x0f, 0x17, 0x43, 0x57,
-    0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x17, 0x2f, 0x3f, 0x1b, 0x33,
-    0x43, 0x47, 0x47, 0x47, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x0b, 0x17, 0x1f,
-    0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x0b, 0x17, 0x1f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x1b, 0x33,
-    0x43, 0x27, 0x27, 0x27, 0x23, 0x3b, 0x4f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x23,
-    0x3b, 0x4f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x37,
-    0x37, 0x37, 0x27, 0x27, 0x27, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x5b, 0x5b,
-    0x5b, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b,
-    0x23, 0x43, 0x5f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x23,
-    0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x23, 0x3b, 0x4f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57,
-    0x6f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43,
-    0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x43, 0x57,
-    0x6f, 0x23, 0x3b, 0x4f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x4f,
-    0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x3b, 0x4f,
-    0x1b, 0x1b, 0x1b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x1b,
-    0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x47, 0x47, 0x47, 0x37, 0x37,
-    0x37, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x27, 0x3f, 0x37, 0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x33, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x0f, 0x23, 0x2b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x37, 0x37, 0x37, 0x5b, 0x5b, 0x5b, 0x0b, 0x17, 0x1f, 0x4b, 0x5f,
-    0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x23, 0x3b, 0x4f,
-    0x23, 0x3b, 0x4f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x43,
-    0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x33, 0x53,
-    0x67, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x17, 0x2f,
-    0x3f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x1b, 0x1b, 0x4f, 0x4f, 0x4f,
-    0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x37, 0x4b,
-    0x5f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x4b,
-    0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x27, 0x47, 0x6b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x17, 0x2f,
-    0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43,
-    0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x0b, 0x17, 0x1f, 0x3b, 0x57, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x33, 0x53,
-    0x67, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x17,
-    0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x5b, 0x5b, 0x5b, 0x0f, 0x23, 0x2b, 0x4b,
-    0x5f, 0x77, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x37, 0x4b,
-    0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b,
-    0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x1b, 0x33, 0x43,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x27, 0x47, 0x6b, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x4f, 0x63, 0x7b, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x3f, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x0b, 0x17, 0x1f, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27,
-    0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x37,
-    0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f,
-    0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x5b, 0x5b, 0x5b, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b,
-    0x33, 0x57, 0x87, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53,
-    0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1f, 0x3f,
-    0x53, 0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x1b, 0x1b, 0x1b, 0x43, 0x57, 0x6f, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x27, 0x27, 0x27, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2f, 0x3f,
-    0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x33, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x37,
-    0x37, 0x37, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b,
-    0x4f, 0x63, 0x7b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x17, 0x2f,
-    0x3f, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x33, 0x57, 0x87, 0x2b, 0x4f, 0x77,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17,
-    0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17,
-    0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x2f, 0x2f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1f, 0x3f,
-    0x53, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x37,
-    0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x53,
-    0x67, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83, 0x33, 0x57, 0x87,
-    0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x27, 0x47, 0x6b, 0x33,
-    0x57, 0x87, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x43, 0x57,
-    0x6f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x17,
-    0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23,
-    0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x13, 0x2b,
-    0x33, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x13,
-    0x2b, 0x33, 0x2b, 0x4f, 0x77, 0x0b, 0x17, 0x1f, 0x1b, 0x33, 0x43, 0x27, 0x27,
-    0x27, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x33, 0x57,
-    0x87, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x33, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23,
-    0x2b, 0x4f, 0x63, 0x7b, 0x27, 0x47, 0x6b, 0x2f, 0x53, 0x7f, 0x27, 0x47, 0x6b,
-    0x33, 0x57, 0x87, 0x2f, 0x53, 0x7f, 0x4b, 0x6b, 0x83, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x2b, 0x4f, 0x77, 0x2f, 0x53,
-    0x7f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f,
-    0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x1f, 0x3f,
-    0x53, 0x3f, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0b,
-    0x17, 0x1f, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b,
-    0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x0b,
-    0x17, 0x1f, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1f, 0x3f, 0x53,
-    0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1f,
-    0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x4b, 0x5f, 0x77, 0x0f, 0x23,
-    0x2b, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x53, 0x7f, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x2f, 0x53, 0x7f,
-    0x2b, 0x4f, 0x77, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x3f,
-    0x5f, 0x77, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x2f, 0x53, 0x7f, 0x2f, 0x53,
-    0x7f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x27, 0x3f, 0x37, 0x33, 0x53, 0x67, 0x33, 0x53,
-    0x67, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x37, 0x37,
-    0x37, 0x2f, 0x3f, 0x53, 0x1b, 0x1b, 0x1b, 0x4f, 0x4f, 0x4f, 0x17, 0x2f, 0x3f,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x3f, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0f, 0x23,
-    0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x37, 0x5f, 0x8f, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x4b, 0x6b, 0x83, 0x1b, 0x37, 0x4b, 0x5b, 0x73, 0x8b, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0f,
-    0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x3f, 0x53,
-    0x67, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x33,
-    0x57, 0x87, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x27, 0x47, 0x6b, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f,
-    0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x33, 0x53,
-    0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b,
-    0x37, 0x5f, 0x8f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27,
-    0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67,
-    0x0b, 0x17, 0x1f, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x0f, 0x23,
-    0x2b, 0x3b, 0x57, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27, 0x27, 0x27,
-    0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x0f, 0x23,
-    0x2b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x3f, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2f, 0x3f,
-    0x53, 0x4b, 0x6b, 0x83, 0x33, 0x53, 0x67, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87,
-    0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2f, 0x53, 0x7f, 0x2f, 0x53, 0x7f, 0x37, 0x5f, 0x8f, 0x43,
-    0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x1f,
-    0x3f, 0x53, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x37, 0x4b,
-    0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x4b, 0x6b, 0x83, 0x33, 0x53, 0x67,
-    0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x07, 0x0f, 0x17, 0x43, 0x57, 0x6f,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x4f, 0x4f, 0x4f, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x0b, 0x17, 0x1f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x4f, 0x63, 0x7b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x33, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x4b, 0x6b, 0x83, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x33, 0x53, 0x67, 0x33, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x33,
-    0x53, 0x67, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x2f, 0x53, 0x7f, 0x2f, 0x53, 0x7f,
-    0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x37,
-    0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x3f, 0x6b, 0xa3, 0x2f, 0x53, 0x7f, 0x27,
-    0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x2b, 0x4f, 0x77, 0x33, 0x57, 0x87, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x27,
-    0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x33, 0x57,
-    0x87, 0x1b, 0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f,
-    0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x33,
-    0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x4b, 0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x33, 0x53, 0x67, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x4b, 0x5f,
-    0x77, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x2f, 0x53, 0x7f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f,
-    0x23, 0x2b, 0x4f, 0x4f, 0x4f, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x0f, 0x23,
-    0x2b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43,
-    0x5f, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x4f,
-    0x77, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x23, 0x43,
-    0x5f, 0x3f, 0x5f, 0x77, 0x33, 0x53, 0x67, 0x33, 0x53, 0x67, 0x3f, 0x5f, 0x77,
-    0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x33, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x23, 0x43, 0x5f,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83,
-    0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x33, 0x57, 0x87, 0x43, 0x57, 0x6f,
-    0x2b, 0x4f, 0x77, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x4f, 0x63, 0x7b, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57,
-    0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x27, 0x27, 0x27,
-    0x3b, 0x3b, 0x3b, 0x27, 0x27, 0x27, 0x37, 0x37, 0x37, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x4b, 0x6b, 0x83, 0x33, 0x53,
-    0x67, 0x33, 0x53, 0x67, 0x3f, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x4f, 0x63,
-    0x7b, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x53,
-    0x67, 0x4f, 0x63, 0x7b, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57,
-    0x6f, 0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x4b,
-    0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x0f,
-    0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43,
-    0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x37, 0x4b, 0x5f, 0x27,
-    0x27, 0x27, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f,
-    0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37,
-    0x47, 0x47, 0x47, 0x2f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x23,
-    0x43, 0x5f, 0x4b, 0x6b, 0x83, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x33, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x4b, 0x5f,
-    0x77, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x33, 0x53,
-    0x67, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b, 0x3f,
-    0x53, 0x67, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x4f, 0x63, 0x7b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x63, 0x63, 0x63, 0x13, 0x2b, 0x33, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77,
-    0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x33, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2b,
-    0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f,
-    0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x4b,
-    0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x23, 0x43, 0x5f,
-    0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43, 0x57,
-    0x6f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x43,
-    0x57, 0x6f, 0x4b, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x33,
-    0x53, 0x67, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x0f, 0x23, 0x2b,
-    0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x13, 0x2b,
-    0x33, 0x43, 0x57, 0x6f, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0b, 0x17, 0x1f, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f,
-    0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x63, 0x7b, 0x93, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x4b,
-    0x5f, 0x77, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f,
-    0x5b, 0x73, 0x8b, 0x3f, 0x5f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x3f,
-    0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x3f, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x0f, 0x23,
-    0x2b, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43,
-    0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x4b, 0x6b, 0x83,
-    0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f,
-    0x5f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x3f, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b,
-    0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x57, 0x6b, 0x83, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f,
-    0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x4f,
-    0x63, 0x7b, 0x33, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33,
-    0x57, 0x6b, 0x83, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x57, 0x6b, 0x83, 0x4b, 0x5f, 0x77,
-    0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x2b,
-    0x4f, 0x77, 0x13, 0x2b, 0x33, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x27, 0x27,
-    0x27, 0x0b, 0x17, 0x1f, 0x17, 0x2f, 0x3f, 0x0b, 0x17, 0x1f, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f,
-    0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x2b, 0x47, 0x5b, 0x63, 0x7b, 0x93, 0x4b, 0x5f, 0x77, 0x3f, 0x53, 0x67,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f,
-    0x5b, 0x73, 0x8b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x27,
-    0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1f,
-    0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x33, 0x57,
-    0x87, 0x3f, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x4f,
-    0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0b, 0x17,
-    0x1f, 0x57, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x1b, 0x33, 0x43, 0x47,
-    0x47, 0x47, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x37, 0x37, 0x37,
-    0x47, 0x47, 0x47, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x13, 0x2b, 0x33, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x4f, 0x63, 0x7b, 0x0f, 0x23, 0x2b, 0x5b, 0x73, 0x8b, 0x3f, 0x53, 0x67,
-    0x27, 0x47, 0x6b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x3f,
-    0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x33, 0x57, 0x87, 0x43, 0x57, 0x6f, 0x1b, 0x33,
-    0x43, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x37, 0x4b, 0x5f, 0x37, 0x37, 0x37, 0x47, 0x47, 0x47, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2b, 0x4f,
-    0x77, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x27, 0x27, 0x27, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27,
-    0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x43, 0x6f, 0xab, 0x23, 0x43,
-    0x5f, 0x3f, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53,
-    0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x13, 0x2b,
-    0x33, 0x4b, 0x5f, 0x77, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x4f,
-    0x77, 0x2f, 0x53, 0x7f, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x4f, 0x63, 0x7b, 0x1b, 0x33, 0x43, 0x4f, 0x63, 0x7b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x33,
-    0x57, 0x87, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b,
-    0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x0b, 0x17, 0x1f,
-    0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x2f,
-    0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x3f, 0x53, 0x67, 0x37, 0x4b,
-    0x5f, 0x37, 0x4b, 0x5f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x33, 0x57, 0x87,
-    0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x33,
-    0x57, 0x87, 0x47, 0x73, 0xb3, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23,
-    0x2b, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23,
-    0x43, 0x5f, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x2f, 0x53,
-    0x7f, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x13,
-    0x2b, 0x33, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77,
-    0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x33,
-    0x57, 0x87, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x4f, 0x63, 0x7b, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x07, 0x0f, 0x17, 0x3b, 0x57, 0x53, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x0b, 0x17, 0x1f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f,
-    0x23, 0x2b, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x0f, 0x23, 0x2b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x1f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x13, 0x2b,
-    0x33, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53,
-    0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x17, 0x2f, 0x3f, 0x27, 0x47, 0x6b, 0x23,
-    0x43, 0x5f, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x33, 0x57, 0x87, 0x23,
-    0x43, 0x5f, 0x33, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x37, 0x37, 0x37, 0x57, 0x57, 0x57,
-    0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b,
-    0x33, 0x57, 0x87, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x4f, 0x63, 0x7b, 0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x2f,
-    0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x17,
-    0x2f, 0x3f, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x17, 0x2f, 0x3f, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x33, 0x53, 0x67, 0x0b, 0x17,
-    0x1f, 0x4f, 0x4f, 0x4f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x47, 0x47, 0x47,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x2b, 0x4f,
-    0x77, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x47, 0x47,
-    0x47, 0x37, 0x37, 0x37, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x2b, 0x4f, 0x77, 0x4f, 0x63, 0x7b, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x27,
-    0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x23,
-    0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f,
-    0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x27, 0x47, 0x6b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x1b, 0x1b, 0x3b, 0x57, 0x53, 0x0f, 0x23,
-    0x2b, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x0b, 0x17, 0x1f, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x0f,
-    0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x0f,
-    0x23, 0x2b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x33, 0x57, 0x87,
-    0x27, 0x47, 0x6b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x33, 0x57,
-    0x87, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x4f, 0x63, 0x7b,
-    0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2b,
-    0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b,
-    0x23, 0x43, 0x5f, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27,
-    0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x33, 0x53, 0x67,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57,
-    0x6f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x37, 0x4b, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x43, 0x57,
-    0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x0b,
-    0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x1b, 0x33,
-    0x43, 0x47, 0x47, 0x47, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f,
-    0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x33,
-    0x57, 0x87, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x0f,
-    0x23, 0x2b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x27, 0x47,
-    0x6b, 0x33, 0x57, 0x87, 0x4f, 0x63, 0x7b, 0x1f, 0x3f, 0x53, 0x3f, 0x5f, 0x77,
-    0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x3f,
-    0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b, 0x13, 0x2b, 0x33, 0x4b, 0x6b, 0x83,
-    0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x2b,
-    0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x4b, 0x5f,
-    0x77, 0x13, 0x2b, 0x33, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x37, 0x4b, 0x5f, 0x37, 0x4b,
-    0x5f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3b, 0x57, 0x53, 0x0b, 0x17, 0x1f, 0x43, 0x57,
-    0x6f, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x07, 0x0f, 0x17, 0x5b, 0x5b, 0x5b, 0x0b,
-    0x17, 0x1f, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x37, 0x37,
-    0x37, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x4b, 0x4b, 0x4b,
-    0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x33,
-    0x53, 0x67, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x3f, 0x53, 0x67, 0x6b, 0x7f,
-    0x9b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67,
-    0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43, 0x57,
-    0x6f, 0x13, 0x2b, 0x33, 0x4b, 0x6b, 0x83, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x33, 0x53,
-    0x67, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x43,
-    0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x07, 0x0f, 0x17, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x27,
-    0x27, 0x27, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x33, 0x57, 0x87, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f,
-    0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x53, 0x77, 0x8f, 0x23, 0x43, 0x5f, 0x43, 0x57,
-    0x6f, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f,
-    0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17,
-    0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x57, 0x6b,
-    0x83, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f,
-    0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x37,
-    0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b,
-    0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x4b,
-    0x5f, 0x77, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x27, 0x47,
-    0x6b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b, 0x1b, 0x1b, 0x5b, 0x5b, 0x5b,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f,
-    0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x23, 0x43, 0x5f, 0x27,
-    0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x4f,
-    0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x17, 0x2f, 0x3f, 0x3f, 0x53,
-    0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x4b,
-    0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83, 0x2b, 0x4f, 0x77, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b,
-    0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x27,
-    0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x17, 0x2f, 0x3f, 0x3f,
-    0x5f, 0x77, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x37,
-    0x4b, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f,
-    0x53, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43,
-    0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57,
-    0x6f, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f,
-    0x37, 0x4b, 0x5f, 0x63, 0x7b, 0x93, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x4b,
-    0x5f, 0x77, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x23, 0x43,
-    0x5f, 0x33, 0x53, 0x67, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x57,
-    0x6b, 0x83, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f,
-    0x77, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x4b, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f,
-    0x4f, 0x63, 0x7b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3b, 0x57,
-    0x53, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x37, 0x37,
-    0x37, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x33, 0x53, 0x67, 0x63, 0x7b, 0x93,
-    0x33, 0x53, 0x67, 0x33, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x37,
-    0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2b, 0x47, 0x5b,
-    0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83, 0x3f, 0x53, 0x67, 0x3f,
-    0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x27, 0x47,
-    0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43, 0x57,
-    0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33,
-    0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x3f, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x1f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x1b, 0x1b, 0x47, 0x47, 0x47, 0x17, 0x2f, 0x3f, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x37, 0x37,
-    0x37, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x4b, 0x4b, 0x4b, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x4f,
-    0x77, 0x33, 0x53, 0x67, 0x53, 0x77, 0x8f, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b,
-    0x57, 0x6b, 0x83, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x23,
-    0x43, 0x5f, 0x2f, 0x53, 0x7f, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x23, 0x43,
-    0x5f, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53,
-    0x33, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b,
-    0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17,
-    0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x13, 0x13, 0x13, 0x3b,
-    0x57, 0x53, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x27,
-    0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x63, 0x7b,
-    0x93, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b,
-    0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x3f,
-    0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x6b, 0xa3, 0x2f,
-    0x53, 0x7f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x13, 0x2b, 0x33,
-    0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x13, 0x2b,
-    0x33, 0x43, 0x57, 0x6f, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x3f, 0x53, 0x67, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x3b, 0x57, 0x53, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x43, 0x57,
-    0x6f, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x53, 0x77, 0x8f, 0x1b, 0x37, 0x4b, 0x23, 0x43,
-    0x5f, 0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x4f, 0x77,
-    0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x0b, 0x17,
-    0x1f, 0x4f, 0x63, 0x7b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87,
-    0x2f, 0x53, 0x7f, 0x2f, 0x53, 0x7f, 0x37, 0x5f, 0x8f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x1b,
-    0x33, 0x43, 0x3f, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x33, 0x53, 0x67, 0x23, 0x43,
-    0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b,
-    0x17, 0x1f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f,
-    0x3b, 0x57, 0x53, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2b, 0x4f, 0x77, 0x27,
-    0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b, 0x33,
-    0x43, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x37, 0x37, 0x37, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x37,
-    0x5f, 0x8f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x0b, 0x17,
-    0x1f, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x27,
-    0x27, 0x27, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x27, 0x47,
-    0x6b, 0x33, 0x57, 0x87, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x17, 0x2f, 0x3f, 0x3f, 0x5f, 0x77, 0x13,
-    0x2b, 0x33, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x4f, 0x4f, 0x4f, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0f, 0x23,
-    0x2b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x3f, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x3f, 0x5f, 0x77, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x37, 0x5f, 0x8f, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x13, 0x2b, 0x33, 0x4b, 0x5f, 0x77, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x2f,
-    0x2f, 0x4f, 0x4f, 0x4f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x37, 0x4b, 0x5f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87,
-    0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x33,
-    0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x5b, 0x73, 0x8b, 0x2b,
-    0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x1f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43,
-    0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77,
-    0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f,
-    0x53, 0x67, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x4f, 0x4f, 0x4f, 0x27, 0x27,
-    0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x37, 0x37, 0x37, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x3f,
-    0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x1f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x4b, 0x5f,
-    0x77, 0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x33, 0x53, 0x67, 0x33, 0x53, 0x67,
-    0x4b, 0x6b, 0x83, 0x4b, 0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57,
-    0x6f, 0x0b, 0x17, 0x1f, 0x57, 0x73, 0x6f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x13,
-    0x2b, 0x33, 0x3b, 0x57, 0x53, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x4f, 0x63,
-    0x7b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x57,
-    0x87, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2b, 0x4f, 0x77, 0x2f,
-    0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43,
-    0x5f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x37, 0x37, 0x37, 0x4b, 0x5f, 0x37, 0x37,
-    0x37, 0x47, 0x47, 0x47, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x4f, 0x63, 0x7b, 0x57, 0x6b,
-    0x83, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x63, 0x7b, 0x93,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x43, 0x57, 0x6f, 0x3f, 0x53,
-    0x67, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x3f, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x3b, 0x57, 0x53, 0x0f,
-    0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x33, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x4b, 0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77,
-    0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x23, 0x43,
-    0x5f, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f,
-    0x2b, 0x4f, 0x77, 0x2f, 0x53, 0x7f, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67,
-    0x37, 0x4b, 0x5f, 0x47, 0x47, 0x47, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x3f, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b,
-    0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x63, 0x7b, 0x93, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x1b, 0x37,
-    0x4b, 0x23, 0x43, 0x5f, 0x4b, 0x6b, 0x83, 0x3f, 0x5f, 0x77, 0x3f, 0x53, 0x67,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x33,
-    0x57, 0x87, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x3f, 0x5f,
-    0x77, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x4b,
-    0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x0f, 0x23, 0x2b, 0x47, 0x47, 0x47, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x4b,
-    0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f,
-    0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x3f, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37,
-    0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f,
-    0x53, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f,
-    0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x3f, 0x53,
-    0x67, 0x3f, 0x5f, 0x77, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x43,
-    0x57, 0x6f, 0x13, 0x2b, 0x33, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x47, 0x47, 0x47,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x37, 0x37,
-    0x37, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x4f, 0x63, 0x7b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x33, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x27, 0x47, 0x6b, 0x37, 0x4b, 0x5f, 0x13, 0x2b, 0x33, 0x43, 0x57,
-    0x6f, 0x4b, 0x6b, 0x83, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x4b, 0x6b,
-    0x83, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x4b,
-    0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x3f, 0x53,
-    0x67, 0x17, 0x2f, 0x3f, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b,
-    0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x37, 0x4b,
-    0x5f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x2b, 0x4f,
-    0x77, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f,
-    0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x13, 0x2b, 0x33, 0x4b, 0x5f, 0x77, 0x4f, 0x63, 0x7b, 0x43, 0x57,
-    0x6f, 0x43, 0x57, 0x6f, 0x33, 0x57, 0x87, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x4f,
-    0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b,
-    0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x23,
-    0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x23,
-    0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x57, 0x73, 0x6f, 0x0b, 0x17, 0x1f,
-    0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x2b,
-    0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x4f, 0x4f,
-    0x4f, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x43, 0x57,
-    0x6f, 0x3f, 0x5f, 0x77, 0x3f, 0x5f, 0x77, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x37, 0x5f, 0x8f, 0x13, 0x2b, 0x33, 0x43,
-    0x57, 0x6f, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f,
-    0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x2f, 0x53, 0x7f, 0x27,
-    0x47, 0x6b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x2f, 0x53, 0x7f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67,
-    0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33,
-    0x57, 0x6b, 0x83, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x37, 0x4b,
-    0x5f, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x2f, 0x53, 0x7f,
-    0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x4f, 0x4f, 0x4f, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x4f, 0x63, 0x7b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x4b, 0x6b, 0x83, 0x2b, 0x4f,
-    0x77, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x4f, 0x63, 0x7b, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x3f, 0x5f, 0x77, 0x33,
-    0x53, 0x67, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x33, 0x53,
-    0x67, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x3f, 0x5f, 0x77, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b,
-    0x4b, 0x5f, 0x77, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x4f, 0x77, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x4f, 0x63, 0x7b, 0x17, 0x2f, 0x3f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x37,
-    0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23,
-    0x2b, 0x4f, 0x63, 0x7b, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x37, 0x37, 0x37, 0x13, 0x2b, 0x33, 0x4f,
-    0x4f, 0x4f, 0x27, 0x27, 0x27, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x33, 0x57, 0x87, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x17, 0x2f, 0x3f, 0x33, 0x53,
-    0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x5b, 0x73, 0x8b, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x27, 0x47,
-    0x6b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x57, 0x6b, 0x83, 0x17, 0x2f, 0x3f,
-    0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x3f,
-    0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x3b, 0x57, 0x53, 0x13, 0x2b, 0x33, 0x4f, 0x63, 0x7b, 0x3f, 0x53, 0x67,
-    0x33, 0x57, 0x87, 0x3f, 0x5f, 0x77, 0x2b, 0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x13, 0x2b,
-    0x33, 0x4b, 0x6b, 0x83, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x17, 0x2f, 0x3f, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2f, 0x2f, 0x2f, 0x3b, 0x57, 0x53, 0x0b, 0x17, 0x1f, 0x0f,
-    0x23, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x3f, 0x53,
-    0x67, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23,
-    0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x53, 0x77, 0x8f, 0x2b,
-    0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x63, 0x7b, 0x93, 0x13, 0x2b, 0x33, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b,
-    0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b, 0x23, 0x43, 0x5f, 0x2b,
-    0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53,
-    0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x3b, 0x57, 0x53, 0x0f, 0x23,
-    0x2b, 0x4f, 0x63, 0x7b, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77,
-    0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b,
-    0x13, 0x2b, 0x33, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x4b, 0x6b, 0x83, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f,
-    0x53, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b,
-    0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x4f, 0x63, 0x7b, 0x0b,
-    0x17, 0x1f, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x43, 0x57, 0x6f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x17,
-    0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x47, 0x47, 0x47, 0x17, 0x2f, 0x3f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x37, 0x4b, 0x5f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x3f, 0x5f, 0x77, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x57, 0x6b, 0x83, 0x13, 0x2b,
-    0x33, 0x3f, 0x5f, 0x77, 0x27, 0x47, 0x6b, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f,
-    0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x23, 0x43, 0x5f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x5b, 0x73, 0x8b, 0x37, 0x4b,
-    0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x4b, 0x6b, 0x83, 0x2b, 0x4f, 0x77,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x13,
-    0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27,
-    0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x07, 0x0f, 0x17, 0x3b, 0x57, 0x53, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x13, 0x2b,
-    0x33, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x53, 0x77, 0x8f, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2f, 0x3f,
-    0x53, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b,
-    0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x57, 0x6b, 0x83, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x23, 0x43,
-    0x5f, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f,
-    0x2f, 0x3f, 0x53, 0x57, 0x6b, 0x83, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x23, 0x43,
-    0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x4b, 0x5f, 0x77,
-    0x07, 0x0f, 0x17, 0x3b, 0x57, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x33, 0x43, 0x57, 0x1b, 0x33,
-    0x43, 0x5b, 0x5b, 0x5b, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2b, 0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x4f, 0x63, 0x7b, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f,
-    0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x57, 0x6b, 0x83, 0x17,
-    0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x17, 0x2f,
-    0x3f, 0x37, 0x37, 0x37, 0x57, 0x57, 0x57, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37,
-    0x27, 0x27, 0x27, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x43,
-    0x57, 0x6f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x57, 0x6b, 0x83,
-    0x17, 0x2f, 0x3f, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x37, 0x37, 0x37, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x27, 0x47,
-    0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x37, 0x5f, 0x8f, 0x13, 0x2b, 0x33, 0x4b, 0x5f, 0x77, 0x2f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17,
-    0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2b, 0x4f, 0x77, 0x1b, 0x37,
-    0x4b, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x33, 0x53, 0x67,
-    0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x4f, 0x63,
-    0x7b, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x0f, 0x23,
-    0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x27,
-    0x27, 0x27, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x5f,
-    0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87,
-    0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x23,
-    0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x27,
-    0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x57, 0x6b, 0x83,
-    0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37,
-    0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83,
-    0x2f, 0x53, 0x7f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x37,
-    0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x43, 0x57,
-    0x6f, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x4f, 0x63,
-    0x7b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x17,
-    0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x37, 0x37, 0x37,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f,
-    0x53, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x1b, 0x37,
-    0x4b, 0x37, 0x4b, 0x5f, 0x57, 0x6b, 0x83, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1f,
-    0x3f, 0x53, 0x27, 0x3f, 0x37, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x43, 0x57,
-    0x6f, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b,
-    0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x33, 0x53,
-    0x67, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x57,
-    0x6b, 0x83, 0x13, 0x2b, 0x33, 0x57, 0x6b, 0x83, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x5b, 0x5b, 0x5b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f,
-    0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x47, 0x47,
-    0x47, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f,
-    0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x57, 0x6b,
-    0x83, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x27,
-    0x27, 0x27, 0x37, 0x37, 0x37, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f,
-    0x77, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x37, 0x5f, 0x8f,
-    0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x27, 0x47,
-    0x6b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x4b,
-    0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x1f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x3b, 0x57, 0x53,
-    0x0b, 0x17, 0x1f, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x37, 0x37, 0x37, 0x27,
-    0x27, 0x27, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x53,
-    0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x27, 0x47,
-    0x6b, 0x1b, 0x37, 0x4b, 0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b,
-    0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x3f,
-    0x53, 0x67, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x43, 0x57, 0x6f,
-    0x43, 0x57, 0x6f, 0x33, 0x57, 0x87, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b,
-    0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x4f, 0x63, 0x7b,
-    0x57, 0x6b, 0x83, 0x07, 0x0f, 0x17, 0x3b, 0x57, 0x53, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x0f, 0x23, 0x2b, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x4f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x13, 0x2b, 0x33, 0x43, 0x57,
-    0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x57, 0x6b,
-    0x83, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x4f,
-    0x63, 0x7b, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f,
-    0x3f, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x3f,
-    0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b,
-    0x2f, 0x53, 0x7f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x57, 0x6b, 0x83, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f,
-    0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x47, 0x47,
-    0x47, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b,
-    0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x27, 0x27, 0x27, 0x37, 0x37,
-    0x37, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x3f,
-    0x53, 0x67, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x2b, 0x4f, 0x77, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x37, 0x5f, 0x8f, 0x0f, 0x23, 0x2b, 0x37,
-    0x5f, 0x8f, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f,
-    0x53, 0x33, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43,
-    0x4f, 0x4f, 0x4f, 0x0b, 0x17, 0x1f, 0x3f, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2f, 0x53, 0x7f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b,
-    0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x4b, 0x5f,
-    0x77, 0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x17, 0x2f, 0x3f,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x13, 0x2b, 0x33, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x17, 0x2f,
-    0x3f, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x47, 0x47, 0x47, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f,
-    0x77, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x33,
-    0x57, 0x87, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x3f, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x37, 0x5f, 0x8f, 0x27, 0x47, 0x6b, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17,
-    0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x3f, 0x53, 0x67, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x27,
-    0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x57, 0x6b, 0x83, 0x0b, 0x17,
-    0x1f, 0x4b, 0x5f, 0x77, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x3b,
-    0x57, 0x53, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x27,
-    0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x53, 0x7f, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x4f, 0x63, 0x7b, 0x3f, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1f, 0x3f,
-    0x53, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x23, 0x43, 0x5f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x37,
-    0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47,
-    0x6b, 0x17, 0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x27, 0x47, 0x6b,
-    0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f,
-    0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0b, 0x17,
-    0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x53,
-    0x7f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x4f,
-    0x63, 0x7b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x17, 0x2f,
-    0x3f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x1b, 0x1b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x3f, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f,
-    0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x53, 0x77, 0x8f,
-    0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x0f,
-    0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x4f, 0x4f, 0x4f, 0x0b, 0x17,
-    0x1f, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x13, 0x2b, 0x33, 0x1b,
-    0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x1b, 0x37,
-    0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x17, 0x2f, 0x3f, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77,
-    0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27,
-    0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x57, 0x6b, 0x83, 0x0b,
-    0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b,
-    0x3b, 0x57, 0x53, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b,
-    0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f,
-    0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33,
-    0x43, 0x33, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x4b, 0x6b, 0x83, 0x4f, 0x63, 0x7b, 0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x27,
-    0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23,
-    0x2b, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x3f, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x3b, 0x57, 0x53, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x37, 0x4b,
-    0x5f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x37, 0x5f, 0x8f, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0b,
-    0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b,
-    0x3f, 0x5f, 0x77, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x0b, 0x17, 0x1f, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b,
-    0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x43,
-    0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23,
-    0x2b, 0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x3f, 0x5f,
-    0x77, 0x33, 0x57, 0x87, 0x4b, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x33,
-    0x53, 0x67, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x27,
-    0x47, 0x6b, 0x37, 0x4b, 0x5f, 0x4f, 0x4f, 0x4f, 0x37, 0x4b, 0x5f, 0x3f, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x3b, 0x57, 0x53, 0x0b,
-    0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x33, 0x57,
-    0x87, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x1b,
-    0x37, 0x4b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x3f, 0x53, 0x67, 0x0b, 0x17, 0x1f, 0x33, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77, 0x1f, 0x3f,
-    0x53, 0x4f, 0x63, 0x7b, 0x3f, 0x5f, 0x77, 0x33, 0x57, 0x87, 0x5b, 0x73, 0x8b,
-    0x0b, 0x17, 0x1f, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0b, 0x17,
-    0x1f, 0x4f, 0x4f, 0x4f, 0x0b, 0x17, 0x1f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43,
-    0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x0f, 0x23,
-    0x2b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x4b, 0x6b, 0x83, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x37,
-    0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x3b, 0x57, 0x53, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x37, 0x5f, 0x8f, 0x33, 0x57, 0x87, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x27,
-    0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x4f, 0x63,
-    0x7b, 0x4b, 0x6b, 0x83, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0b, 0x17, 0x1f, 0x3b, 0x57, 0x53, 0x27, 0x27,
-    0x27, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x0f, 0x23, 0x2b,
-    0x4b, 0x5f, 0x77, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x0f,
-    0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x3f, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4f,
-    0x63, 0x7b, 0x57, 0x6b, 0x83, 0x3f, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x3f, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x3b, 0x57, 0x53,
-    0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x17, 0x2f, 0x3f, 0x1f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2b,
-    0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x2b, 0x47,
-    0x5b, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x3f,
-    0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x57, 0x6b, 0x83, 0x57, 0x6b,
-    0x83, 0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f,
-    0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x0b,
-    0x17, 0x1f, 0x47, 0x47, 0x47, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x13,
-    0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67,
-    0x1b, 0x37, 0x4b, 0x4b, 0x4b, 0x4b, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67,
-    0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83, 0x33,
-    0x57, 0x87, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x57, 0x6b, 0x83,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x4b,
-    0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x43, 0x57,
-    0x6f, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f,
-    0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x33,
-    0x57, 0x87, 0x4b, 0x6b, 0x83, 0x5b, 0x73, 0x8b, 0x0f, 0x23, 0x2b, 0x4b, 0x5f,
-    0x77, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x1b, 0x1b, 0x47, 0x47, 0x47, 0x27,
-    0x27, 0x27, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x4f, 0x63, 0x7b, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83,
-    0x33, 0x57, 0x87, 0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f,
-    0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x1b, 0x37,
-    0x4b, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x3f, 0x53, 0x67, 0x2b, 0x47, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x2f, 0x2f, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x43, 0x57,
-    0x6f, 0x0f, 0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2b, 0x4f, 0x77, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x43, 0x57,
-    0x6f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x33, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53,
-    0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83, 0x33, 0x57, 0x87, 0x4f, 0x63, 0x7b, 0x57,
-    0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f,
-    0x0b, 0x17, 0x1f, 0x4f, 0x4f, 0x4f, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47,
-    0x6b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b,
-    0x33, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b,
-    0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x57, 0x57,
-    0x57, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f,
-    0x4f, 0x63, 0x7b, 0x2b, 0x47, 0x5b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x3f,
-    0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x23, 0x23, 0x23, 0x3b, 0x57, 0x53,
-    0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x0f,
-    0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33,
-    0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b,
-    0x5f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x33, 0x57,
-    0x87, 0x4b, 0x6b, 0x83, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23,
-    0x43, 0x5f, 0x23, 0x43, 0x5f, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x3f, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x23, 0x43,
-    0x5f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x3b,
-    0x57, 0x53, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67,
-    0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37,
-    0x4b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x3f,
-    0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x33, 0x57, 0x87, 0x4b, 0x6b, 0x83, 0x2b, 0x47, 0x5b,
-    0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x1f, 0x3f, 0x53, 0x1f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x13, 0x2b, 0x33, 0x4f, 0x4f, 0x4f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x2f, 0x2f, 0x2f, 0x37, 0x4b,
-    0x5f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x3f,
-    0x53, 0x67, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53,
-    0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37,
-    0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x37,
-    0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x4b,
-    0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x33, 0x57, 0x87, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f,
-    0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x13, 0x2b, 0x33, 0x4f, 0x4f,
-    0x4f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x37, 0x37, 0x37, 0x27,
-    0x27, 0x27, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x37, 0x37, 0x37, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x37,
-    0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x27,
-    0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x37,
-    0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f,
-    0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x23, 0x43,
-    0x5f, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b,
-    0x33, 0x53, 0x67, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x13, 0x2b, 0x33, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x43,
-    0x57, 0x6f, 0x3f, 0x53, 0x67, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x27, 0x47, 0x6b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x0b, 0x17, 0x1f, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f,
-    0x53, 0x67, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x23, 0x43, 0x5f, 0x33,
-    0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x43,
-    0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x17, 0x2f, 0x3f, 0x13, 0x2b,
-    0x33, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x2b,
-    0x4f, 0x77, 0x23, 0x43, 0x5f, 0x33, 0x53, 0x67, 0x4f, 0x63, 0x7b, 0x0b, 0x17,
-    0x1f, 0x43, 0x57, 0x6f, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x43,
-    0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x0b, 0x17, 0x1f, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x27,
-    0x27, 0x27, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b,
-    0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b,
-    0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x43, 0x57,
-    0x6f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33,
-    0x57, 0x87, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0f, 0x23,
-    0x2b, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x0f,
-    0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x2b, 0x47,
-    0x5b, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b,
-    0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x13, 0x2b,
-    0x33, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x37, 0x37, 0x37, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x0f, 0x23,
-    0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x4f, 0x63, 0x7b, 0x0b,
-    0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x13, 0x2b,
-    0x33, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33,
-    0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x0b, 0x17, 0x1f, 0x0f,
-    0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53,
-    0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x23, 0x43,
-    0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x23,
-    0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23,
-    0x2b, 0x37, 0x5f, 0x8f, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x23, 0x43, 0x5f,
-    0x17, 0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x3f, 0x53, 0x67, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x0f,
-    0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x23, 0x43,
-    0x5f, 0x33, 0x57, 0x87, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x57, 0x6b, 0x83, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43,
-    0x0b, 0x17, 0x1f, 0x0b, 0x17, 0x1f, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f,
-    0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43,
-    0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f, 0x23,
-    0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x33, 0x57, 0x87, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33,
-    0x43, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x3b, 0x57, 0x53, 0x0f,
-    0x23, 0x2b, 0x4f, 0x63, 0x7b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x1b, 0x33,
-    0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x23, 0x43, 0x5f, 0x3f, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x23, 0x43,
-    0x5f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x5b, 0x73, 0x8b,
-    0x0b, 0x17, 0x1f, 0x5b, 0x5b, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x13, 0x2b,
-    0x33, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b,
-    0x0f, 0x23, 0x2b, 0x0b, 0x17, 0x1f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x1b,
-    0x33, 0x43, 0x17, 0x2f, 0x3f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x1b, 0x37,
-    0x4b, 0x27, 0x27, 0x27, 0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53,
-    0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57,
-    0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x13,
-    0x2b, 0x33, 0x3f, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x3b, 0x57, 0x53, 0x0b, 0x17, 0x1f, 0x57, 0x6b, 0x83, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x27, 0x3f, 0x37, 0x17, 0x2f,
-    0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f,
-    0x53, 0x67, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f,
-    0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x33, 0x57, 0x87, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x0f, 0x23,
-    0x2b, 0x0b, 0x17, 0x1f, 0x27, 0x27, 0x27, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b,
-    0x33, 0x43, 0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x37, 0x4b, 0x5f, 0x0f,
-    0x23, 0x2b, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43,
-    0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x33, 0x57, 0x87, 0x2b, 0x47, 0x5b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x23,
-    0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x4f, 0x4f, 0x4f,
-    0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x13, 0x2b,
-    0x33, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b,
-    0x37, 0x37, 0x37, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x33, 0x57, 0x87, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x5b, 0x73,
-    0x8b, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x2b, 0x4f, 0x77, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x13,
-    0x2b, 0x33, 0x4f, 0x4f, 0x4f, 0x0b, 0x17, 0x1f, 0x0f, 0x23, 0x2b, 0x0f, 0x23,
-    0x2b, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x4b, 0x5f, 0x77,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x43, 0x57, 0x6f,
-    0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x43,
-    0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x23, 0x43,
-    0x5f, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77,
-    0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f, 0x77,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23,
-    0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x33, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x43, 0x57,
-    0x6f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53,
-    0x33, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x4f, 0x63, 0x7b, 0x1b, 0x37, 0x4b, 0x23,
-    0x43, 0x5f, 0x23, 0x43, 0x5f, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x3f, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x0b, 0x17, 0x1f, 0x47, 0x47, 0x47, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x17, 0x2f,
-    0x3f, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67, 0x53, 0x77, 0x8f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b,
-    0x4f, 0x77, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x37, 0x4b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x3b, 0x57,
-    0x53, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b,
-    0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x53, 0x77, 0x8f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x57,
-    0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x07, 0x0f, 0x17, 0x47, 0x47, 0x47, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x1f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x43, 0x57,
-    0x6f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x33, 0x53,
-    0x67, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x3f, 0x53,
-    0x67, 0x13, 0x2b, 0x33, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x23, 0x43, 0x5f, 0x17, 0x2f, 0x3f, 0x1f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x27, 0x27, 0x27, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f,
-    0x77, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x17, 0x2f,
-    0x3f, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x3f,
-    0x53, 0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1f, 0x3f,
-    0x53, 0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4b,
-    0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x37, 0x4b, 0x5f, 0x17, 0x2f, 0x3f, 0x07, 0x0f, 0x17, 0x47, 0x47, 0x47,
-    0x27, 0x27, 0x27, 0x0b, 0x17, 0x1f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b,
-    0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f,
-    0x3f, 0x2f, 0x2f, 0x2f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x4b, 0x4b,
-    0x4b, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x23, 0x43,
-    0x5f, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67,
-    0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x4b, 0x5f,
-    0x77, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53,
-    0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x4f,
-    0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x33, 0x43,
-    0x57, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b,
-    0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x13, 0x2b, 0x33, 0x37,
-    0x4b, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x2f, 0x53, 0x7f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f,
-    0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2b, 0x4f, 0x77, 0x2b, 0x4f,
-    0x77, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f,
-    0x57, 0x6b, 0x83, 0x0b, 0x17, 0x1f, 0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x37,
-    0x37, 0x1b, 0x1b, 0x1b, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27,
-    0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x0b,
-    0x17, 0x1f, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x2f, 0x3f,
-    0x53, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53,
-    0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x23,
-    0x43, 0x5f, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x4f, 0x77, 0x2b,
-    0x4f, 0x77, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x2b, 0x4f, 0x77, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x43,
-    0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43,
-    0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27,
-    0x37, 0x37, 0x37, 0x17, 0x2f, 0x3f, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f,
-    0x5f, 0x77, 0x3f, 0x5f, 0x77, 0x3f, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f,
-    0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x23, 0x43, 0x5f, 0x1f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x3f, 0x53, 0x67, 0x2b, 0x47,
-    0x5b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x2b, 0x4f, 0x77, 0x3f, 0x53, 0x67, 0x33, 0x43, 0x57, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x57, 0x6b, 0x83, 0x07, 0x0f, 0x17,
-    0x4f, 0x63, 0x7b, 0x43, 0x57, 0x6f, 0x13, 0x2b, 0x33, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x1b, 0x1b, 0x4f, 0x4f,
-    0x4f, 0x0f, 0x23, 0x2b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x17, 0x2f, 0x3f,
-    0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x0b, 0x17, 0x1f, 0x1b, 0x33, 0x43, 0x13,
-    0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x37, 0x37,
-    0x37, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x0f, 0x23, 0x2b, 0x3f,
-    0x53, 0x67, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f, 0x13, 0x2b, 0x33,
-    0x1f, 0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f,
-    0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2f, 0x3f,
-    0x53, 0x27, 0x27, 0x27, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x0f, 0x23, 0x2b,
-    0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x3f, 0x5f, 0x77, 0x33, 0x57, 0x87, 0x2b,
-    0x4f, 0x77, 0x27, 0x47, 0x6b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b,
-    0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x1f, 0x3f, 0x53, 0x3f, 0x5f, 0x77, 0x1f,
-    0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x27, 0x47,
-    0x6b, 0x4f, 0x63, 0x7b, 0x0b, 0x17, 0x1f, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b,
-    0x33, 0x43, 0x07, 0x0f, 0x17, 0x3b, 0x57, 0x53, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27,
-    0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x4b, 0x4b, 0x4b, 0x0f, 0x23, 0x2b, 0x3f,
-    0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x33, 0x53, 0x67, 0x43, 0x57, 0x6f,
-    0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57,
-    0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x27, 0x47, 0x6b,
-    0x4b, 0x5f, 0x77, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x3f,
-    0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2b,
-    0x47, 0x3f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x27, 0x27, 0x27, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x3b, 0x57, 0x53, 0x0b, 0x17, 0x1f,
-    0x4b, 0x5f, 0x77, 0x33, 0x57, 0x87, 0x33, 0x57, 0x87, 0x27, 0x47, 0x6b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43,
-    0x5f, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x2f,
-    0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x3f, 0x53, 0x67, 0x17, 0x2f,
-    0x3f, 0x3f, 0x53, 0x67, 0x0f, 0x23, 0x2b, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43,
-    0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b,
-    0x33, 0x43, 0x57, 0x43, 0x57, 0x6f, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x4b, 0x5f, 0x77, 0x0f, 0x23,
-    0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x07, 0x0f, 0x17, 0x3b,
-    0x57, 0x53, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x37, 0x37, 0x37, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x0f,
-    0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1f, 0x3f, 0x53, 0x13, 0x2b, 0x33, 0x23, 0x43,
-    0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33,
-    0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x23, 0x3b,
-    0x4f, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x1f, 0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x0b, 0x17, 0x1f,
-    0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x17, 0x2f,
-    0x3f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67,
-    0x37, 0x37, 0x37, 0x27, 0x27, 0x27, 0x43, 0x43, 0x43, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x4f, 0x4f, 0x4f, 0x0f, 0x23, 0x2b, 0x4b, 0x6b, 0x83, 0x2b, 0x4f, 0x77,
-    0x2b, 0x4f, 0x77, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x23,
-    0x43, 0x5f, 0x27, 0x47, 0x6b, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x23, 0x43,
-    0x5f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x27, 0x47, 0x6b,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x0f, 0x23,
-    0x2b, 0x4b, 0x5f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33,
-    0x43, 0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x2b, 0x47, 0x5b,
-    0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2f,
-    0x3f, 0x53, 0x4b, 0x5f, 0x77, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x07, 0x0f, 0x17, 0x43, 0x57, 0x6f, 0x17, 0x2f, 0x3f, 0x0f,
-    0x23, 0x2b, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x27, 0x27,
-    0x27, 0x13, 0x2b, 0x33, 0x1f, 0x3f, 0x53, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f,
-    0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x2f,
-    0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x23, 0x3b, 0x4f, 0x17, 0x2f, 0x3f, 0x37, 0x4b, 0x5f, 0x0f, 0x23, 0x2b,
-    0x3f, 0x53, 0x67, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x23, 0x3b, 0x4f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x23, 0x3b,
-    0x4f, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f, 0x1b, 0x33, 0x43, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x43,
-    0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47,
-    0x5b, 0x43, 0x57, 0x6f, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43,
-    0x1f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x5b, 0x1b,
-    0x33, 0x43, 0x2f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x37, 0x37, 0x37, 0x1b, 0x33, 0x43,
-    0x37, 0x37, 0x37, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x47, 0x47, 0x47, 0x0f, 0x23,
-    0x2b, 0x57, 0x6b, 0x83, 0x2b, 0x4f, 0x77, 0x2f, 0x53, 0x7f, 0x37, 0x5f, 0x8f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x23,
-    0x43, 0x5f, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x1b, 0x37,
-    0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x1b, 0x37, 0x4b,
-    0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x37, 0x4b, 0x5f, 0x0b, 0x17, 0x1f, 0x43, 0x57, 0x6f, 0x2b, 0x47,
-    0x5b, 0x27, 0x27, 0x27, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x1f, 0x3f, 0x53,
-    0x1f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x17,
-    0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x37, 0x4b,
-    0x5f, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x4b, 0x5f, 0x77, 0x0f,
-    0x23, 0x2b, 0x43, 0x57, 0x6f, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37,
-    0x4b, 0x33, 0x53, 0x67, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x1b, 0x1b,
-    0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x1b, 0x37, 0x4b, 0x0f, 0x23,
-    0x2b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x0b, 0x17, 0x1f,
-    0x0b, 0x17, 0x1f, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x1b, 0x1b, 0x1b, 0x0f,
-    0x23, 0x2b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x23, 0x23,
-    0x23, 0x13, 0x2b, 0x33, 0x2f, 0x2f, 0x2f, 0x0b, 0x17, 0x1f, 0x07, 0x0f, 0x17,
-    0x0b, 0x17, 0x1f, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0f, 0x23, 0x2b, 0x1b,
-    0x33, 0x43, 0x23, 0x23, 0x23, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b,
-    0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b,
-    0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x0f,
-    0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b,
-    0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x33, 0x43, 0x57, 0x17,
-    0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f,
-    0x3f, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f,
-    0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x0f,
-    0x23, 0x2b, 0x13, 0x2b, 0x33, 0x2f, 0x2f, 0x2f, 0x0b, 0x17, 0x1f, 0x07, 0x0f,
-    0x17, 0x0b, 0x17, 0x1f, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x0f, 0x23, 0x2b,
-    0x1b, 0x33, 0x43, 0x23, 0x23, 0x23, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23,
-    0x2b, 0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33,
-    0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x0f, 0x23,
-    0x2b, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x33, 0x43, 0x57,
-    0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17,
-    0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f,
-    0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x3f,
-    0x53, 0x67, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x17, 0x2f, 0x3f, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0b, 0x17, 0x1f,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x17,
-    0x2f, 0x3f, 0x27, 0x27, 0x27, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x3f, 0x53,
-    0x67, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x47, 0x47, 0x47, 0x17, 0x2f,
-    0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x37, 0x4b, 0x5f,
-    0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x1b,
-    0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x1b, 0x37,
-    0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x4f, 0x77,
-    0x23, 0x43, 0x5f, 0x4b, 0x6b, 0x83, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1f, 0x3f,
-    0x53, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x3f,
-    0x53, 0x67, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
-    0x27, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x2b, 0x47, 0x5b, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x47, 0x47, 0x47, 0x17,
-    0x2f, 0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x1b, 0x33, 0x43, 0x37, 0x4b,
-    0x5f, 0x2b, 0x47, 0x5b, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f, 0x23, 0x43, 0x5f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x1f, 0x3f, 0x53, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x4f,
-    0x77, 0x23, 0x43, 0x5f, 0x4b, 0x6b, 0x83, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x33, 0x53, 0x67, 0x1b, 0x37, 0x4b, 0x1f,
-    0x3f, 0x53, 0x2b, 0x4f, 0x77, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x33, 0x43,
-    0x57, 0x3b, 0x57, 0x53, 0x3f, 0x53, 0x67, 0x4f, 0x6b, 0x67, 0x3f, 0x53, 0x67,
-    0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x3f,
-    0x53, 0x67, 0x3f, 0x53, 0x67, 0x4f, 0x6b, 0x67, 0x3f, 0x53, 0x67, 0x43, 0x43,
-    0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x4b, 0x4b, 0x4b, 0x33, 0x43, 0x57,
-    0x3b, 0x57, 0x53, 0x2f, 0x3f, 0x53, 0x3b, 0x57, 0x53, 0x2f, 0x3f, 0x53, 0x3b,
-    0x57, 0x53, 0x3b, 0x57, 0x53, 0x4b, 0x5f, 0x77, 0x33, 0x43, 0x57, 0x2f, 0x3f,
-    0x53, 0x43, 0x43, 0x43, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x3b, 0x57, 0x53,
-    0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x4b, 0x4b, 0x43, 0x43, 0x43, 0x3f,
-    0x53, 0x67, 0x3f, 0x53, 0x67, 0x33, 0x43, 0x57, 0x3f, 0x53, 0x67, 0x33, 0x43,
-    0x57, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f,
-    0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x37,
-    0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53,
-    0x67, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x5b, 0x73, 0x8b,
-    0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x3f,
-    0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x4f, 0x6b, 0x67, 0x3f, 0x53,
-    0x67, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x4f, 0x6b, 0x67,
-    0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x33, 0x43, 0x57, 0x2f,
-    0x3f, 0x53, 0x43, 0x43, 0x43, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x3b, 0x57,
-    0x53, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x4b, 0x4b, 0x43, 0x43, 0x43,
-    0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x33, 0x43, 0x57, 0x3f, 0x53, 0x67, 0x33,
-    0x43, 0x57, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b,
-    0x5f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f,
-    0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f,
-    0x53, 0x67, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x5b, 0x73,
-    0x8b, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f,
-    0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x4f, 0x6b, 0x67, 0x3f,
-    0x53, 0x67, 0x37, 0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x4f, 0x6b,
-    0x67, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x3f, 0x53, 0x67,
-    0x4f, 0x6b, 0x67, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x3b, 0x57, 0x53, 0x4b,
-    0x5f, 0x77, 0x3f, 0x53, 0x67, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x37, 0x4b,
-    0x5f, 0x33, 0x43, 0x57, 0x37, 0x4b, 0x5f, 0x33, 0x43, 0x57, 0x33, 0x43, 0x57,
-    0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x47, 0x47, 0x47, 0x4f,
-    0x4f, 0x4f, 0x37, 0x4b, 0x5f, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
-    0x37, 0x2f, 0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x33, 0x43, 0x57, 0x2f, 0x3f, 0x53,
-    0x47, 0x47, 0x47, 0x43, 0x43, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x3f,
-    0x53, 0x67, 0x47, 0x47, 0x47, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x37, 0x4b, 0x5f,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x47, 0x47, 0x47, 0x37, 0x4b, 0x5f, 0x2f,
-    0x3f, 0x53, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x37, 0x4b,
-    0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x33, 0x43, 0x57, 0x37, 0x4b, 0x5f,
-    0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x33,
-    0x43, 0x57, 0x33, 0x43, 0x57, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x3f, 0x53,
-    0x67, 0x37, 0x4b, 0x5f, 0x43, 0x57, 0x6f, 0x33, 0x43, 0x57, 0x37, 0x4b, 0x5f,
-    0x37, 0x4b, 0x5f, 0x33, 0x43, 0x57, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x33,
-    0x43, 0x57, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b,
-    0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x33, 0x43, 0x57, 0x37, 0x4b, 0x5f,
-    0x3f, 0x53, 0x67, 0x47, 0x47, 0x47, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x33, 0x43, 0x57, 0x37, 0x4b,
-    0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x47, 0x47, 0x47, 0x17, 0x2f, 0x3f,
-    0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x2b, 0x47, 0x3f, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x2b, 0x47,
-    0x3f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x2b, 0x47, 0x3f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x3f, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x27,
-    0x27, 0x27, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f,
-    0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x27,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x13, 0x2b, 0x33, 0x17, 0x2f,
-    0x3f, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27,
-    0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x13, 0x2b,
-    0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x27, 0x3f, 0x37, 0x13, 0x2b, 0x33, 0x17, 0x2f,
-    0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33,
-    0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x17,
-    0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x27, 0x3f, 0x37, 0x27, 0x3f, 0x37, 0x1b, 0x33,
-    0x43, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33,
-    0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x17, 0x2f,
-    0x3f, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x27, 0x27, 0x27, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x13, 0x2b,
-    0x33, 0x13, 0x2b, 0x33, 0x1b, 0x1b, 0x1b, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33,
-    0x23, 0x3b, 0x4f, 0x17, 0x2f, 0x3f, 0x2b, 0x47, 0x3f, 0x1b, 0x33, 0x43, 0x1b,
-    0x37, 0x4b, 0x17, 0x2f, 0x3f, 0x17, 0x2f, 0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x27, 0x3f, 0x37, 0x2b, 0x47, 0x3f, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f, 0x13, 0x2b,
-    0x33, 0x23, 0x3b, 0x4f, 0x1b, 0x33, 0x43, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x17, 0x2f, 0x3f, 0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x23,
-    0x3b, 0x4f, 0x13, 0x2b, 0x33, 0x27, 0x3f, 0x37, 0x13, 0x2b, 0x33, 0x23, 0x3b,
-    0x4f, 0x17, 0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f,
-    0x1f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23,
-    0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x13,
-    0x13, 0x13, 0x1b, 0x1b, 0x1b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0b, 0x17,
-    0x1f, 0x13, 0x2b, 0x33, 0x1b, 0x1b, 0x1b, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-    0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x1b, 0x1b, 0x0b,
-    0x17, 0x1f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b,
-    0x33, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33,
-    0x1b, 0x1b, 0x1b, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x17,
-    0x2f, 0x3f, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x1b, 0x33,
-    0x43, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33,
-    0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x1b, 0x33,
-    0x43, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x13, 0x2b, 0x33,
-    0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13,
-    0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b, 0x33, 0x13, 0x2b,
-    0x33, 0x13, 0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x1b, 0x1b,
-    0x0b, 0x17, 0x1f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x13,
-    0x2b, 0x33, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x17, 0x2f,
-    0x3f, 0x2f, 0x2f, 0x2f, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f,
-    0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x3f, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f, 0x2f,
-    0x3f, 0x53, 0x2b, 0x47, 0x3f, 0x27, 0x3f, 0x37, 0x23, 0x3b, 0x4f, 0x23, 0x3b,
-    0x4f, 0x2f, 0x2f, 0x2f, 0x27, 0x3f, 0x37, 0x2f, 0x2f, 0x2f, 0x27, 0x3f, 0x37,
-    0x23, 0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x23, 0x3b, 0x4f, 0x27, 0x3f, 0x37, 0x2b,
-    0x47, 0x3f, 0x1b, 0x33, 0x43, 0x23, 0x3b, 0x4f, 0x2b, 0x47, 0x3f, 0x27, 0x3f,
-    0x37, 0x27, 0x3f, 0x37, 0x27, 0x3f, 0x37, 0x27, 0x3f, 0x37, 0x23, 0x3b, 0x4f,
-    0x23, 0x3b, 0x4f, 0x27, 0x3f, 0x37, 0x2b, 0x47, 0x3f, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x23, 0x3b, 0x4f, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2f,
-    0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37,
-    0x4b, 0x23, 0x43, 0x5f, 0x2b, 0x47, 0x5b, 0x1f, 0x3f, 0x53, 0x27, 0x3f, 0x37,
-    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53, 0x1b, 0x33,
-    0x43, 0x1b, 0x33, 0x43, 0x27, 0x27, 0x27, 0x3f, 0x53, 0x67, 0x1b, 0x33, 0x43,
-    0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43, 0x1b,
-    0x33, 0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x37, 0x37,
-    0x37, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x17, 0x2f, 0x3f,
-    0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b, 0x1b,
-    0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b, 0x47,
-    0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f, 0x53,
-    0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b, 0x47,
-    0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53, 0x67,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b,
-    0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x3f, 0x53, 0x67, 0x1b, 0x33,
-    0x43, 0x17, 0x2f, 0x3f, 0x0f, 0x23, 0x2b, 0x0f, 0x23, 0x2b, 0x1b, 0x33, 0x43,
-    0x1b, 0x33, 0x43, 0x1b, 0x33, 0x43, 0x3f, 0x53, 0x67, 0x13, 0x2b, 0x33, 0x37,
-    0x37, 0x37, 0x0f, 0x23, 0x2b, 0x43, 0x57, 0x6f, 0x1b, 0x33, 0x43, 0x17, 0x2f,
-    0x3f, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x3f, 0x5f, 0x77, 0x2b, 0x47, 0x5b,
-    0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x43, 0x57, 0x6f, 0x1b, 0x37, 0x4b, 0x2b,
-    0x47, 0x5b, 0x37, 0x4b, 0x5f, 0x2f, 0x3f, 0x53, 0x1b, 0x33, 0x43, 0x2f, 0x3f,
-    0x53, 0x2f, 0x3f, 0x53, 0x1b, 0x37, 0x4b, 0x2b, 0x4f, 0x77, 0x3f, 0x5f, 0x77,
-    0x2b, 0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x33, 0x53, 0x67, 0x1f, 0x3f, 0x53, 0x2b,
-    0x47, 0x5b, 0x1b, 0x37, 0x4b, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x33, 0x53,
-    0x67, 0x1b, 0x37, 0x4b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b, 0x2b, 0x47, 0x5b,
-    0x2b, 0x47, 0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x1f, 0x3f, 0x53, 0x23,
-    0x43, 0x5f, 0x2f, 0x3f, 0x53, 0x2f, 0x3f, 0x53, 0x27, 0x47, 0x6b, 0x2b, 0x47,
-    0x5b, 0x27, 0x47, 0x6b, 0x2b, 0x4f, 0x77, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67,
-    0x4f, 0x63, 0x7b, 0x3f, 0x53, 0x67, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x37,
-    0x4b, 0x5f, 0x3f, 0x53, 0x67, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x3b, 0x3b, 0x3b, 0x47, 0x47, 0x47, 0x3f, 0x53, 0x67, 0x43, 0x57, 0x6f, 0x3f,
-    0x53, 0x67, 0x57, 0x57, 0x57, 0x4f, 0x4f, 0x4f, 0x3f, 0x53, 0x67, 0x3f, 0x53,
-    0x67, 0x57, 0x73, 0x6f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x4f, 0x4f, 0x4f, 0x5b,
-    0x5b, 0x5b, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x5f,
-    0x77, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x5f, 0x77,
-    0x4f, 0x63, 0x7b, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x57, 0x57, 0x57, 0x4b,
-    0x5f, 0x77, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x3f, 0x53, 0x67, 0x57, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f, 0x57,
-    0x57, 0x57, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x3f, 0x53,
-    0x67, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77,
-    0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4b,
-    0x5f, 0x77, 0x57, 0x73, 0x6f, 0x4f, 0x4f, 0x4f, 0x47, 0x47, 0x47, 0x47, 0x47,
-    0x47, 0x47, 0x47, 0x47, 0x3f, 0x53, 0x67, 0x3f, 0x53, 0x67, 0x4f, 0x4f, 0x4f,
-    0x5b, 0x5b, 0x5b, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b,
-    0x5f, 0x77, 0x3f, 0x53, 0x67, 0x37, 0x4b, 0x5f, 0x37, 0x4b, 0x5f, 0x4b, 0x5f,
-    0x77, 0x4f, 0x63, 0x7b, 0x4b, 0x5f, 0x77, 0x37, 0x4b, 0x5f, 0x57, 0x57, 0x57,
-    0x4b, 0x5f, 0x77, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-    0x57, 0x3f, 0x53, 0x67, 0x57, 0x6b, 0x83, 0x43, 0x57, 0x6f, 0x43, 0x57, 0x6f,
-    0x57, 0x57, 0x57, 0x3f, 0x53, 0x67, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x3f,
-    0x53, 0x67, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4b, 0x5f,
-    0x77, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f,
-    0x4b, 0x5f, 0x77, 0x43, 0x57, 0x6f, 0x3f, 0x53, 0x67, 0x57, 0x57, 0x57, 0x3f,
-    0x53, 0x67, 0x4b, 0x5f, 0x77, 0x4b, 0x5f, 0x77, 0x4f, 0x63, 0x7b, 0x4f, 0x63,
-    0x7b, 0x00, 0x00
-};
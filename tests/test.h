@@ -0,0 +1,30 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdio.h>
+
+/* DEFINES ------------------------------------------------------------------ */
+
+/** Report a failed check with its location and count it, main returns
+ *  test_result() */
+#define CHECK(cond)                                                          \
+    do                                                                       \
+    {                                                                        \
+        if (!(cond))                                                         \
+        {                                                                    \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            g_test_failures++;                                               \
+        }                                                                    \
+    } while (0)
+
+/* LOCAL DATA --------------------------------------------------------------- */
+static int g_test_failures;
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Print the result of the test program, exit code for main */
+static inline int test_result(const char* name)
+{
+    printf("%s: %s\n", name, g_test_failures ? "FAILED" : "ok");
+    return g_test_failures ? 1 : 0;
+}
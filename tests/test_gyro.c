@@ -0,0 +1,116 @@
+/*
+ * Host test of the gyroscope steering (Core/Raycaster/gyro.c): replays a
+ * sample stream recorded at rest, during a turn to the right and at rest
+ * again through gyro_push/gyro_update and checks the calibrated bias and
+ * the integrated yaw.
+ *
+ * Usage:
+ *   make -C tests
+ */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "gyro.h"
+#include "engine.h"
+#include "test.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define RATE_HZ     95.0f   /**< L3GD20_OUTPUT_DATARATE_1, as in the firmware */
+#define DPS_PER_LSB 0.0175f /**< L3GD20_SENSITIVITY_500DPS */
+#define DEG(rad)    ((rad) * 180.0f / M_PI_F)
+
+/* LOCAL DATA --------------------------------------------------------------- */
+
+/** Yaw rates (y) of the board: 1 s at rest with a bias of about 14 LSB, a
+ *  turn of about 81.5 degrees to the right in 1 s, 1 s at rest */
+static const int16_t g_recording[] = {
+    17, 17, 15, 16, 12, 12, 12, 16, 14, 15, 15, 14,
+    11, 14, 14, 11, 15, 12, 11, 11, 12, 11, 11, 12,
+    12, 12, 11, 14, 16, 14, 13, 17, 15, 12, 17, 16,
+    14, 16, 16, 12, 14, 15, 14, 11, 15, 14, 11, 13,
+    12, 15, 16, 12, 11, 15, 13, 17, 15, 17, 14, 12,
+    16, 13, 17, 13, 16, 15, 12, 16, 14, 11, 12, 12,
+    14, 12, 17, 16, 16, 12, 11, 16, 15, 11, 11, 17,
+    17, 14, 11, 15, 16, 14, 14, 14, 12, 13, 12, -499,
+    -1016, -1528, -2041, -2555, -3072, -3587, -4097, -4616, -5132, -5132, -5128, -5131,
+    -5130, -5132, -5131, -5130, -5132, -5129, -5128, -5129, -5127, -5127, -5131, -5127,
+    -5130, -5128, -5126, -5126, -5128, -5126, -5126, -5132, -5126, -5127, -5130, -5130,
+    -5128, -5126, -5126, -5128, -5126, -5128, -5132, -5131, -5130, -5128, -5129, -5126,
+    -5131, -5129, -5127, -5131, -5130, -5128, -5129, -5126, -5131, -5130, -5132, -5129,
+    -5131, -5126, -5131, -5128, -5131, -5130, -5131, -5130, -5132, -5131, -5126, -5128,
+    -5131, -5128, -5130, -5132, -5131, -5131, -5129, -5131, -5132, -5132, -5128, -5131,
+    -5131, -4615, -4100, -3585, -3071, -2559, -2045, -1530, -1017, -497, 11, 12,
+    15, 12, 13, 15, 11, 11, 17, 17, 17, 14, 11, 16,
+    17, 14, 12, 16, 11, 14, 13, 15, 14, 16, 13, 15,
+    17, 11, 11, 17, 13, 15, 11, 17, 14, 14, 13, 11,
+    16, 13, 17, 16, 13, 13, 12, 11, 12, 11, 17, 11,
+    16, 11, 15, 12, 16, 13, 14, 16, 12, 15, 16, 17,
+    15, 13, 14, 11, 15, 17, 15, 13, 14, 14, 12, 11,
+    11, 16, 11, 14, 17, 14, 16, 16, 13, 16, 15, 12,
+    16, 13, 11, 16, 15, 12, 12, 11, 15,
+};
+#define RECORDING_LENGTH ((int)(sizeof(g_recording) / sizeof(g_recording[0])))
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Push samples [first, last) of the recording, gyro_update every chunk
+ *  samples. Returns the sum of the yaw gyro_update returned. */
+static float replay(gyro_t* gyro, int first, int last, int chunk)
+{
+    float yaw = 0.0f;
+    for (int i = first; i < last; i++)
+    {
+        const gyro_sample_t sample = { .x = 0, .y = g_recording[i], .z = 0 };
+        CHECK(gyro_push(gyro, &sample));
+        if ((i - first + 1) % chunk == 0)
+            yaw += gyro_update(gyro);
+    }
+    return yaw + gyro_update(gyro);
+}
+
+int main(void)
+{
+    gyro_t gyro;
+
+    /* calibration: the bias is the mean of the first samples, nothing turns */
+    gyro_init(&gyro, RATE_HZ, DPS_PER_LSB);
+    CHECK(replay(&gyro, 0, GYRO_CALIBRATION, 1) == 0.0f);
+    CHECK(fabsf(gyro.bias - 14.0f) < 1.0f);
+
+    /* rest, turn and rest: only the turn is integrated */
+    const float yaw = replay(&gyro, GYRO_CALIBRATION, RECORDING_LENGTH, 1);
+    CHECK(fabsf(DEG(yaw) - 81.5f) < 0.5f);
+    CHECK(fabsf(gyro_yaw(&gyro) - yaw) < 1e-5f);
+    CHECK(fabsf(gyro.bias - 14.0f) < 1.0f); // tracked at rest, not pulled away by the turn
+    CHECK(gyro.dropped == 0);
+
+    /* the yaw only depends on the order of the samples, not on when
+     * gyro_update takes them (up to the rounding of the sums) */
+    gyro_t chunked;
+    gyro_init(&chunked, RATE_HZ, DPS_PER_LSB);
+    CHECK(fabsf(replay(&chunked, 0, RECORDING_LENGTH, GYRO_RING) - yaw) < 1e-5f);
+    CHECK(chunked.bias == gyro.bias);
+
+    /* without gyro_update the ring fills up and drops the newest samples */
+    gyro_t full;
+    gyro_init(&full, RATE_HZ, DPS_PER_LSB);
+    for (int i = 0; i < GYRO_RING + 3; i++)
+    {
+        const gyro_sample_t sample = { .x = 0, .y = g_recording[i], .z = 0 };
+        CHECK(gyro_push(&full, &sample) == (i < GYRO_RING));
+    }
+    CHECK(full.dropped == 3);
+
+    /* turning around more than four times keeps gyro_yaw in [-pi, pi] */
+    for (int k = 0; k < 20; k++)
+    {
+        replay(&gyro, GYRO_CALIBRATION, RECORDING_LENGTH, 1);
+    }
+    CHECK(gyro_yaw(&gyro) >= -M_PI_F && gyro_yaw(&gyro) <= M_PI_F);
+
+    return test_result("gyro");
+}
@@ -0,0 +1,151 @@
+/*
+ * Host test of the minimap (Core/Raycaster/hud.c): on e1m1 the player opens
+ * a door and walks into the next cell, and after each step hud_map must
+ * have drawn exactly the cells that look different, nothing else. Cells
+ * the layer did not get drawn keep a marker color the test paints over the
+ * layer before each step.
+ *
+ * Usage:
+ *   make -C tests
+ */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "hud.c" /* the cell colors are internal to the HUD */
+#include "sdl_scancodes.h"
+#include "e1m1.h"
+#include "test.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define MARKER 0x12345678u /**< painted over the layer, never a cell color */
+
+/* LOCAL DATA --------------------------------------------------------------- */
+static uint32_t g_pixels[HUD_MAP_SIZE * HUD_MAP_SIZE];
+static uint32_t g_fb[WIDTH * HEIGHT];
+static hud_layer_t g_layer;
+static hud_minimap_t g_map;
+static gamestate_t g_game;
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** True if all pixels of cell (col, row) of the minimap are color */
+static bool cellis(int col, int row, uint32_t color)
+{
+    for (int y = 0; y < HUD_MAP_CELL; y++)
+        for (int x = 0; x < HUD_MAP_CELL; x++)
+            if (g_pixels[(row * HUD_MAP_CELL + y) * HUD_MAP_SIZE + col * HUD_MAP_CELL + x] != color)
+                return false;
+    return true;
+}
+
+/** Paint the marker over the layer, call hud_map and check that it drew
+ *  exactly the cells whose color changed. Returns the number of those. */
+static int redraw(void)
+{
+    uint32_t before[HUD_MAP_CELLS * HUD_MAP_CELLS];
+    memcpy(before, g_map.color, sizeof(before));
+    for (int i = 0; i < HUD_MAP_SIZE * HUD_MAP_SIZE; i++)
+        g_pixels[i] = MARKER;
+
+    const bool changed = hud_map(&g_map, &g_game);
+    int count = 0;
+    for (int row = 0; row < HUD_MAP_CELLS; row++)
+    {
+        for (int col = 0; col < HUD_MAP_CELLS; col++)
+        {
+            const uint32_t color = g_map.color[row * HUD_MAP_CELLS + col];
+            if (color != before[row * HUD_MAP_CELLS + col])
+            {
+                CHECK(cellis(col, row, color));
+                count++;
+            }
+            else
+            {
+                CHECK(cellis(col, row, MARKER));
+            }
+        }
+    }
+    CHECK(changed == (count > 0));
+    return count;
+}
+
+/** Find a door with a floor cell west of it, false if there is none */
+static bool finddoor(int* x, int* y)
+{
+    const level_t* level = &g_game.level;
+    for (int j = 0; j < level->height; j++)
+    {
+        for (int i = 1; i < level->width; i++)
+        {
+            const level_block_t* block = lvl_block(level, lvl_cell(level, i, j));
+            if (block && block->type == LEVEL_BLOCK_DOOR && lvl_cell(level, i - 1, j) == 0)
+            {
+                *x = i;
+                *y = j;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int main(void)
+{
+    int dx = 0, dy = 0;
+    CHECK(lvl_load(&g_game.level, m_e1m1, sizeof(m_e1m1)));
+    CHECK(finddoor(&dx, &dy));
+    if (g_test_failures)
+        return test_result("test_hud");
+
+    // in front of the door, facing east
+    g_game.player_pos = (vertex_t){ .n = dy + 0.5f, .e = dx - 0.5f };
+    g_game.player_dir = (vertex_t){ .n = 0.0f, .e = 1.0f };
+    lvl_stream(&g_game.level, g_game.player_pos.e, g_game.player_pos.n);
+
+    hud_layerinit(&g_layer, g_pixels, 0, 0, HUD_MAP_SIZE, HUD_MAP_SIZE);
+    hud_mapinit(&g_map, &g_layer, 0, 0);
+
+    // the first call draws every cell
+    CHECK(hud_map(&g_map, &g_game));
+    for (int row = 0; row < HUD_MAP_CELLS; row++)
+        for (int col = 0; col < HUD_MAP_CELLS; col++)
+            CHECK(cellis(col, row, g_map.color[row * HUD_MAP_CELLS + col]));
+    const int col = dx - g_map.x0;
+    const int row = g_map.y0 + HUD_MAP_CELLS - 1 - dy;
+    CHECK(g_map.color[row * HUD_MAP_CELLS + col] == HUD_DOOR);
+    CHECK(g_map.color[row * HUD_MAP_CELLS + col - 1] == HUD_PLAYER);
+
+    // nothing moved: nothing drawn
+    CHECK(redraw() == 0);
+
+    // open the door: only its cells change
+    uint8_t kb[SDL_NUM_SCANCODES] = { 0 };
+    kb[SDL_SCANCODE_SPACE] = 1;
+    g_update(0.1f, kb, &g_game);
+    CHECK(g_game.level.door_open[lvl_cell(&g_game.level, dx, dy)] > 0);
+    CHECK(redraw() >= 1); // all cells of the door block
+    CHECK(g_map.color[row * HUD_MAP_CELLS + col] == HUD_DOOR_OPEN);
+
+    // step into the door: the old and the new player cell change
+    g_game.player_pos.e += 1.0f;
+    CHECK(redraw() == 2);
+    CHECK(g_map.color[row * HUD_MAP_CELLS + col] == HUD_PLAYER);
+    CHECK(g_map.color[row * HUD_MAP_CELLS + col - 1] == HUD_FLOOR);
+
+    // the composite shows the player cell opaque and leaves the frame
+    // around the minimap alone
+    for (int i = 0; i < WIDTH * HEIGHT; i++)
+        g_fb[i] = 0xff203040;
+    g_layer.x = WIDTH - HUD_MAP_SIZE;
+    hud_composite(g_fb, &g_layer);
+    CHECK(g_fb[(row * HUD_MAP_CELL + 1) * WIDTH + g_layer.x + col * HUD_MAP_CELL + 1] == HUD_PLAYER);
+    CHECK(g_fb[HUD_MAP_SIZE * WIDTH] == 0xff203040);
+    CHECK(g_fb[g_layer.x - 1] == 0xff203040);
+
+    return test_result("test_hud");
+}
@@ -0,0 +1,116 @@
+/*
+ * Host test of the touch zones (Core/Raycaster/input.c): touches the first
+ * and the last pixel of every zone and checks the keys in_keys sets for
+ * g_update, then the lift, positions off the screen and the state before
+ * the first touch.
+ *
+ * Usage:
+ *   make -C tests
+ */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "input.h"
+#include "engine.h"
+#include "sdl_scancodes.h"
+#include "test.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#if IN_ZONES != 3
+#error "g_zones expects 3 x 3 touch zones"
+#endif
+
+#define UNTOUCHED 7 /**< kb value of keys in_keys must not write */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Keys held by a touch zone */
+typedef struct
+{
+    bool w, s, a, d, space;
+} keys_t;
+
+/* LOCAL DATA --------------------------------------------------------------- */
+
+/** Keys of each zone, row 0 is the top of the screen */
+static const keys_t g_zones[IN_ZONES][IN_ZONES] = {
+    { { .w = true, .a = true }, { .w = true }, { .w = true, .d = true } },
+    { { .a = true }, { .space = true }, { .d = true } },
+    { { .s = true, .a = true }, { .s = true }, { .s = true, .d = true } },
+};
+
+static uint8_t g_kb[SDL_NUM_SCANCODES];
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** True if in_keys sets exactly the keys k in g_kb and leaves the others */
+static bool haskeys(keys_t k)
+{
+    memset(g_kb, UNTOUCHED, sizeof(g_kb));
+    in_keys(g_kb);
+    bool ok = g_kb[SDL_SCANCODE_W] == k.w && g_kb[SDL_SCANCODE_S] == k.s &&
+              g_kb[SDL_SCANCODE_A] == k.a && g_kb[SDL_SCANCODE_D] == k.d &&
+              g_kb[SDL_SCANCODE_SPACE] == k.space;
+    for (int i = 0; i < SDL_NUM_SCANCODES; i++)
+    {
+        if (i != SDL_SCANCODE_W && i != SDL_SCANCODE_S && i != SDL_SCANCODE_A &&
+            i != SDL_SCANCODE_D && i != SDL_SCANCODE_SPACE)
+            ok = ok && g_kb[i] == UNTOUCHED;
+    }
+    return ok;
+}
+
+/** First pixel of zone i of IN_ZONES over size pixels */
+static int zonestart(int i, int size)
+{
+    return (i * size + IN_ZONES - 1) / IN_ZONES;
+}
+
+int main(void)
+{
+    const keys_t none = { 0 };
+
+    // no touch reported yet: the keys are left alone
+    memset(g_kb, UNTOUCHED, sizeof(g_kb));
+    in_keys(g_kb);
+    for (int i = 0; i < SDL_NUM_SCANCODES; i++)
+        CHECK(g_kb[i] == UNTOUCHED);
+
+    for (int row = 0; row < IN_ZONES; row++)
+    {
+        for (int col = 0; col < IN_ZONES; col++)
+        {
+            const int x0 = zonestart(col, WIDTH), x1 = zonestart(col + 1, WIDTH) - 1;
+            const int y0 = zonestart(row, HEIGHT), y1 = zonestart(row + 1, HEIGHT) - 1;
+            in_touch(true, x0, y0);
+            CHECK(haskeys(g_zones[row][col]));
+            in_touch(true, x1, y1);
+            CHECK(haskeys(g_zones[row][col]));
+            in_touch(true, (x0 + x1) / 2, (y0 + y1) / 2);
+            CHECK(haskeys(g_zones[row][col]));
+        }
+    }
+
+    // lifting releases every key, the position is kept
+    in_touch(true, WIDTH / 2, HEIGHT / 2);
+    in_touch(false, -1, -1);
+    CHECK(haskeys(none));
+    CHECK(!in_state()->down);
+    CHECK(in_state()->x == WIDTH / 2 && in_state()->y == HEIGHT / 2);
+
+    // positions off the screen are clamped to the zones at its edge
+    in_touch(true, -50, HEIGHT + 100);
+    CHECK(in_state()->x == 0 && in_state()->y == HEIGHT - 1);
+    CHECK(haskeys(g_zones[IN_ZONES - 1][0]));
+    in_touch(true, WIDTH, -1);
+    CHECK(in_state()->x == WIDTH - 1 && in_state()->y == 0);
+    CHECK(haskeys(g_zones[0][IN_ZONES - 1]));
+
+    CHECK(in_state()->reports == IN_ZONES * IN_ZONES * 3 + 4);
+    return test_result("test_input");
+}
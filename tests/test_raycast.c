@@ -0,0 +1,205 @@
+/*
+ * Host test of the ray traversal (Core/Raycaster/engine.c): casts the rays
+ * of every column for a set of poses on e1m1 and bench and checks that the
+ * leaps over empty space (distance field, occupancy pyramid) give the same
+ * hits as walking every cell: block, travel f and normal of each hit.
+ *
+ * Built twice: with -DDISTANCE_FIELD_DISABLED it writes a hash of the hits
+ * of each pose of the plain DDA to the file given as argument, without it
+ * compares the leaps against a level without distance field and pyramid
+ * column by column and against that file pose by pose.
+ *
+ * Usage:
+ *   make -C tests
+ */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "engine.c" /* r_castcolumn and r_hit_t are internal to the renderer */
+#include "e1m1.h"
+#include "bench.h"
+#include "test.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define POSE_YAWS 8 /**< view directions per position */
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Level variant with parts of its file removed */
+typedef enum
+{
+    SKIP_AS_LOADED, /**< distance field (and pyramid) */
+    SKIP_PYRAMID,   /**< no distance field: the pyramid drives the leaps */
+    SKIP_NONE,      /**< neither: every cell is walked */
+    SKIP_COUNT
+} skip_t;
+
+/* LOCAL DATA --------------------------------------------------------------- */
+static uint32_t g_file[SKIP_COUNT][4096];
+static level_t g_level[SKIP_COUNT];
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+
+/** Load a copy of a level file without the parts skip removes */
+static bool load(skip_t skip, const uint8_t* data, uint32_t size)
+{
+    if (size > sizeof(g_file[skip]))
+        return false;
+    memcpy(g_file[skip], data, size);
+    level_header_t* h = (level_header_t*)g_file[skip];
+    if (skip != SKIP_AS_LOADED)
+        h->dist_offset = 0;
+    if (skip == SKIP_NONE)
+        h->pyramid_levels = 0;
+    return lvl_load(&g_level[skip], g_file[skip], size);
+}
+
+/** True if the two columns have the same hits */
+static bool samehits(const r_column_t* a, const r_column_t* b)
+{
+    if (a->count != b->count)
+        return false;
+    for (int i = 0; i < a->count; i++)
+    {
+        const r_hit_t* p = &a->hits[i];
+        const r_hit_t* q = &b->hits[i];
+        if (p->block != q->block || p->f != q->f || p->exit != q->exit ||
+            p->eNormal != q->eNormal || p->nNormal != q->nNormal)
+            return false;
+    }
+    return true;
+}
+
+/** Fold the hits of a column into hash (FNV-1a) */
+static uint32_t hashhits(uint32_t hash, const r_column_t* col)
+{
+    for (int i = 0; i < col->count; i++)
+    {
+        const r_hit_t* h = &col->hits[i];
+        uint32_t f, exit;
+        memcpy(&f, &h->f, sizeof(f));
+        memcpy(&exit, &h->exit, sizeof(exit));
+        const uint32_t words[] = { h->block, f, exit, (uint32_t)(h->eNormal + 1) << 2 | (uint32_t)(h->nNormal + 1) };
+        for (size_t k = 0; k < sizeof(words) / sizeof(words[0]); k++)
+        {
+            hash = (hash ^ words[k]) * 16777619u;
+        }
+    }
+    return (hash ^ col->count) * 16777619u;
+}
+
+/** Cast the columns of all poses of a level: POSE_YAWS directions from two
+ *  points in every empty cell. Writes the hash of the hits of each pose of
+ *  the first variant to out or compares it with the one read from in, if
+ *  not NULL. Returns the number of columns cast. */
+static long castlevel(const char* name, const uint8_t* data, uint32_t size, FILE* out, FILE* in)
+{
+    const float colangle = FOV / WIDTH * M_PI_F / 180.0f;
+#ifdef DISTANCE_FIELD_DISABLED
+    const int variants = 1; // the leaps are compiled out
+#else
+    const int variants = SKIP_COUNT;
+#endif
+    long columns = 0;
+    int mismatches = 0;
+
+    for (int v = 0; v < variants; v++)
+    {
+        CHECK(load((skip_t)v, data, size));
+    }
+    const level_t* level = &g_level[0];
+    for (int y = 0; y < level->height; y++)
+    {
+        for (int x = 0; x < level->width; x++)
+        {
+            if (lvl_cell(level, x, y) != 0)
+                continue;
+            for (int p = 0; p < 2; p++)
+            {
+                const vertex_t pos = { .n = y + (p ? 0.75f : 0.5f), .e = x + (p ? 0.3f : 0.5f) };
+                for (int k = 0; k < POSE_YAWS; k++)
+                {
+                    const int yaw = k * RAYS_PER_TURN / POSE_YAWS + p; // also between the axes
+                    uint32_t hash = 2166136261u;
+                    for (int column = 0; column < WIDTH; column++, columns++)
+                    {
+                        const float angle = (yaw - WIDTH / 2 + column) * colangle;
+                        const vertex_t target = { .n = pos.n + cosf(angle) * 100.0f, .e = pos.e + sinf(angle) * 100.0f };
+                        r_column_t col[SKIP_COUNT];
+                        for (int v = 0; v < variants; v++)
+                        {
+                            memset(&col[v], 0, sizeof(col[v]));
+                            r_castcolumn(&g_level[v], pos, target, &col[v], NULL);
+                        }
+                        bool same = true;
+                        for (int v = 1; v < variants; v++)
+                        {
+                            same = same && samehits(&col[v], &col[SKIP_NONE]);
+                        }
+                        hash = hashhits(hash, &col[0]);
+                        if (!same && mismatches++ < 8)
+                        {
+                            fprintf(stderr, "%s: hits differ at %.2f %.2f yaw %d column %d\n",
+                                    name, pos.e, pos.n, yaw, column);
+                        }
+                    }
+                    if (out)
+                    {
+                        fwrite(&hash, sizeof(hash), 1, out);
+                    }
+                    uint32_t dda;
+                    if (in && (fread(&dda, sizeof(dda), 1, in) != 1 || dda != hash) && mismatches++ < 8)
+                    {
+                        fprintf(stderr, "%s: hits differ from the plain DDA at %.2f %.2f yaw %d\n",
+                                name, pos.e, pos.n, yaw);
+                    }
+                }
+            }
+        }
+    }
+    CHECK(mismatches == 0);
+    return columns;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s hits.bin\n", argv[0]);
+        return 2;
+    }
+#ifdef DISTANCE_FIELD_DISABLED
+    FILE* out = fopen(argv[1], "wb");
+    FILE* in = NULL;
+    CHECK(out != NULL);
+#else
+    FILE* out = NULL;
+    FILE* in = fopen(argv[1], "rb");
+    CHECK(in != NULL);
+#endif
+    if (out || in)
+    {
+        const long columns = castlevel("e1m1", m_e1m1, sizeof(m_e1m1), out, in) +
+                             castlevel("bench", m_bench, sizeof(m_bench), out, in);
+        printf("%ld columns\n", columns);
+        if (in)
+        {
+            CHECK(fgetc(in) == EOF); // both builds cast the same columns
+            fclose(in);
+        }
+        if (out)
+        {
+            fclose(out);
+        }
+    }
+#ifdef DISTANCE_FIELD_DISABLED
+    return test_result("raycast (plain DDA)");
+#else
+    return test_result("raycast");
+#endif
+}
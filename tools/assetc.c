@@ -0,0 +1,1215 @@
+/*
+ * Asset compiler: converts BMP and PNG images into an asset pack (see
+ * Core/Raycaster/asset.h). All images are packed into a single texture
+ * atlas in the runtime format of the engine: chosen pixel format,
+ * column-major layout and a complete mip chain. For TEXTURE_I8 a shared
+ * palette for all textures is computed (median cut, refined with a few
+ * k-means iterations).
+ *
+ * Usage:
+ *   assetc [options] name=image ... -o pack.bin          write binary pack
+ *   assetc [options] name=image ... -c pack.h name       write C header
+ *   assetc -i pack.bin                                   list pack contents
+ *
+ * Options for the atlas:
+ *   -f argb8888|rgb565|l8|i8  texel format (default argb8888)
+ *   -m levels                 max. number of mip levels (default 8)
+ *   -z lz4|none               compression (default none), an atlas that
+ *                             does not get smaller is stored uncompressed
+ * Options that apply to all following images:
+ *   -k rrggbb                 colour key, texels of this colour are transparent
+ *   -k none                   no colour key (default)
+ *   -a frames ms              animation: the image is a strip of frames of
+ *                             equal width side by side, shown ms each
+ *   -a none                   still image (default)
+ *
+ * Supported inputs: uncompressed 24/32 bit BMP and 8 bit PNG (grey, RGB,
+ * palette, grey+alpha, RGBA, not interlaced).
+ */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "asset.h"
+#include "tools.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define MAX_ASSETS 255 /**< textures in the atlas */
+#define KMEANS_ITERATIONS 4
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** Decoded image, row-major top row first, 0xAARRGGBB */
+typedef struct
+{
+    int width;
+    int height;
+    uint32_t* pixels;
+} image_t;
+
+typedef struct
+{
+    char name[ASSET_NAME_LENGTH];
+    const char* path;
+    int64_t colorkey; /**< 0xRRGGBB or -1 */
+    int frames;       /**< animation frames side by side in the image, >= 1 */
+    int period;       /**< milliseconds per animation frame */
+} input_t;
+
+typedef struct
+{
+    int format;
+    int maxlevels;
+    int compression; /**< ASSET_RAW or ASSET_LZ4 */
+} options_t;
+
+/** Vertical strip of the atlas, textures are stacked top to bottom */
+typedef struct
+{
+    int u;
+    int width;
+    int used; /**< rows in use */
+} strip_t;
+
+/** Bit reader for inflate */
+typedef struct
+{
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    uint32_t bits;
+    int count;
+} bits_t;
+
+/** Canonical Huffman decoding table */
+typedef struct
+{
+    uint16_t count[16];
+    uint16_t symbol[320];
+} huffman_t;
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+static uint8_t* read_file(const char* path, size_t* size)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t* data = malloc(*size);
+    if (fread(data, 1, *size, f) != *size)
+    {
+        fprintf(stderr, "Failed to read %s\n", path);
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+static uint32_t le16(const uint8_t* p) { return (uint32_t)(p[0] | (p[1] << 8)); }
+static uint32_t le32(const uint8_t* p) { return le16(p) | (le16(p + 2) << 16); }
+static uint32_t be32(const uint8_t* p) { return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]; }
+
+/* BMP ---------------------------------------------------------------------- */
+static bool load_bmp(const char* path, const uint8_t* data, size_t size, image_t* img)
+{
+    if (size < 54 || data[0] != 'B' || data[1] != 'M')
+        return false;
+
+    const uint32_t offset = le32(data + 10);
+    const int32_t width = (int32_t)le32(data + 18);
+    const int32_t height = (int32_t)le32(data + 22);
+    const uint32_t bpp = le16(data + 28);
+    const uint32_t compression = le32(data + 30);
+    const bool bottomup = height > 0;
+    const int h = bottomup ? height : -height;
+
+    /* 3 = BI_BITFIELDS, accepted for 32 bit files with the usual BGRA masks */
+    if ((bpp != 24 && bpp != 32) || (compression != 0 && compression != 3) || width < 1 || h < 1)
+    {
+        fprintf(stderr, "%s: only uncompressed 24/32 bit BMP files are supported\n", path);
+        return false;
+    }
+    const size_t stride = ((size_t)width * bpp / 8 + 3) & ~(size_t)3;
+    if (offset + stride * h > size)
+    {
+        fprintf(stderr, "%s: truncated BMP file\n", path);
+        return false;
+    }
+
+    img->width = width;
+    img->height = h;
+    img->pixels = malloc(sizeof(uint32_t) * width * h);
+    for (int y = 0; y < h; y++)
+    {
+        const uint8_t* row = data + offset + stride * (bottomup ? h - 1 - y : y);
+        for (int x = 0; x < width; x++)
+        {
+            const uint8_t* p = row + x * (bpp / 8);
+            const uint32_t a = (bpp == 32) ? p[3] : 0xff;
+            img->pixels[y * width + x] = (a << 24) | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+        }
+    }
+    return true;
+}
+
+/* PNG ---------------------------------------------------------------------- */
+static int getbits(bits_t* s, int n)
+{
+    while (s->count < n)
+    {
+        if (s->pos >= s->size)
+            return -1;
+        s->bits |= (uint32_t)s->data[s->pos++] << s->count;
+        s->count += 8;
+    }
+    const int v = (int)(s->bits & ((1u << n) - 1));
+    s->bits >>= n;
+    s->count -= n;
+    return v;
+}
+
+static void huffman_build(huffman_t* h, const uint8_t* lengths, int n)
+{
+    uint16_t offs[16];
+
+    memset(h->count, 0, sizeof(h->count));
+    for (int i = 0; i < n; i++)
+    {
+        h->count[lengths[i]]++;
+    }
+    h->count[0] = 0;
+    offs[1] = 0;
+    for (int i = 1; i < 15; i++)
+    {
+        offs[i + 1] = offs[i] + h->count[i];
+    }
+    for (int i = 0; i < n; i++)
+    {
+        if (lengths[i])
+        {
+            h->symbol[offs[lengths[i]]++] = (uint16_t)i;
+        }
+    }
+}
+
+static int huffman_decode(bits_t* s, const huffman_t* h)
+{
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len < 16; len++)
+    {
+        const int bit = getbits(s, 1);
+        if (bit < 0)
+            return -1;
+        code |= bit;
+        const int count = h->count[len];
+        if (code - count < first)
+            return h->symbol[index + (code - first)];
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+/** Decode one compressed block using the given literal/length and
+ *  distance codes. */
+static bool inflate_codes(bits_t* s, buffer_t* out, const huffman_t* lencode, const huffman_t* distcode)
+{
+    static const uint16_t lbase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const uint8_t lextra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const uint16_t dbase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                        8193, 12289, 16385, 24577 };
+    static const uint8_t dextra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    for (;;)
+    {
+        int sym = huffman_decode(s, lencode);
+        if (sym < 0)
+            return false;
+        if (sym < 256)
+        {
+            const uint8_t c = (uint8_t)sym;
+            buf_append(out, &c, 1);
+        }
+        else if (sym == 256)
+        {
+            return true;
+        }
+        else
+        {
+            sym -= 257;
+            if (sym >= 29)
+                return false;
+            const int len = lbase[sym] + getbits(s, lextra[sym]);
+            const int dsym = huffman_decode(s, distcode);
+            if (dsym < 0 || dsym >= 30)
+                return false;
+            const size_t dist = dbase[dsym] + (size_t)getbits(s, dextra[dsym]);
+            if (dist > out->size)
+                return false;
+            for (int i = 0; i < len; i++)
+            {
+                const uint8_t c = out->data[out->size - dist];
+                buf_append(out, &c, 1);
+            }
+        }
+    }
+}
+
+/** Minimal zlib decoder (RFC 1950/1951), no dictionary support */
+static bool inflate(const uint8_t* data, size_t size, buffer_t* out)
+{
+    bits_t s = { data, size, 2, 0, 0 }; // skip zlib header
+    huffman_t lencode, distcode;
+    uint8_t lengths[320];
+    int last;
+
+    if (size < 2 || (data[0] & 0x0f) != 8 || (data[1] & 0x20))
+        return false;
+    do
+    {
+        last = getbits(&s, 1);
+        const int type = getbits(&s, 2);
+        if (type == 0) // stored
+        {
+            s.bits = 0;
+            s.count = 0;
+            if (s.pos + 4 > size)
+                return false;
+            const size_t len = le16(data + s.pos);
+            s.pos += 4;
+            if (s.pos + len > size)
+                return false;
+            buf_append(out, data + s.pos, len);
+            s.pos += len;
+        }
+        else if (type == 1) // fixed codes
+        {
+            for (int i = 0; i < 288; i++)
+            {
+                lengths[i] = (uint8_t)(i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8);
+            }
+            huffman_build(&lencode, lengths, 288);
+            memset(lengths, 5, 30);
+            huffman_build(&distcode, lengths, 30);
+            if (!inflate_codes(&s, out, &lencode, &distcode))
+                return false;
+        }
+        else if (type == 2) // dynamic codes
+        {
+            static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+            const int nlen = getbits(&s, 5) + 257;
+            const int ndist = getbits(&s, 5) + 1;
+            const int ncode = getbits(&s, 4) + 4;
+            huffman_t codecode;
+
+            if (nlen > 286 || ndist > 30)
+                return false;
+            memset(lengths, 0, sizeof(lengths));
+            for (int i = 0; i < ncode; i++)
+            {
+                lengths[order[i]] = (uint8_t)getbits(&s, 3);
+            }
+            huffman_build(&codecode, lengths, 19);
+            for (int i = 0; i < nlen + ndist;)
+            {
+                int sym = huffman_decode(&s, &codecode);
+                int repeat = 0;
+                uint8_t value = 0;
+                if (sym < 0)
+                    return false;
+                if (sym < 16)
+                {
+                    lengths[i++] = (uint8_t)sym;
+                    continue;
+                }
+                if (sym == 16)
+                {
+                    if (i == 0)
+                        return false;
+                    value = lengths[i - 1];
+                    repeat = 3 + getbits(&s, 2);
+                }
+                else if (sym == 17)
+                {
+                    repeat = 3 + getbits(&s, 3);
+                }
+                else
+                {
+                    repeat = 11 + getbits(&s, 7);
+                }
+                if (i + repeat > nlen + ndist)
+                    return false;
+                while (repeat--)
+                {
+                    lengths[i++] = value;
+                }
+            }
+            huffman_build(&lencode, lengths, nlen);
+            huffman_build(&distcode, lengths + nlen, ndist);
+            if (!inflate_codes(&s, out, &lencode, &distcode))
+                return false;
+        }
+        else
+        {
+            return false;
+        }
+    } while (last == 0);
+    return true;
+}
+
+static int paeth(int a, int b, int c)
+{
+    const int p = a + b - c;
+    const int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+}
+
+static bool load_png(const char* path, const uint8_t* data, size_t size, image_t* img)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    static const int channels[7] = { 1, 0, 3, 1, 2, 0, 4 };
+    uint32_t palette[256];
+    buffer_t idat = { 0 }, raw = { 0 };
+    int width = 0, height = 0, type = -1;
+    bool ok = false;
+
+    if (size < 8 || memcmp(data, signature, 8) != 0)
+        return false;
+    for (int i = 0; i < 256; i++)
+    {
+        palette[i] = 0xff000000;
+    }
+
+    for (size_t pos = 8; pos + 12 <= size;)
+    {
+        const uint32_t len = be32(data + pos);
+        const uint8_t* chunk = data + pos + 8;
+        if (pos + 12 + len > size)
+            break;
+        if (memcmp(data + pos + 4, "IHDR", 4) == 0 && len >= 13)
+        {
+            width = (int)be32(chunk);
+            height = (int)be32(chunk + 4);
+            type = chunk[9];
+            if (chunk[8] != 8 || chunk[12] != 0 || type > 6 || channels[type] == 0)
+            {
+                fprintf(stderr, "%s: only 8 bit, not interlaced PNG files are supported\n", path);
+                goto done;
+            }
+        }
+        else if (memcmp(data + pos + 4, "PLTE", 4) == 0)
+        {
+            for (uint32_t i = 0; i < len / 3 && i < 256; i++)
+            {
+                palette[i] = 0xff000000 | ((uint32_t)chunk[3 * i] << 16) | ((uint32_t)chunk[3 * i + 1] << 8) | chunk[3 * i + 2];
+            }
+        }
+        else if (memcmp(data + pos + 4, "tRNS", 4) == 0 && type == 3)
+        {
+            for (uint32_t i = 0; i < len && i < 256; i++)
+            {
+                palette[i] = (palette[i] & 0x00ffffff) | ((uint32_t)chunk[i] << 24);
+            }
+        }
+        else if (memcmp(data + pos + 4, "IDAT", 4) == 0)
+        {
+            buf_append(&idat, chunk, len);
+        }
+        else if (memcmp(data + pos + 4, "IEND", 4) == 0)
+        {
+            break;
+        }
+        pos += 12 + len;
+    }
+
+    if (width < 1 || height < 1 || !inflate(idat.data, idat.size, &raw))
+    {
+        fprintf(stderr, "%s: invalid PNG file\n", path);
+        goto done;
+    }
+
+    const int bpp = channels[type];
+    const size_t stride = (size_t)width * bpp;
+    if (raw.size < (stride + 1) * height)
+    {
+        fprintf(stderr, "%s: truncated PNG image data\n", path);
+        goto done;
+    }
+
+    /* undo the per-row filters in place */
+    uint8_t* prev = NULL;
+    for (int y = 0; y < height; y++)
+    {
+        uint8_t* row = raw.data + y * (stride + 1);
+        const int filter = row[0];
+        row++;
+        for (size_t i = 0; i < stride; i++)
+        {
+            const int a = (i >= (size_t)bpp) ? row[i - bpp] : 0;
+            const int b = prev ? prev[i] : 0;
+            const int c = (prev && i >= (size_t)bpp) ? prev[i - bpp] : 0;
+            switch (filter)
+            {
+            case 1: row[i] = (uint8_t)(row[i] + a); break;
+            case 2: row[i] = (uint8_t)(row[i] + b); break;
+            case 3: row[i] = (uint8_t)(row[i] + ((a + b) >> 1)); break;
+            case 4: row[i] = (uint8_t)(row[i] + paeth(a, b, c)); break;
+            default: break;
+            }
+        }
+        prev = row;
+    }
+
+    img->width = width;
+    img->height = height;
+    img->pixels = malloc(sizeof(uint32_t) * width * height);
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t* row = raw.data + y * (stride + 1) + 1;
+        for (int x = 0; x < width; x++)
+        {
+            const uint8_t* p = row + x * bpp;
+            uint32_t argb;
+            switch (type)
+            {
+            case 0:  argb = 0xff000000 | (uint32_t)p[0] * 0x010101u; break;
+            case 2:  argb = 0xff000000 | ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2]; break;
+            case 3:  argb = palette[p[0]]; break;
+            case 4:  argb = ((uint32_t)p[1] << 24) | (uint32_t)p[0] * 0x010101u; break;
+            default: argb = ((uint32_t)p[3] << 24) | ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2]; break;
+            }
+            img->pixels[y * width + x] = argb;
+        }
+    }
+    ok = true;
+
+done:
+    free(idat.data);
+    free(raw.data);
+    return ok;
+}
+
+static bool load_image(const char* path, image_t* img)
+{
+    size_t size;
+    uint8_t* data = read_file(path, &size);
+    bool ok = false;
+
+    if (!data)
+        return false;
+    if (size >= 2 && data[0] == 'B' && data[1] == 'M')
+    {
+        ok = load_bmp(path, data, size, img);
+    }
+    else if (size >= 8 && data[0] == 0x89 && data[1] == 'P')
+    {
+        ok = load_png(path, data, size, img);
+    }
+    else
+    {
+        fprintf(stderr, "%s: unknown image format\n", path);
+    }
+    free(data);
+    return ok;
+}
+
+/* Conversion --------------------------------------------------------------- */
+
+/** 2x2 box filter, transparent texels do not contribute to the average.
+ *  The result is transparent only if all four source texels are. */
+static void downsample(const image_t* src, image_t* dst)
+{
+    dst->width = src->width / 2;
+    dst->height = src->height / 2;
+    dst->pixels = malloc(sizeof(uint32_t) * dst->width * dst->height);
+    for (int y = 0; y < dst->height; y++)
+    {
+        for (int x = 0; x < dst->width; x++)
+        {
+            uint32_t sum[4] = { 0 };
+            int n = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                const uint32_t p = src->pixels[(2 * y + i / 2) * src->width + 2 * x + i % 2];
+                if ((p >> 24) == 0)
+                    continue;
+                for (int c = 0; c < 4; c++)
+                {
+                    sum[c] += (p >> (8 * c)) & 0xff;
+                }
+                n++;
+            }
+            uint32_t out = 0;
+            for (int c = 0; n > 0 && c < 4; c++)
+            {
+                out |= ((sum[c] + n / 2) / n) << (8 * c);
+            }
+            dst->pixels[y * dst->width + x] = out;
+        }
+    }
+}
+
+/* Palette ------------------------------------------------------------------ */
+static int g_channel; /**< sort key of cmp_channel: bit shift of the colour channel */
+
+static int cmp_channel(const void* a, const void* b)
+{
+    const int ca = (int)((*(const uint32_t*)a >> g_channel) & 0xff);
+    const int cb = (int)((*(const uint32_t*)b >> g_channel) & 0xff);
+    return ca - cb;
+}
+
+static int distance(uint32_t a, uint32_t b)
+{
+    const int dr = (int)((a >> 16) & 0xff) - (int)((b >> 16) & 0xff);
+    const int dg = (int)((a >> 8) & 0xff) - (int)((b >> 8) & 0xff);
+    const int db = (int)(a & 0xff) - (int)(b & 0xff);
+    return 3 * dr * dr + 4 * dg * dg + 2 * db * db;
+}
+
+/** Index of the palette entry 1..n-1 closest to colour p */
+static uint8_t nearest(const uint32_t* palette, int n, uint32_t p)
+{
+    int best = 1, bestdist = 0x7fffffff;
+    for (int i = 1; i < n; i++)
+    {
+        const int d = distance(palette[i], p);
+        if (d < bestdist)
+        {
+            best = i;
+            bestdist = d;
+        }
+    }
+    return (uint8_t)best;
+}
+
+/** Compute a palette for the opaque texels of img. Entry 0 is transparent.
+ *  Returns the number of used entries. */
+static int quantize(const image_t* img, uint32_t* palette)
+{
+    const int total = img->width * img->height;
+    uint32_t* colors = malloc(sizeof(uint32_t) * (total + 1));
+    int start[PALETTE_SIZE], count[PALETTE_SIZE];
+    int n = 0, boxes = 1;
+
+    for (int i = 0; i < total; i++)
+    {
+        if (img->pixels[i] >> 24)
+            colors[n++] = img->pixels[i] & 0xffffff;
+    }
+    memset(palette, 0, sizeof(uint32_t) * PALETTE_SIZE);
+    start[0] = 0;
+    count[0] = n;
+
+    /* median cut: split the box with the largest channel range */
+    while (n > 0 && boxes < PALETTE_SIZE - 1)
+    {
+        int best = -1, bestrange = 0, bestchannel = 0;
+        for (int b = 0; b < boxes; b++)
+        {
+            for (int c = 0; c < 24; c += 8)
+            {
+                int lo = 255, hi = 0;
+                for (int i = start[b]; i < start[b] + count[b]; i++)
+                {
+                    const int v = (int)((colors[i] >> c) & 0xff);
+                    lo = tools_min(lo, v);
+                    hi = tools_max(hi, v);
+                }
+                if (hi - lo > bestrange)
+                {
+                    best = b;
+                    bestrange = hi - lo;
+                    bestchannel = c;
+                }
+            }
+        }
+        if (best < 0)
+            break; // all boxes contain a single colour
+        g_channel = bestchannel;
+        qsort(&colors[start[best]], (size_t)count[best], sizeof(uint32_t), cmp_channel);
+        const int half = count[best] / 2;
+        start[boxes] = start[best] + half;
+        count[boxes] = count[best] - half;
+        count[best] = half;
+        boxes++;
+    }
+    for (int b = 0; b < boxes && n > 0; b++)
+    {
+        uint64_t sum[3] = { 0 };
+        for (int i = start[b]; i < start[b] + count[b]; i++)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                sum[c] += (colors[i] >> (8 * c)) & 0xff;
+            }
+        }
+        uint32_t p = 0xff000000;
+        for (int c = 0; c < 3; c++)
+        {
+            p |= (uint32_t)((sum[c] + count[b] / 2) / count[b]) << (8 * c);
+        }
+        palette[b + 1] = p;
+    }
+    const int used = (n > 0) ? boxes + 1 : 1;
+
+    /* refine with k-means */
+    for (int it = 0; it < KMEANS_ITERATIONS && n > 0; it++)
+    {
+        uint64_t sum[PALETTE_SIZE][4];
+        memset(sum, 0, sizeof(sum));
+        for (int i = 0; i < n; i++)
+        {
+            const int k = nearest(palette, used, colors[i]);
+            for (int c = 0; c < 3; c++)
+            {
+                sum[k][c] += (colors[i] >> (8 * c)) & 0xff;
+            }
+            sum[k][3]++;
+        }
+        for (int k = 1; k < used; k++)
+        {
+            if (sum[k][3] == 0)
+                continue;
+            uint32_t p = 0xff000000;
+            for (int c = 0; c < 3; c++)
+            {
+                p |= (uint32_t)((sum[k][c] + sum[k][3] / 2) / sum[k][3]) << (8 * c);
+            }
+            palette[k] = p;
+        }
+    }
+    free(colors);
+    return used;
+}
+
+/* Atlas -------------------------------------------------------------------- */
+
+/** Place all images in vertical strips of an atlas with the height of the
+ *  tallest image. Positions are multiples of align. */
+static void place(const image_t* images, int count, int align, int* u, int* v, int* width, int* height)
+{
+    strip_t* strips = calloc((size_t)count, sizeof(strip_t));
+    int* order = malloc(sizeof(int) * count);
+    int nstrips = 0;
+
+    *height = 0;
+    for (int i = 0; i < count; i++)
+    {
+        order[i] = i;
+        *height = tools_max(*height, images[i].height);
+    }
+    /* widest (then tallest) first, insertion sort keeps input order for ties */
+    for (int i = 1; i < count; i++)
+    {
+        const int o = order[i];
+        int j = i;
+        while (j > 0 && (images[order[j - 1]].width < images[o].width ||
+                         (images[order[j - 1]].width == images[o].width && images[order[j - 1]].height < images[o].height)))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = o;
+    }
+
+    *width = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const image_t* img = &images[order[i]];
+        int s = 0;
+        while (s < nstrips && (strips[s].width < img->width || strips[s].used + img->height > *height))
+        {
+            s++;
+        }
+        if (s == nstrips)
+        {
+            strips[s].u = *width;
+            strips[s].width = img->width;
+            strips[s].used = 0;
+            *width += (img->width + align - 1) / align * align;
+            nstrips++;
+        }
+        u[order[i]] = strips[s].u;
+        v[order[i]] = strips[s].used;
+        strips[s].used += (img->height + align - 1) / align * align;
+    }
+    free(strips);
+    free(order);
+}
+
+/** Append the image in column-major order in the given texel format */
+static void emit(buffer_t* out, const image_t* img, int format, const uint32_t* palette, int colors)
+{
+    for (int x = 0; x < img->width; x++)
+    {
+        for (int y = 0; y < img->height; y++)
+        {
+            const uint32_t p = img->pixels[y * img->width + x];
+            const uint32_t r = (p >> 16) & 0xff, g = (p >> 8) & 0xff, b = p & 0xff;
+            if (format == TEXTURE_ARGB8888)
+            {
+                const uint32_t texel = ((p >> 24) == 0) ? 0 : (p | 0xff000000);
+                buf_append(out, &texel, 4);
+            }
+            else if (format == TEXTURE_RGB565)
+            {
+                uint16_t texel = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+                if ((p >> 24) == 0)
+                    texel = 0xf81f;
+                else if (texel == 0xf81f)
+                    texel = 0xf81e; // keep opaque magenta opaque
+                buf_append(out, &texel, 2);
+            }
+            else if (format == TEXTURE_I8)
+            {
+                const uint8_t index = ((p >> 24) == 0) ? 0 : nearest(palette, colors, p);
+                buf_append(out, &index, 1);
+            }
+            else
+            {
+                const uint8_t l = (uint8_t)((77 * r + 150 * g + 29 * b + 128) >> 8);
+                buf_append(out, &l, 1);
+            }
+        }
+    }
+}
+
+static bool transparent(const image_t* img)
+{
+    for (int i = 0; i < img->width * img->height; i++)
+    {
+        if ((img->pixels[i] >> 24) == 0)
+            return true;
+    }
+    return false;
+}
+
+/** Append the span table of texture e (runs of opaque texels of every
+ *  column at every mip level, see texture_t) to spans. Returns false if the
+ *  table does not fit into 16 bit indices. */
+static bool spantable(const image_t* mips, int levels, const asset_entry_t* e, buffer_t* spans)
+{
+    const int width = e->width * e->frames; // the table covers all frames
+    int columns = 0;
+    for (int k = 0; k < levels; k++)
+    {
+        columns += width >> k;
+    }
+    uint32_t* index = malloc(sizeof(uint32_t) * (columns + 1));
+    buffer_t runs = { 0 };
+    int col = 0;
+    bool ok = true;
+
+    for (int k = 0; k < levels; k++)
+    {
+        const image_t* m = &mips[k];
+        const int u = e->u >> k, v = e->v >> k;
+        for (int x = 0; x < (width >> k); x++)
+        {
+            index[col++] = (uint32_t)(columns + 1 + runs.size / sizeof(uint16_t));
+            for (int y = 0; y < (e->height >> k);)
+            {
+                if ((m->pixels[(v + y) * m->width + u + x] >> 24) == 0)
+                {
+                    y++;
+                    continue;
+                }
+                const int start = y;
+                while (y < (e->height >> k) && (m->pixels[(v + y) * m->width + u + x] >> 24) != 0)
+                {
+                    y++;
+                }
+                const uint16_t run[2] = { (uint16_t)start, (uint16_t)(y - start) };
+                buf_append(&runs, run, sizeof(run));
+            }
+        }
+    }
+    index[col] = (uint32_t)(columns + 1 + runs.size / sizeof(uint16_t));
+    ok = index[col] <= 0xffff;
+    for (int i = 0; ok && i <= columns; i++)
+    {
+        const uint16_t idx = (uint16_t)index[i];
+        buf_append(spans, &idx, sizeof(idx));
+    }
+    if (ok)
+    {
+        buf_append(spans, runs.data, runs.size);
+    }
+    free(index);
+    free(runs.data);
+    return ok;
+}
+
+static bool load_input(const input_t* in, image_t* img)
+{
+    if (!load_image(in->path, img))
+        return false;
+    if (img->width > 0x7fff || img->height > 0x7fff)
+    {
+        fprintf(stderr, "%s: image too large\n", in->path);
+        free(img->pixels);
+        return false;
+    }
+    if (img->width % in->frames != 0)
+    {
+        fprintf(stderr, "%s: width is not a multiple of %i frames\n", in->path, in->frames);
+        free(img->pixels);
+        return false;
+    }
+    if (in->colorkey >= 0)
+    {
+        for (int i = 0; i < img->width * img->height; i++)
+        {
+            if ((img->pixels[i] & 0xffffff) == (uint32_t)in->colorkey)
+                img->pixels[i] = 0;
+        }
+    }
+    return true;
+}
+
+static uint8_t* compile(const input_t* inputs, int count, const options_t* opt, uint32_t* size)
+{
+    image_t* images = calloc((size_t)count, sizeof(image_t));
+    asset_entry_t* entries = calloc((size_t)count + 1, sizeof(asset_entry_t));
+    int* u = malloc(sizeof(int) * count);
+    int* v = malloc(sizeof(int) * count);
+    buffer_t buf = { 0 }, texels = { 0 };
+    uint8_t* result = NULL;
+    int levels = opt->maxlevels;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (!load_input(&inputs[i], &images[i]))
+            goto done;
+        /* every texture (every frame) needs all mip levels of the atlas */
+        const int width = images[i].width / inputs[i].frames;
+        while (levels > 1 && ((width | images[i].height) & ((1 << (levels - 1)) - 1)) != 0)
+        {
+            levels--;
+        }
+    }
+
+    asset_entry_t* a = &entries[0];
+    int width, height;
+    place(images, count, 1 << (levels - 1), u, v, &width, &height);
+    if (width > 0xffff || height > 0xffff)
+    {
+        fprintf(stderr, "atlas too large (%ix%i)\n", width, height);
+        goto done;
+    }
+    strcpy(a->name, "atlas");
+    a->type = ASSET_ATLAS;
+    a->width = (uint16_t)width;
+    a->height = (uint16_t)height;
+    a->format = (uint8_t)opt->format;
+    a->miplevels = (uint8_t)levels;
+
+    image_t mips[MAX_MIPLEVELS];
+    image_t atlas = { width, height, calloc((size_t)width * height, sizeof(uint32_t)) };
+    for (int i = 0; i < count; i++)
+    {
+        for (int y = 0; y < images[i].height; y++)
+        {
+            memcpy(&atlas.pixels[(v[i] + y) * width + u[i]], &images[i].pixels[y * images[i].width],
+                   sizeof(uint32_t) * images[i].width);
+        }
+        asset_entry_t* e = &entries[i + 1];
+        memcpy(e->name, inputs[i].name, sizeof(e->name));
+        e->type = ASSET_RECT;
+        e->u = (uint16_t)u[i];
+        e->v = (uint16_t)v[i];
+        e->width = (uint16_t)(images[i].width / inputs[i].frames);
+        e->height = (uint16_t)images[i].height;
+        e->frames = (uint16_t)inputs[i].frames;
+        e->period = (uint16_t)inputs[i].period;
+        e->format = a->format;
+        e->miplevels = a->miplevels;
+    }
+
+    uint32_t palette[PALETTE_SIZE] = { 0 };
+    int colors = 0;
+    if (opt->format == TEXTURE_I8)
+    {
+        colors = quantize(&atlas, palette);
+        buf_append(&texels, palette, sizeof(palette));
+    }
+    /* textures are aligned to 2^(levels-1), so no 2x2 block of the box
+     * filter straddles two textures */
+    mips[0] = atlas;
+    for (int k = 0; k < levels; k++)
+    {
+        emit(&texels, &mips[k], opt->format, palette, colors);
+        if (k + 1 < levels)
+            downsample(&mips[k], &mips[k + 1]);
+    }
+
+    /* span tables for textures with transparent texels */
+    buffer_t spans = { 0 };
+    for (int i = 0; i < count; i++)
+    {
+        asset_entry_t* e = &entries[i + 1];
+        e->spans = TEXTURE_NO_SPANS;
+        if (opt->format == TEXTURE_L8 || !transparent(&images[i]))
+            continue;
+        e->spans = (uint32_t)(spans.size / sizeof(uint16_t));
+        if (!spantable(mips, levels, e, &spans))
+        {
+            fprintf(stderr, "%s: span table too large\n", inputs[i].path);
+            e->spans = TEXTURE_NO_SPANS;
+        }
+    }
+    if (spans.size > 0)
+    {
+        a->spans = buf_align(&texels, sizeof(uint16_t));
+        buf_append(&texels, spans.data, spans.size);
+    }
+    free(spans.data);
+    for (int k = 0; k < levels; k++)
+    {
+        free(mips[k].pixels);
+    }
+
+    asset_header_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    buf_append(&buf, &hdr, sizeof(hdr));
+    buf_append(&buf, NULL, sizeof(asset_entry_t) * (count + 1));
+
+    a->offset = buf_align(&buf, ASSET_ALIGNMENT);
+    a->size = (uint32_t)texels.size;
+    a->compression = ASSET_RAW;
+    if (opt->compression == ASSET_LZ4)
+    {
+        const size_t packed = lz4_compress(texels.data, texels.size, &buf);
+        if (packed < texels.size)
+        {
+            a->compression = ASSET_LZ4;
+        }
+        else
+        {
+            buf.size = a->offset; // incompressible, store raw
+        }
+    }
+    if (a->compression == ASSET_RAW)
+    {
+        buf_append(&buf, texels.data, texels.size);
+    }
+    a->packed = (uint32_t)buf.size - a->offset;
+    buf_align(&buf, ASSET_ALIGNMENT);
+
+    hdr.magic = ASSET_MAGIC;
+    hdr.version = ASSET_VERSION;
+    hdr.size = (uint32_t)buf.size;
+    hdr.count = (uint32_t)count + 1;
+    memcpy(buf.data, &hdr, sizeof(hdr));
+    memcpy(buf.data + sizeof(hdr), entries, sizeof(asset_entry_t) * (count + 1));
+    *size = hdr.size;
+    result = buf.data;
+    buf.data = NULL;
+
+done:
+    for (int i = 0; i < count; i++)
+    {
+        free(images[i].pixels);
+    }
+    free(images);
+    free(entries);
+    free(u);
+    free(v);
+    free(buf.data);
+    free(texels.data);
+    return result;
+}
+
+static int info(const char* path)
+{
+    static const char* formats[] = { "argb8888", "rgb565", "l8", "i8" };
+    static const char* compression[] = { "raw", "lz4" };
+    asset_pack_t pack;
+    size_t size;
+    uint8_t* data = read_file(path, &size);
+    uint8_t* aligned = NULL;
+
+    if (data)
+    {
+        /* the pack has to be cache line aligned, like in flash */
+        aligned = malloc(size + ASSET_ALIGNMENT);
+        memcpy(aligned + (ASSET_ALIGNMENT - (uintptr_t)aligned % ASSET_ALIGNMENT), data, size);
+        free(data);
+        data = aligned + (ASSET_ALIGNMENT - (uintptr_t)aligned % ASSET_ALIGNMENT);
+    }
+    if (!data || !asset_open(&pack, data, (uint32_t)size))
+    {
+        fprintf(stderr, "%s: not a valid asset pack\n", path);
+        free(aligned);
+        return EXIT_FAILURE;
+    }
+    printf("%s: %i assets, %u bytes\n", path, pack.count, pack.header->size);
+    for (int i = 0; i < pack.count; i++)
+    {
+        const asset_entry_t* e = &pack.entries[i];
+        if (e->type == ASSET_ATLAS)
+        {
+            printf("  %-16.16s %4ux%-4u %-8s %u mips %7u bytes %-3s %7u bytes @ %u\n", e->name, e->width,
+                   e->height, formats[e->format], e->miplevels, e->size, compression[e->compression],
+                   e->packed, e->offset);
+        }
+        else
+        {
+            printf("  %-16.16s %4ux%-4u at %u,%u", e->name, e->width, e->height, e->u, e->v);
+            if (e->frames > 1)
+            {
+                printf(", %u frames %u ms", e->frames, e->period);
+            }
+            if (e->spans != TEXTURE_NO_SPANS)
+            {
+                printf(", span table at %u", e->spans);
+            }
+            printf("\n");
+        }
+    }
+    free(aligned);
+    return EXIT_SUCCESS;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: assetc [-f argb8888|rgb565|l8|i8] [-m levels] [-z lz4|none] [-k rrggbb|none]\n"
+                    "              [-a frames ms|none]\n"
+                    "              name=image ... -o pack.bin\n"
+                    "       assetc [...] name=image ... -c pack.h name\n"
+                    "       assetc -i pack.bin\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char** argv)
+{
+    static input_t inputs[MAX_ASSETS];
+    input_t current = { "", NULL, -1, 1, 0 };
+    options_t opt = { TEXTURE_ARGB8888, MAX_MIPLEVELS, ASSET_RAW };
+    const char* output = NULL;
+    const char* header = NULL;
+    const char* name = NULL;
+    int count = 0;
+
+    if (argc == 3 && strcmp(argv[1], "-i") == 0)
+    {
+        return info(argv[2]);
+    }
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        if (strcmp(arg, "-f") == 0 && i + 1 < argc)
+        {
+            const char* f = argv[++i];
+            if (strcmp(f, "argb8888") == 0)    { opt.format = TEXTURE_ARGB8888; }
+            else if (strcmp(f, "rgb565") == 0) { opt.format = TEXTURE_RGB565; }
+            else if (strcmp(f, "l8") == 0)     { opt.format = TEXTURE_L8; }
+            else if (strcmp(f, "i8") == 0)     { opt.format = TEXTURE_I8; }
+            else                               { usage(); }
+        }
+        else if (strcmp(arg, "-k") == 0 && i + 1 < argc)
+        {
+            const char* k = argv[++i];
+            current.colorkey = (strcmp(k, "none") == 0) ? -1 : (int64_t)strtol(k, NULL, 16);
+        }
+        else if (strcmp(arg, "-a") == 0 && i + 1 < argc && strcmp(argv[i + 1], "none") == 0)
+        {
+            i++;
+            current.frames = 1;
+            current.period = 0;
+        }
+        else if (strcmp(arg, "-a") == 0 && i + 2 < argc)
+        {
+            current.frames = atoi(argv[++i]);
+            current.period = atoi(argv[++i]);
+            if (current.frames < 1 || current.frames > 0xffff || current.period < 1 || current.period > 0xffff)
+            {
+                usage();
+            }
+        }
+        else if (strcmp(arg, "-m") == 0 && i + 1 < argc)
+        {
+            const int levels = atoi(argv[++i]);
+            opt.maxlevels = tools_max(1, tools_min(levels, MAX_MIPLEVELS));
+        }
+        else if (strcmp(arg, "-z") == 0 && i + 1 < argc)
+        {
+            const char* z = argv[++i];
+            if (strcmp(z, "lz4") == 0)       { opt.compression = ASSET_LZ4; }
+            else if (strcmp(z, "none") == 0) { opt.compression = ASSET_RAW; }
+            else                             { usage(); }
+        }
+        else if (strcmp(arg, "-o") == 0 && i + 1 < argc)
+        {
+            output = argv[++i];
+        }
+        else if (strcmp(arg, "-c") == 0 && i + 2 < argc)
+        {
+            header = argv[++i];
+            name = argv[++i];
+        }
+        else if (strchr(arg, '=') && arg[0] != '-' && count < MAX_ASSETS)
+        {
+            const size_t len = (size_t)(strchr(arg, '=') - arg);
+            if (len == 0 || len >= ASSET_NAME_LENGTH)
+            {
+                fprintf(stderr, "%s: asset name must have 1 to %i characters\n", arg, ASSET_NAME_LENGTH - 1);
+                return EXIT_FAILURE;
+            }
+            inputs[count] = current;
+            memset(inputs[count].name, 0, sizeof(inputs[count].name));
+            memcpy(inputs[count].name, arg, len);
+            inputs[count].path = arg + len + 1;
+            count++;
+        }
+        else
+        {
+            usage();
+        }
+    }
+    if (count == 0 || (!output && !header))
+    {
+        usage();
+    }
+
+    uint32_t size;
+    uint8_t* data = compile(inputs, count, &opt, &size);
+    if (!data)
+    {
+        return EXIT_FAILURE;
+    }
+    bool ok = true;
+    if (output)
+    {
+        ok &= write_binary(output, data, size);
+    }
+    if (header)
+    {
+        buffer_t source = { 0 };
+        for (int i = 0; i < count; i++)
+        {
+            buf_append(&source, inputs[i].path, strlen(inputs[i].path));
+            buf_append(&source, (i + 1 < count) ? ", " : "", (i + 1 < count) ? 2 : 1);
+        }
+        ok &= write_header(header, name, data, size, (const char*)source.data);
+        free(source.data);
+    }
+    free(data);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,498 @@
+/*
+ * Level compiler: converts a text level description into the binary level
+ * format (see Core/Raycaster/level.h) that is used in place by lvl_load().
+ *
+ * Usage:
+ *   levelc input.txt -o level.lvl        write binary level file
+ *   levelc input.txt -c level.h name     write C header with const array
+ *   levelc -i level.lvl                  mmap and check a level file
+ *
+ * Input format (# starts a comment):
+ *   size <width> <height>
+ *   spawn <east> <north> <dir east> <dir north>
+ *   block <cell value> <texture index>
+ *   door <cell value> <texture index> <e|n>
+ *   thin <cell value> <texture index> <e|n> <offset>
+ *   height <cell value> <height>
+ *   alpha <cell value> <opacity>
+ *   floor <texture index>               (default 0: flat color)
+ *   ceiling <texture index>             (default 0: flat color)
+ *   sprite <east> <north> <sprite index>
+ *   scatter <count> <sprite index> <seed>
+ *   map
+ *   <height lines with width characters each, north first>
+ *
+ * Map characters: '0'-'9' and 'a'-'z' are cell values 0-35, '.' is 0.
+ * door and thin declare cell values as sliding doors or thin walls: a plane
+ * at east = const (e) or north = const (n) inside the cell, at the middle
+ * (door) or at offset 0..1 (thin wall). Every door cell of the map gets a
+ * cell value of its own, so the engine can keep the door state per value.
+ * height makes the walls of a cell value lower than a full wall (0..1), the
+ * renderer draws what is behind them. alpha makes the walls of a cell value
+ * see-through (windows, grates): transparent texels show what is behind,
+ * the other texels are blended with opacity 0..1.
+ * scatter places count sprites at random positions in empty cells (same
+ * seed, same positions), e.g. for sprite benchmark levels.
+ */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "level.h"
+#include "tools.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define MAX_LINE 4096
+#define MAX_LEVEL_SPRITES 4096
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+typedef struct
+{
+    int width;
+    int height;
+    float spawn[4];
+    uint8_t* cells; /**< row-major, north first */
+    level_block_t blocks[LEVEL_MAX_BLOCKS];
+    int block_count;
+    int floor_texture;
+    int ceiling_texture;
+    level_sprite_t sprites[MAX_LEVEL_SPRITES];
+    int sprite_count;
+    int scatter[3]; /**< count, sprite index, seed of scatter directive */
+} source_t;
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+static int cellvalue(char c)
+{
+    if (c == '.') { return 0; }
+    if (c >= '0' && c <= '9') { return c - '0'; }
+    if (c >= 'a' && c <= 'z') { return c - 'a' + 10; }
+    return -1;
+}
+
+static bool parse(const char* path, source_t* src)
+{
+    char line[MAX_LINE];
+    int row = -1; // >= 0 while reading the map
+    FILE* f = fopen(path, "r");
+
+    if (!f)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return false;
+    }
+    memset(src, 0, sizeof(*src));
+    src->spawn[3] = 1.0f;
+    for (int i = 0; i < LEVEL_MAX_BLOCKS; i++)
+    {
+        src->blocks[i].texture = (uint8_t)i;
+    }
+
+    for (int lineno = 1; fgets(line, sizeof(line), f); lineno++)
+    {
+        char* hash = strchr(line, '#');
+        if (hash) { *hash = '\0'; }
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (row >= 0)
+        {
+            if (strlen(line) < (size_t)src->width)
+            {
+                if (line[0] == '\0') { continue; }
+                fprintf(stderr, "%s:%i: map row too short\n", path, lineno);
+                goto fail;
+            }
+            for (int x = 0; x < src->width; x++)
+            {
+                const int v = cellvalue(line[x]);
+                if (v < 0)
+                {
+                    fprintf(stderr, "%s:%i: invalid map character '%c'\n", path, lineno, line[x]);
+                    goto fail;
+                }
+                src->cells[row * src->width + x] = (uint8_t)v;
+                if (v >= src->block_count) { src->block_count = v + 1; }
+            }
+            if (++row == src->height) { row = -2; }
+            continue;
+        }
+
+        int a, b, c;
+        float e, n;
+        char axis;
+        if (sscanf(line, " size %i %i", &a, &b) == 2)
+        {
+            src->width = a;
+            src->height = b;
+        }
+        else if (sscanf(line, " spawn %f %f %f %f", &src->spawn[0], &src->spawn[1],
+                        &src->spawn[2], &src->spawn[3]) == 4)
+        {
+        }
+        else if (sscanf(line, " block %i %i", &a, &b) == 2 && a >= 0 && a < 256)
+        {
+            src->blocks[a].texture = (uint8_t)b;
+            if (a >= src->block_count) { src->block_count = a + 1; }
+        }
+        else if (sscanf(line, " door %i %i %c", &a, &b, &axis) == 3 && a > 0 && a < LEVEL_MAX_BLOCKS &&
+                 (axis == 'e' || axis == 'n'))
+        {
+            src->blocks[a].texture = (uint8_t)b;
+            src->blocks[a].type = LEVEL_BLOCK_DOOR;
+            src->blocks[a].axis = axis == 'e' ? LEVEL_AXIS_E : LEVEL_AXIS_N;
+            src->blocks[a].offset = 128;
+            if (a >= src->block_count) { src->block_count = a + 1; }
+        }
+        else if (sscanf(line, " thin %i %i %c %f", &a, &b, &axis, &e) == 4 && a > 0 && a < LEVEL_MAX_BLOCKS &&
+                 (axis == 'e' || axis == 'n') && e >= 0.0f && e < 1.0f)
+        {
+            src->blocks[a].texture = (uint8_t)b;
+            src->blocks[a].type = LEVEL_BLOCK_THIN;
+            src->blocks[a].axis = axis == 'e' ? LEVEL_AXIS_E : LEVEL_AXIS_N;
+            src->blocks[a].offset = (uint8_t)(e * 256.0f);
+            if (a >= src->block_count) { src->block_count = a + 1; }
+        }
+        else if (sscanf(line, " height %i %f", &a, &e) == 2 && a > 0 && a < LEVEL_MAX_BLOCKS &&
+                 e > 0.0f && e <= 1.0f)
+        {
+            const int h = (int)(e * 256.0f + 0.5f); // 1/256, 0: full height
+            src->blocks[a].height = (uint8_t)(h >= 256 ? 0 : h > 0 ? h : 1);
+            if (a >= src->block_count) { src->block_count = a + 1; }
+        }
+        else if (sscanf(line, " alpha %i %f", &a, &e) == 2 && a > 0 && a < LEVEL_MAX_BLOCKS &&
+                 e >= 0.0f && e <= 1.0f)
+        {
+            const int alpha = (int)(e * 255.0f + 0.5f);
+            src->blocks[a].alpha = (uint8_t)(alpha > 0 ? alpha : 1);
+            if (a >= src->block_count) { src->block_count = a + 1; }
+        }
+        else if (sscanf(line, " floor %i", &a) == 1 && a >= 0 && a < 256)
+        {
+            src->floor_texture = a;
+        }
+        else if (sscanf(line, " ceiling %i", &a) == 1 && a >= 0 && a < 256)
+        {
+            src->ceiling_texture = a;
+        }
+        else if (sscanf(line, " sprite %f %f %i", &e, &n, &a) == 3 && a >= 0)
+        {
+            if (src->sprite_count == MAX_LEVEL_SPRITES)
+            {
+                fprintf(stderr, "%s:%i: too many sprites\n", path, lineno);
+                goto fail;
+            }
+            src->sprites[src->sprite_count++] = (level_sprite_t){ e, n, (uint32_t)a };
+        }
+        else if (sscanf(line, " scatter %i %i %i", &a, &b, &c) == 3 && a >= 0 && b >= 0)
+        {
+            src->scatter[0] = a;
+            src->scatter[1] = b;
+            src->scatter[2] = c;
+        }
+        else if (strncmp(line, "map", 3) == 0 && row == -1)
+        {
+            if (src->width < 1 || src->height < 1)
+            {
+                fprintf(stderr, "%s:%i: size must be set before map\n", path, lineno);
+                goto fail;
+            }
+            src->cells = calloc((size_t)src->width * src->height, 1);
+            row = 0;
+        }
+        else if (line[strspn(line, " \t")] != '\0')
+        {
+            fprintf(stderr, "%s:%i: syntax error\n", path, lineno);
+            goto fail;
+        }
+    }
+    fclose(f);
+    if (row != -2)
+    {
+        fprintf(stderr, "%s: incomplete map\n", path);
+        return false;
+    }
+    return true;
+
+fail:
+    fclose(f);
+    return false;
+}
+
+/** Place the sprites of the scatter directive in random empty cells,
+ *  with a simple LCG so that the result does not depend on the C library. */
+static bool scatter(source_t* src)
+{
+    uint32_t seed = (uint32_t)src->scatter[2];
+    int empty = 0;
+
+    for (int i = 0; i < src->width * src->height; i++)
+    {
+        empty += (src->cells[i] == 0);
+    }
+    if (src->scatter[0] > 0 && empty == 0)
+    {
+        return false;
+    }
+    for (int i = 0; i < src->scatter[0]; i++)
+    {
+        if (src->sprite_count == MAX_LEVEL_SPRITES)
+        {
+            return false;
+        }
+        int x, y;
+        do
+        {
+            seed = seed * 1664525u + 1013904223u;
+            x = (int)((seed >> 8) % (uint32_t)src->width);
+            seed = seed * 1664525u + 1013904223u;
+            y = (int)((seed >> 8) % (uint32_t)src->height);
+        } while (src->cells[y * src->width + x] != 0);
+        seed = seed * 1664525u + 1013904223u;
+        const float fe = 0.25f + 0.5f * (float)((seed >> 8) & 0xff) / 255.0f;
+        seed = seed * 1664525u + 1013904223u;
+        const float fn = 0.25f + 0.5f * (float)((seed >> 8) & 0xff) / 255.0f;
+        /* map rows are stored north first */
+        src->sprites[src->sprite_count++] = (level_sprite_t){
+            (float)x + fe, (float)(src->height - 1 - y) + fn, (uint32_t)src->scatter[1] };
+    }
+    return true;
+}
+
+/** Give every door cell but the first of each door value a new cell value
+ *  with a copy of the block, so that doors open and close independently */
+static bool doors(source_t* src)
+{
+    bool used[LEVEL_MAX_BLOCKS] = { false };
+    int next = src->block_count; // cell values >= block_count are free
+
+    for (int i = 0; i < src->width * src->height; i++)
+    {
+        const int v = src->cells[i];
+        if (src->blocks[v].type != LEVEL_BLOCK_DOOR || v == 0)
+            continue;
+        if (used[v])
+        {
+            if (next == LEVEL_MAX_BLOCKS)
+            {
+                return false;
+            }
+            src->blocks[next] = src->blocks[v];
+            src->cells[i] = (uint8_t)next;
+            used[next++] = true;
+        }
+        used[v] = true;
+    }
+    src->block_count = next;
+    return true;
+}
+
+/** Chebyshev distance to the next non-empty cell (saturated at 255),
+ *  exact two pass chessboard distance transform. */
+static void distancefield(const source_t* src, uint8_t* dist)
+{
+    const int w = src->width;
+    const int h = src->height;
+
+    for (int i = 0; i < w * h; i++)
+    {
+        dist[i] = src->cells[i] ? 0 : 255;
+    }
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            int d = dist[y * w + x];
+            if (x > 0)              { d = tools_min(d, dist[y * w + x - 1] + 1); }
+            if (y > 0)
+            {
+                if (x > 0)          { d = tools_min(d, dist[(y - 1) * w + x - 1] + 1); }
+                                      d = tools_min(d, dist[(y - 1) * w + x] + 1);
+                if (x < w - 1)      { d = tools_min(d, dist[(y - 1) * w + x + 1] + 1); }
+            }
+            dist[y * w + x] = (uint8_t)tools_min(d, 255);
+        }
+    }
+    for (int y = h - 1; y >= 0; y--)
+    {
+        for (int x = w - 1; x >= 0; x--)
+        {
+            int d = dist[y * w + x];
+            if (x < w - 1)          { d = tools_min(d, dist[y * w + x + 1] + 1); }
+            if (y < h - 1)
+            {
+                if (x < w - 1)      { d = tools_min(d, dist[(y + 1) * w + x + 1] + 1); }
+                                      d = tools_min(d, dist[(y + 1) * w + x] + 1);
+                if (x > 0)          { d = tools_min(d, dist[(y + 1) * w + x - 1] + 1); }
+            }
+            dist[y * w + x] = (uint8_t)tools_min(d, 255);
+        }
+    }
+}
+
+/** Reorder a row-major (north first) cell array into the chunk-major layout */
+static void chunkify(const uint8_t* rowmajor, int w, int h, uint8_t* out)
+{
+    for (int cy = 0; cy * LEVEL_CHUNK_SIZE < h; cy++)
+    {
+        for (int cx = 0; cx * LEVEL_CHUNK_SIZE < w; cx++)
+        {
+            const int cw = tools_min(LEVEL_CHUNK_SIZE, w - cx * LEVEL_CHUNK_SIZE);
+            const int ch = tools_min(LEVEL_CHUNK_SIZE, h - cy * LEVEL_CHUNK_SIZE);
+            for (int row = 0; row < ch; row++)
+            {
+                memcpy(out, &rowmajor[(cy * LEVEL_CHUNK_SIZE + row) * w + cx * LEVEL_CHUNK_SIZE], cw);
+                out += cw;
+            }
+        }
+    }
+}
+
+static uint8_t* compile(const source_t* src, uint32_t* size)
+{
+    const int w = src->width;
+    const int h = src->height;
+    const uint32_t cellcount = (uint32_t)(w * h);
+    level_header_t hdr;
+    buffer_t buf = { 0 };
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = LEVEL_MAGIC;
+    hdr.version = LEVEL_VERSION;
+    hdr.width = (uint32_t)w;
+    hdr.height = (uint32_t)h;
+    hdr.spawn_e = src->spawn[0];
+    hdr.spawn_n = src->spawn[1];
+    hdr.spawn_dir_e = src->spawn[2];
+    hdr.spawn_dir_n = src->spawn[3];
+    hdr.floor_texture = (uint32_t)src->floor_texture;
+    hdr.ceiling_texture = (uint32_t)src->ceiling_texture;
+    buf_append(&buf, &hdr, sizeof(hdr));
+
+    uint8_t* tmp = malloc(cellcount);
+    uint8_t* dist = malloc(cellcount);
+
+    hdr.cells_offset = buf_align(&buf, 4);
+    chunkify(src->cells, w, h, tmp);
+    buf_append(&buf, tmp, cellcount);
+
+    hdr.blocks_offset = buf_align(&buf, 4);
+    hdr.block_count = (uint32_t)src->block_count;
+    buf_append(&buf, src->blocks, sizeof(level_block_t) * src->block_count);
+
+    hdr.dist_offset = buf_align(&buf, 4);
+    distancefield(src, dist);
+    chunkify(dist, w, h, tmp);
+    buf_append(&buf, tmp, cellcount);
+
+    hdr.sprites_offset = buf_align(&buf, 4);
+    hdr.sprite_count = (uint32_t)src->sprite_count;
+    buf_append(&buf, src->sprites, sizeof(level_sprite_t) * src->sprite_count);
+
+    /* occupancy pyramid: level k has one byte per 2^k x 2^k block */
+    for (int k = 1; k <= LEVEL_MAX_PYRAMID; k++)
+    {
+        const int lw = (w + (1 << k) - 1) >> k;
+        const int lh = (h + (1 << k) - 1) >> k;
+        memset(tmp, 0, (size_t)(lw * lh));
+        for (int y = 0; y < h; y++)
+        {
+            for (int x = 0; x < w; x++)
+            {
+                tmp[(y >> k) * lw + (x >> k)] |= (src->cells[y * w + x] != 0);
+            }
+        }
+        hdr.pyramid_offset[k - 1] = buf_align(&buf, 4);
+        hdr.pyramid_levels = (uint32_t)k;
+        buf_append(&buf, tmp, (size_t)(lw * lh));
+        if (lw == 1 && lh == 1) { break; }
+    }
+    buf_align(&buf, 4);
+
+    hdr.size = (uint32_t)buf.size;
+    memcpy(buf.data, &hdr, sizeof(hdr));
+    free(tmp);
+    free(dist);
+    *size = hdr.size;
+    return buf.data;
+}
+
+/** mmap a level file and use it in place, like the engine does */
+static int info(const char* path)
+{
+    level_t* level = malloc(sizeof(level_t));
+    struct stat st;
+    const int fd = open(path, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return EXIT_FAILURE;
+    }
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED || !lvl_load(level, data, (uint32_t)st.st_size))
+    {
+        fprintf(stderr, "%s: not a valid level file\n", path);
+        return EXIT_FAILURE;
+    }
+    const level_header_t* h = level->header;
+    printf("%s: %ux%u cells, %u block types, %u sprites, %u pyramid levels, %u bytes\n",
+           path, h->width, h->height, h->block_count, h->sprite_count, h->pyramid_levels, h->size);
+    printf("spawn: %.2f %.2f dir: %.2f %.2f\n", (double)h->spawn_e, (double)h->spawn_n,
+           (double)h->spawn_dir_e, (double)h->spawn_dir_n);
+    printf("floor texture: %u, ceiling texture: %u\n", h->floor_texture, h->ceiling_texture);
+    munmap(data, (size_t)st.st_size);
+    close(fd);
+    free(level);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    static source_t src;
+    uint32_t size;
+
+    if (argc == 3 && strcmp(argv[1], "-i") == 0)
+    {
+        return info(argv[2]);
+    }
+    if (!(argc == 4 && strcmp(argv[2], "-o") == 0) &&
+        !(argc == 5 && strcmp(argv[2], "-c") == 0))
+    {
+        fprintf(stderr, "usage: levelc input.txt -o level.lvl\n"
+                        "       levelc input.txt -c level.h name\n"
+                        "       levelc -i level.lvl\n");
+        return EXIT_FAILURE;
+    }
+    if (!parse(argv[1], &src))
+    {
+        return EXIT_FAILURE;
+    }
+    if (!doors(&src))
+    {
+        fprintf(stderr, "%s: too many doors\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    if (!scatter(&src))
+    {
+        fprintf(stderr, "%s: no room to scatter %i sprites\n", argv[1], src.scatter[0]);
+        return EXIT_FAILURE;
+    }
+
+    uint8_t* data = compile(&src, &size);
+    const bool ok = (argc == 4) ?
+        write_binary(argv[3], data, size) :
+        write_header(argv[3], argv[4], data, size, argv[1]);
+    free(data);
+    free(src.cells);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,158 @@
+/*
+ * Decompression benchmark: inflates all compressed assets of an asset pack
+ * with the engine decompressor (Core/Raycaster/lz4.c), checks the result
+ * and reports compression ratio and throughput.
+ *
+ * Usage:
+ *   lz4bench pack.bin [iterations]
+ *   lz4bench -f file [iterations]     compress and benchmark any file
+ */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "asset.h"
+#include "lz4.h"
+#include "tools.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define DEFAULT_ITERATIONS 200
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+typedef struct
+{
+    uint64_t packed;
+    uint64_t size;
+    double seconds;
+} result_t;
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint8_t* alloc_aligned(size_t size)
+{
+    void* p = NULL;
+    if (posix_memalign(&p, ASSET_ALIGNMENT, size ? size : 1) != 0)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+static uint8_t* read_aligned(const char* path, size_t* size)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t* data = alloc_aligned(*size);
+    if (fread(data, 1, *size, f) != *size)
+    {
+        fprintf(stderr, "Failed to read %s\n", path);
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+/** Decompress src iterations times, verify against expected if given */
+static bool bench(const char* name, const uint8_t* src, uint32_t packed, uint32_t size,
+                  const uint8_t* expected, int iterations, result_t* total)
+{
+    uint8_t* dst = alloc_aligned(size);
+    const double t0 = now();
+    int32_t n = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        n = lz4_decompress(src, packed, dst, size);
+    }
+    const double t = now() - t0;
+    const bool ok = (n == (int32_t)size) && (!expected || memcmp(dst, expected, size) == 0);
+
+    printf("  %-16.16s %8u -> %8u bytes  ratio %5.3f  %8.1f MB/s%s\n", name, packed, size,
+           (double)packed / size, (double)size * iterations / t / 1e6, ok ? "" : "  FAILED");
+    total->packed += packed;
+    total->size += size;
+    total->seconds += t / iterations;
+    free(dst);
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    const bool rawfile = argc >= 3 && strcmp(argv[1], "-f") == 0;
+    const char* path = rawfile ? argv[2] : argv[1];
+    const int argi = rawfile ? 3 : 2;
+    const int iterations = argc > argi ? atoi(argv[argi]) : DEFAULT_ITERATIONS;
+    result_t total = { 0, 0, 0.0 };
+    bool ok = true;
+    size_t size;
+
+    if (argc < 2 || iterations < 1)
+    {
+        fprintf(stderr, "usage: lz4bench pack.bin [iterations]\n"
+                        "       lz4bench -f file [iterations]\n");
+        return EXIT_FAILURE;
+    }
+    uint8_t* data = read_aligned(path, &size);
+    if (!data)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (rawfile)
+    {
+        buffer_t packed = { 0 };
+        lz4_compress(data, size, &packed);
+        ok = bench(path, packed.data, (uint32_t)packed.size, (uint32_t)size, data, iterations, &total);
+        free(packed.data);
+    }
+    else
+    {
+        asset_pack_t pack;
+        if (!asset_open(&pack, data, (uint32_t)size))
+        {
+            fprintf(stderr, "%s: not a valid asset pack\n", path);
+            free(data);
+            return EXIT_FAILURE;
+        }
+        for (int i = 0; i < pack.count; i++)
+        {
+            const asset_entry_t* e = &pack.entries[i];
+            if (e->compression == ASSET_LZ4)
+            {
+                ok &= bench(e->name, data + e->offset, e->packed, e->size, NULL, iterations, &total);
+            }
+        }
+    }
+
+    if (total.size > 0)
+    {
+        printf("total: %llu -> %llu bytes, ratio %.3f, %.1f MB/s, %.3f ms per load\n",
+               (unsigned long long)total.packed, (unsigned long long)total.size,
+               (double)total.packed / (double)total.size, (double)total.size / total.seconds / 1e6,
+               total.seconds * 1e3);
+    }
+    free(data);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
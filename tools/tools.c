@@ -0,0 +1,182 @@
+/* Helper functions shared by the host tools */
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* PROJECT HEADER ----------------------------------------------------------- */
+#include "tools.h"
+
+/* DEFINES ------------------------------------------------------------------ */
+#define EOL "\r\n" /**< generated headers use the line endings of Core/ */
+
+/* FUNCTION BODIES ---------------------------------------------------------- */
+void buf_append(buffer_t* buf, const void* data, size_t len)
+{
+    if (buf->size + len > buf->capacity)
+    {
+        buf->capacity = tools_max(buf->capacity * 2, buf->size + len);
+        buf->data = realloc(buf->data, buf->capacity);
+        if (!buf->data)
+        {
+            fprintf(stderr, "Out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (data)
+    {
+        memcpy(buf->data + buf->size, data, len);
+    }
+    else
+    {
+        memset(buf->data + buf->size, 0, len);
+    }
+    buf->size += len;
+}
+
+/** Pad buffer with zeros to alignment, return new size */
+uint32_t buf_align(buffer_t* buf, size_t alignment)
+{
+    const size_t pad = (alignment - buf->size % alignment) % alignment;
+    buf_append(buf, NULL, pad);
+    return (uint32_t)buf->size;
+}
+
+bool write_binary(const char* path, const uint8_t* data, size_t size)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f || fwrite(data, 1, size, f) != size)
+    {
+        fprintf(stderr, "Failed to write %s\n", path);
+        if (f) { fclose(f); }
+        return false;
+    }
+    fclose(f);
+    return true;
+}
+
+/** Write data as const C array, aligned to a cache line so that it can be
+ *  used in place from flash */
+bool write_header(const char* path, const char* name, const uint8_t* data,
+                  size_t size, const char* source)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f)
+    {
+        fprintf(stderr, "Failed to write %s\n", path);
+        return false;
+    }
+    fprintf(f, "/* Generated from %s, do not edit */" EOL, source);
+    fprintf(f, "#pragma once" EOL EOL);
+    fprintf(f, "#include <stdint.h>" EOL EOL);
+    fprintf(f, "const uint8_t %s[%u] __attribute__((aligned(32))) =" EOL "{" EOL, name, (unsigned)size);
+    for (size_t i = 0; i < size; i++)
+    {
+        fprintf(f, "%s0x%02x,%s", (i % 16 == 0) ? "    " : "", data[i],
+                (i % 16 == 15 || i == size - 1) ? EOL : " ");
+    }
+    fprintf(f, "};" EOL);
+    fclose(f);
+    return true;
+}
+
+/* LZ4 ---------------------------------------------------------------------- */
+#define LZ4_HASH_BITS   16
+#define LZ4_MAX_OFFSET  65535
+#define LZ4_MAX_CHAIN   256 /**< match candidates tried per position */
+#define LZ4_LAST_LITERALS 5  /**< the block has to end with >= 5 literals */
+#define LZ4_MFLIMIT     12   /**< no match may start in the last 12 bytes */
+
+static uint32_t lz4_hash(const uint8_t* p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return (v * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+static void lz4_length(buffer_t* out, size_t len)
+{
+    for (; len >= 255; len -= 255)
+    {
+        const uint8_t b = 255;
+        buf_append(out, &b, 1);
+    }
+    const uint8_t b = (uint8_t)len;
+    buf_append(out, &b, 1);
+}
+
+static void lz4_sequence(buffer_t* out, const uint8_t* literals, size_t litlen, size_t offset, size_t matchlen)
+{
+    const size_t ml = matchlen ? matchlen - 4 : 0;
+    const uint8_t token = (uint8_t)((tools_min(litlen, 15) << 4) | tools_min(ml, 15));
+
+    buf_append(out, &token, 1);
+    if (litlen >= 15) { lz4_length(out, litlen - 15); }
+    buf_append(out, literals, litlen);
+    if (matchlen)
+    {
+        const uint8_t o[2] = { (uint8_t)offset, (uint8_t)(offset >> 8) };
+        buf_append(out, o, 2);
+        if (ml >= 15) { lz4_length(out, ml - 15); }
+    }
+}
+
+/** Compress src into a LZ4 block (hash chain match finder, greedy parsing),
+ *  append it to out and return the compressed size */
+size_t lz4_compress(const uint8_t* src, size_t size, buffer_t* out)
+{
+    const size_t start = out->size;
+    int32_t* head = malloc(sizeof(int32_t) << LZ4_HASH_BITS);
+    int32_t* chain = malloc(sizeof(int32_t) * (size + 1));
+    size_t anchor = 0;
+    size_t pos = 0;
+
+    memset(head, 0xff, sizeof(int32_t) << LZ4_HASH_BITS);
+    while (size >= LZ4_MFLIMIT && pos + LZ4_MFLIMIT <= size)
+    {
+        const uint32_t h = lz4_hash(src + pos);
+        const size_t limit = size - LZ4_LAST_LITERALS;
+        size_t best = 0, bestoffset = 0;
+
+        int32_t cand = head[h];
+        for (int n = 0; cand >= 0 && pos - (size_t)cand <= LZ4_MAX_OFFSET && n < LZ4_MAX_CHAIN; n++)
+        {
+            size_t len = 0;
+            while (pos + len < limit && src[cand + len] == src[pos + len])
+            {
+                len++;
+            }
+            if (len > best)
+            {
+                best = len;
+                bestoffset = pos - (size_t)cand;
+            }
+            cand = chain[cand];
+        }
+        chain[pos] = head[h];
+        head[h] = (int32_t)pos;
+
+        if (best < 4)
+        {
+            pos++;
+            continue;
+        }
+        lz4_sequence(out, src + anchor, pos - anchor, bestoffset, best);
+        /* insert the positions covered by the match into the hash chains */
+        for (size_t i = pos + 1; i < pos + best && i + 4 <= size; i++)
+        {
+            const uint32_t hi = lz4_hash(src + i);
+            chain[i] = head[hi];
+            head[hi] = (int32_t)i;
+        }
+        pos += best;
+        anchor = pos;
+    }
+    lz4_sequence(out, src + anchor, size - anchor, 0, 0);
+    free(head);
+    free(chain);
+    return out->size - start;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+/* SYSTEM HEADER ------------------------------------------------------------ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* DEFINES ------------------------------------------------------------------ */
+#define tools_min(x, y) (((x) < (y)) ? (x) : (y))
+#define tools_max(x, y) (((x) > (y)) ? (x) : (y))
+
+/* TYPEDEFS ----------------------------------------------------------------- */
+
+/** growing output buffer */
+typedef struct
+{
+    uint8_t* data;
+    size_t   size;
+    size_t   capacity;
+} buffer_t;
+
+/* FUNCTION PROTOTYPES ------------------------------------------------------ */
+void buf_append(buffer_t* buf, const void* data, size_t len);
+uint32_t buf_align(buffer_t* buf, size_t alignment);
+
+size_t lz4_compress(const uint8_t* src, size_t size, buffer_t* out);
+
+bool write_binary(const char* path, const uint8_t* data, size_t size);
+bool write_header(const char* path, const char* name, const uint8_t* data,
+                  size_t size, const char* source);